@@ -255,6 +255,20 @@ namespace dash
                  */
                 virtual const std::string&                      GetMaxFramerate                 ()  const = 0;
 
+                /**
+                 *  Returns a reference to a dash::mpd::FrameRate that holds the frame rate decoded from the attribute returned by GetMinFramerate().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::FrameRate
+                 */
+                virtual const FrameRate&                        GetMinFramerateValue            ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::FrameRate that holds the frame rate decoded from the attribute returned by GetMaxFramerate().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::FrameRate
+                 */
+                virtual const FrameRate&                        GetMaxFramerateValue            ()  const = 0;
+
                 /**
                  *  Because of the fact that the type of the attribute \em segmentAlignment is a union of \c xs:unsignedInt and \c xs:boolean this method is needed to determine
                  *  whether its value is of type bool or integer.\n
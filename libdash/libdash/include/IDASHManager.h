@@ -2,6 +2,10 @@
  *  @class      dash::IDASHManager
  *  @brief      This interface is needed for generating an IMPD object from the information found in a MPD file
  *  @details    By invoking the method Open(char *path) all the information found in the MPD file specified by \em path is mapped to corresponding IMPD objects.
+ *              The Open(), Refresh(), WriteSnapshot() and OpenSnapshot() methods can be called from several threads at once, as long as
+ *              each thread works on a different dash::mpd::IMPD object and the settings and observers are not changed meanwhile.
+ *              The observers are then informed on all of these threads. Several managers can be used in parallel as well, the global
+ *              state of libxml2 and curl is initialized once, by the first one, and kept until the process exits.
  *  @see        dash::mpd::IMPD
  *
  *  @author     bitmovin Softwareentwicklung OG \n
@@ -19,7 +23,11 @@
 #include "config.h"
 
 #include "IMPD.h"
+#include "IRefreshReport.h"
 #include "IConnection.h"
+#include "ParseOptions.h"
+#include "IMPDBuildObserver.h"
+#include "IMPDRequest.h"
 
 namespace dash
 {
@@ -29,12 +37,237 @@ namespace dash
             virtual ~IDASHManager(){}
 
             /**
-             *  Returns a pointer to dash::mpd::IMPD object representing the the information found in the MPD file specified by \em path
+             *  Returns a pointer to dash::mpd::IMPD object representing the the information found in the MPD file specified by \em path.
+             *  An \c http or \c https URI is fetched with curl: the transfer may be compressed, redirects are followed, connections are
+             *  reused by the following fetches and the \c ETag and \c Last-Modified headers are kept for Refresh(), see SetFetchTimeout().
              *  @param      path    A URI to a MPD file
              *  @return     a pointer to an dash::mpd::IMPD object
              */
             virtual mpd::IMPD* Open (char *path) = 0;
 
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the the information found in the MPD held by \em data.
+             *  This avoids writing a manifest that has already been downloaded to disk before parsing it.
+             *  @param      data    A buffer containing the MPD document, it is not referenced after the call returns
+             *  @param      length  The size of \em data in bytes
+             *  @param      baseUrl The URL the MPD has been retrieved from, relative <tt>BaseURL</tt> elements are resolved against its directory
+             *  @return     a pointer to an dash::mpd::IMPD object or NULL if the MPD could not be parsed
+             */
+            virtual mpd::IMPD* Open (const char *data, size_t length, const std::string &baseUrl) = 0;
+
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the the information found in the local MPD file specified by \em path.
+             *  The file is mapped into memory instead of being read through a file stream.
+             *  @param      path    The path to a local MPD file
+             *  @param      baseUrl The URL the MPD has been retrieved from, relative <tt>BaseURL</tt> elements are resolved against its directory
+             *  @return     a pointer to an dash::mpd::IMPD object or NULL if the file could not be mapped or parsed
+             */
+            virtual mpd::IMPD* Open (const char *path, const std::string &baseUrl) = 0;
+
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the parts of the MPD file specified by \em path that are selected by \em options.
+             *  @param      path    A URI to a MPD file
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to an dash::mpd::IMPD object
+             */
+            virtual mpd::IMPD* Open (char *path, const ParseOptions &options) = 0;
+
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the parts of the MPD held by \em data that are selected by \em options,
+             *  see Open(const char *data, size_t length, const std::string &baseUrl).
+             *  @param      data    A buffer containing the MPD document, it is not referenced after the call returns
+             *  @param      length  The size of \em data in bytes
+             *  @param      baseUrl The URL the MPD has been retrieved from, relative <tt>BaseURL</tt> elements are resolved against its directory
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to an dash::mpd::IMPD object or NULL if the MPD could not be parsed
+             */
+            virtual mpd::IMPD* Open (const char *data, size_t length, const std::string &baseUrl, const ParseOptions &options) = 0;
+
+            /**
+             *  Returns a pointer to dash::mpd::IMPD object representing the parts of the local MPD file specified by \em path that are selected by \em options,
+             *  see Open(const char *path, const std::string &baseUrl).
+             *  @param      path    The path to a local MPD file
+             *  @param      baseUrl The URL the MPD has been retrieved from, relative <tt>BaseURL</tt> elements are resolved against its directory
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to an dash::mpd::IMPD object or NULL if the file could not be mapped or parsed
+             */
+            virtual mpd::IMPD* Open (const char *path, const std::string &baseUrl, const ParseOptions &options) = 0;
+
+            /**
+             *  Fetches and builds the MPD specified by \em url on a thread of its own, like Open(char *path) does on the calling thread.
+             *  @param      url     A URI to a MPD file
+             *  @return     a pointer to a dash::IMPDRequest object, which must be deleted by the caller before the manager, or NULL if the thread could not be started
+             */
+            virtual IMPDRequest*    OpenAsync   (const char *url) = 0;
+
+            /**
+             *  Fetches and builds the parts of the MPD specified by \em url that are selected by \em options on a thread of its own,
+             *  see OpenAsync(const char *url). The filter of \em options is called on that thread and must stay valid until the request has completed.
+             *  @param      url     A URI to a MPD file
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to a dash::IMPDRequest object, which must be deleted by the caller before the manager, or NULL if the thread could not be started
+             */
+            virtual IMPDRequest*    OpenAsync   (const char *url, const ParseOptions &options) = 0;
+
+            /**
+             *  Merges a new version of a dynamic MPD into \em mpd instead of creating a new dash::mpd::IMPD object.
+             *  Elements that did not change keep their pointers, new <tt><b>S</b></tt> elements are appended to the existing
+             *  <tt><b>SegmentTimeline</b></tt> elements. See dash::mpd::IRefreshReport for details.
+             *  An \c http or \c https URI is fetched with the validators of \em mpd, if the server answers that the MPD has not been
+             *  modified, it is neither transferred nor parsed again, see dash::mpd::IRefreshReport::IsNotModified().
+             *  If \em mpd announces a <tt><b>PatchLocation</b></tt> that has not expired, the MPD Patch document is fetched from there instead
+             *  and applied with ApplyPatch(). The whole MPD is only fetched if the patch cannot be fetched or does not match \em mpd.
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      path    A URI to the new version of the MPD file
+             *  @return     a pointer to a dash::mpd::IRefreshReport object, which must be deleted by the caller, or NULL if the MPD could not be parsed.
+             *              In that case \em mpd is left unchanged.
+             */
+            virtual mpd::IRefreshReport* Refresh (mpd::IMPD *mpd, char *path) = 0;
+
+            /**
+             *  Merges a new version of a dynamic MPD held by \em data into \em mpd, see Refresh(mpd::IMPD *mpd, char *path).
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      data    A buffer containing the new version of the MPD document
+             *  @param      length  The size of \em data in bytes
+             *  @param      baseUrl The URL the MPD has been retrieved from, relative <tt>BaseURL</tt> elements are resolved against its directory
+             *  @return     a pointer to a dash::mpd::IRefreshReport object, which must be deleted by the caller, or NULL if the MPD could not be parsed
+             */
+            virtual mpd::IRefreshReport* Refresh (mpd::IMPD *mpd, const char *data, size_t length, const std::string &baseUrl) = 0;
+
+            /**
+             *  Merges the parts of a new version of a dynamic MPD that are selected by \em options into \em mpd, see Refresh(mpd::IMPD *mpd, char *path).
+             *  An MPD that has been opened with options should be refreshed with the same options, otherwise the elements it left out are added.
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      path    A URI to the new version of the MPD file
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to a dash::mpd::IRefreshReport object, which must be deleted by the caller, or NULL if the MPD could not be parsed
+             */
+            virtual mpd::IRefreshReport* Refresh (mpd::IMPD *mpd, char *path, const ParseOptions &options) = 0;
+
+            /**
+             *  Merges the parts of a new version of a dynamic MPD held by \em data that are selected by \em options into \em mpd,
+             *  see Refresh(mpd::IMPD *mpd, char *path, const ParseOptions &options).
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      data    A buffer containing the new version of the MPD document
+             *  @param      length  The size of \em data in bytes
+             *  @param      baseUrl The URL the MPD has been retrieved from, relative <tt>BaseURL</tt> elements are resolved against its directory
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to a dash::mpd::IRefreshReport object, which must be deleted by the caller, or NULL if the MPD could not be parsed
+             */
+            virtual mpd::IRefreshReport* Refresh (mpd::IMPD *mpd, const char *data, size_t length, const std::string &baseUrl, const ParseOptions &options) = 0;
+
+            /**
+             *  Applies an MPD Patch document held by \em data to \em mpd, so that a live MPD is refreshed without transferring the elements that did not change.
+             *  The add, replace and remove operations of the patch are applied to the elements of \em mpd in place: each operation only converts the
+             *  elements it selects and merges them like the same elements of a new version passed to Refresh(), no copy of the MPD document is kept.
+             *  \em mpd has to keep its raw attributes, see dash::ParseOptions::keepRawAttributes, elements it does not keep cannot be selected.
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      data    A buffer containing the <tt><b>Patch</b></tt> document
+             *  @param      length  The size of \em data in bytes
+             *  @return     a pointer to a dash::mpd::IRefreshReport object, which must be deleted by the caller, or NULL if \em mpd does not keep its raw
+             *              attributes, the \c \@mpdId or \c \@originalPublishTime of the patch do not match \em mpd or one of its operations cannot be applied.
+             *              \em mpd is left unchanged in the first two cases. The operations before the one that failed have been applied in the last case,
+             *              so the whole MPD has to be fetched with Refresh() after NULL has been returned, which Refresh() does by itself. The validators
+             *              of \em mpd are dropped then, so that fetch is unconditional and cannot be answered with "not modified".
+             */
+            virtual mpd::IRefreshReport* ApplyPatch (mpd::IMPD *mpd, const char *data, size_t length) = 0;
+
+            /**
+             *  Applies an MPD Patch document held by \em data to \em mpd and merges the parts of the result that are selected by \em options,
+             *  see ApplyPatch(mpd::IMPD *mpd, const char *data, size_t length).
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      data    A buffer containing the <tt><b>Patch</b></tt> document
+             *  @param      length  The size of \em data in bytes
+             *  @param      options The elements to build, see dash::ParseOptions
+             *  @return     a pointer to a dash::mpd::IRefreshReport object, which must be deleted by the caller, or NULL if the patch cannot be applied
+             */
+            virtual mpd::IRefreshReport* ApplyPatch (mpd::IMPD *mpd, const char *data, size_t length, const ParseOptions &options) = 0;
+
+            /**
+             *  Writes \em mpd into a binary snapshot that OpenSnapshot() loads without parsing the XML document again, e.g. to cache
+             *  large manifests between runs. The snapshot stores the elements with their attributes in a string table and a compact
+             *  record stream, it can only be loaded by the same version of the library on a machine with the same byte order.
+             *  @param      mpd     A dash::mpd::IMPD object returned by one of the Open() methods
+             *  @param      path    The path of the snapshot file, an existing file is replaced
+             *  @return     true if the snapshot has been written completely, false if \em mpd has been opened without raw attributes, see dash::ParseOptions
+             */
+            virtual bool        WriteSnapshot   (mpd::IMPD *mpd, const char *path) = 0;
+
+            /**
+             *  Returns a pointer to a dash::mpd::IMPD object loaded from a snapshot written by WriteSnapshot(). The file is mapped into memory
+             *  and the elements are built directly from it. The object behaves like the one that has been written, including Refresh().
+             *  @param      path    The path of the snapshot file
+             *  @return     a pointer to an dash::mpd::IMPD object or NULL if the file is missing, truncated or has been written by another version
+             */
+            virtual mpd::IMPD*  OpenSnapshot    (const char *path) = 0;
+
+            /**
+             *  Controls whether the MPDs returned by the Open() methods are built into an arena owned by the dash::mpd::IMPD object.
+             *  All elements are then allocated from a few large blocks, which are released at once when the dash::mpd::IMPD object is deleted.
+             *  The elements that Refresh() and the XLink resolution add later are allocated on the heap, so the arena does not grow with every refresh,
+             *  only the memory of the elements they replace stays in the arena until then. Disabled by default.
+             *  @param      enable  true to allocate the elements of subsequently opened MPDs from an arena
+             */
+            virtual void        SetArenaAllocation  (bool enable) = 0;
+
+            /**
+             *  Sets the number of worker threads that convert the <tt><b>Period</b></tt> elements of MPDs passed to Open() and Refresh().
+             *  Each <tt><b>Period</b></tt> is read into a temporary node tree and converted while the parser continues with the following ones,
+             *  the resulting dash::mpd::IPeriod objects keep the document order. This pays off for manifests with many Periods,
+             *  e.g. with inserted ads. A value of 0 or 1 converts all Periods on the calling thread, which is the default.
+             *  With worker threads the dash::IMPDBuildObserver objects are informed about the <tt><b>AdaptationSets</b></tt> on the workers.
+             *  @param      threads the number of worker threads
+             */
+            virtual void        SetPeriodConversionThreads  (size_t threads) = 0;
+
+            /**
+             *  Attaches an observer that is informed about every <tt><b>Period</b></tt> and <tt><b>AdaptationSet</b></tt> built by the Open() methods,
+             *  while the following elements are still being parsed. Refresh() and OpenSnapshot() do not inform the observers.
+             *  Elements whose <tt>xlink:href</tt> is resolved on load are not reported, the remote elements that replace them are reported once they have been built.
+             *  @param      observer    A pointer to a dash::IMPDBuildObserver object, which must stay valid until it is detached
+             */
+            virtual void        AttachBuildObserver (IMPDBuildObserver *observer) = 0;
+
+            /**
+             *  Detaches an observer attached with AttachBuildObserver().
+             *  @param      observer    A pointer to a dash::IMPDBuildObserver object
+             */
+            virtual void        DetachBuildObserver (IMPDBuildObserver *observer) = 0;
+
+            /**
+             *  Limits the time a fetch of an \c http or \c https URI by Open(), OpenAsync() or Refresh() may take, including the connection setup.
+             *  The default is 30 seconds.
+             *  @param      milliseconds    the timeout in milliseconds, 0 waits forever
+             */
+            virtual void        SetFetchTimeout     (uint32_t milliseconds) = 0;
+
+            /**
+             *  Sets the number of remote elements that are fetched at once when the <tt>xlink:href</tt> attributes of <tt><b>Period</b></tt> and
+             *  <tt><b>AdaptationSet</b></tt> elements are resolved. Open() and Refresh() resolve all links with <tt>xlink:actuate="onLoad"</tt>, including
+             *  those of the remote elements, and build the remote elements in place of the elements that refer to them. A link to
+             *  <tt>urn:mpeg:dash:resolve-to-zero:2013</tt> removes the element, links that cannot be resolved are kept.
+             *  Links with <tt>xlink:actuate="onRequest"</tt>, the default, are resolved by ResolveXLink().
+             *  @param      connections the number of concurrent fetches, the default is 4, 0 leaves all links unresolved
+             */
+            virtual void        SetXLinkParallelism (size_t connections) = 0;
+
+            /**
+             *  Sets how long the remote elements fetched for <tt>xlink:href</tt> attributes are cached, so that a remote element referenced by
+             *  several MPDs or by every version of a live MPD, e.g. an ad pod, is only fetched once.
+             *  @param      seconds     the time a remote element is kept, the default is 60 seconds, 0 disables the cache
+             */
+            virtual void        SetXLinkCacheTime   (uint32_t seconds) = 0;
+
+            /**
+             *  Resolves the <tt>xlink:href</tt> attribute of a <tt><b>Period</b></tt> or <tt><b>AdaptationSet</b></tt> of \em mpd regardless of its
+             *  <tt>xlink:actuate</tt> attribute, e.g. when the client reaches a Period with <tt>xlink:actuate="onRequest"</tt>. The element is deleted
+             *  and replaced by the remote elements, whose links with <tt>xlink:actuate="onLoad"</tt> are resolved as well.
+             *  @param      mpd         A pointer to a dash::mpd::IMPD object returned by Open() or OpenSnapshot()
+             *  @param      element     A pointer to a dash::mpd::IPeriod or dash::mpd::IAdaptationSet object of \em mpd
+             *  @return     true if the element has been replaced, false if it is not part of \em mpd, has no link or the remote element could not be fetched or parsed
+             */
+            virtual bool        ResolveXLink        (mpd::IMPD *mpd, mpd::IMPDElement *element) = 0;
+
             /**
              *  Frees allocated memory and deletes the DashManager
              */
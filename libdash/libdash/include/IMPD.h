@@ -37,9 +37,14 @@
 #include "IMPDElement.h"
 #include "IProgramInformation.h"
 #include "IBaseUrl.h"
+#include "IResolvedBaseUrl.h"
+#include "ISegmentEnumerator.h"
+#include "ISegmentIndex.h"
+#include "IPatchLocation.h"
 #include "IPeriod.h"
 #include "IMetrics.h"
 #include "IDASHMetrics.h"
+#include "MPDValues.h"
 
 namespace dash
 {
@@ -71,6 +76,13 @@ namespace dash
                  */
                 virtual const std::vector<std::string>&             GetLocations                    ()  const = 0;
 
+                /**
+                 *  Returns a reference to a vector of pointers to dash::mpd::IPatchLocation objects that specify locations at which MPD Patch documents
+                 *  for this version of the MPD are available. dash::IDASHManager::Refresh() fetches and applies a patch instead of the whole MPD if one is announced.
+                 *  @return     a reference to a vector of pointers to dash::mpd::IPatchLocation objects
+                 */
+                virtual const std::vector<IPatchLocation *>&        GetPatchLocations               ()  const = 0;
+
                 /**
                  *  Returns a reference to a vector of pointers to dash::mpd::IPeriod objects that specify the information of a Period.\n
                  *  For more details refer to the description in section 5.3.2. of <em>ISO/IEC 23009-1, Part 1, 2012</em>.
@@ -109,6 +121,13 @@ namespace dash
                  */
                 virtual const std::string&                          GetType                         ()  const = 0;
 
+                /**
+                 *  Returns a reference to a string that specifies the wall-clock time when the MPD was generated and published.
+                 *  An MPD Patch document can only be applied to the MPD with the \c \@publishTime it names.
+                 *  @return     a reference to a string, empty if the attribute is not present
+                 */
+                virtual const std::string&                          GetPublishTime                  ()  const = 0;
+
                 /**
                  *  Returns a reference to a string that specifies
                  *  <ul>
@@ -186,6 +205,76 @@ namespace dash
                  */
                 virtual const std::string&                          GetMaxSubsegmentDuration        ()  const = 0;
 
+                /**
+                 *  Returns a reference to a dash::mpd::DateTime that holds the date time decoded from the attribute returned by GetAvailabilityStarttime().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::DateTime
+                 */
+                virtual const DateTime&                             GetAvailabilityStarttimeValue      ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::DateTime that holds the date time decoded from the attribute returned by GetAvailabilityEndtime().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::DateTime
+                 */
+                virtual const DateTime&                             GetAvailabilityEndtimeValue        ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::DateTime that holds the date time decoded from the attribute returned by GetPublishTime().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::DateTime
+                 */
+                virtual const DateTime&                             GetPublishTimeValue                ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetMediaPresentationDuration().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetMediaPresentationDurationValue  ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetMinimumUpdatePeriod().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetMinimumUpdatePeriodValue        ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetMinBufferTime().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetMinBufferTimeValue              ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetTimeShiftBufferDepth().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetTimeShiftBufferDepthValue       ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetSuggestedPresentationDelay().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetSuggestedPresentationDelayValue ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetMaxSegmentDuration().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetMaxSegmentDurationValue         ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetMaxSubsegmentDuration().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                             GetMaxSubsegmentDurationValue      ()  const = 0;
+
                 /**
                  *  Returns a pointer to a dash::mpd::IBaseUrl that specifies the absolute path to the MPD file. \n
                  *  This absolute path is needed if there is no BaseURL specified and all other BaseURLs are relative.
@@ -200,6 +289,71 @@ namespace dash
                  *  @return     an unsigned integer
                  */
                 virtual uint32_t                                    GetFetchTime                    ()  const = 0;
+
+                /**
+                 *  Returns the entity tag the server sent with the MPD, if it has been fetched over HTTP by dash::IDASHManager.
+                 *  It is sent back with the next dash::IDASHManager::Refresh(), so an unchanged MPD is not transferred again.
+                 *  @return     a reference to a string, empty if the server did not send an \c ETag header
+                 */
+                virtual const std::string&                          GetETag                         ()  const = 0;
+
+                /**
+                 *  Returns the modification time the server sent with the MPD, if it has been fetched over HTTP by dash::IDASHManager.
+                 *  It is used like GetETag() if the server does not send entity tags.
+                 *  @return     a reference to a string holding the value of the \c Last-Modified header, empty if the server did not send it
+                 */
+                virtual const std::string&                          GetLastModified                 ()  const = 0;
+
+                /**
+                 *  Resolves a chain of <tt><b>BaseURL</b></tt> elements, e.g. the one that is passed to dash::mpd::ISegmentTemplate::GetMediaSegmentFromNumber(),
+                 *  into a single absolute base URL as specified in <em>RFC 3986</em>, section 5.2. Each element is resolved against the result of the
+                 *  elements before it. The URL returned by GetMPDPathBaseUrl() is taken as the directory of the MPD.\n
+                 *  The caller is responsible for deleting the returned object.
+                 *  @param      baseurls        the chain of base URLs, the outermost first
+                 *  @return     a pointer to a dash::mpd::IResolvedBaseUrl object
+                 */
+                virtual IResolvedBaseUrl*                           ResolveBaseUrl                  (const std::vector<IBaseUrl *>& baseurls)   const = 0;
+
+                /**
+                 *  Resolves the first <tt><b>BaseURL</b></tt> of the MPD, the Period, the AdaptationSet and the Representation against the location of the MPD.
+                 *  This should be done once per Representation, the result can be passed as the only element of the base URL vector to all methods that
+                 *  create dash::mpd::ISegment objects.\n
+                 *  The caller is responsible for deleting the returned object.
+                 *  @param      period          the Period, may be NULL
+                 *  @param      adaptationSet   the AdaptationSet, may be NULL
+                 *  @param      representation  the Representation, may be NULL
+                 *  @return     a pointer to a dash::mpd::IResolvedBaseUrl object
+                 */
+                virtual IResolvedBaseUrl*                           ResolveBaseUrl                  (IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                                                     IRepresentation *representation)   const = 0;
+
+                /**
+                 *  Creates an enumerator over the Segments of a Representation, see dash::mpd::ISegmentEnumerator. The base URL is resolved like
+                 *  ResolveBaseUrl() does, the end of the Period is taken from its \c \@duration, the start of the next Period or the
+                 *  \c \@mediaPresentationDuration.\n
+                 *  The caller is responsible for deleting the returned object, which must not be used after the MPD has been deleted or refreshed.
+                 *  @param      period          the Period of the Representation
+                 *  @param      adaptationSet   the AdaptationSet of the Representation
+                 *  @param      representation  the Representation
+                 *  @return     a pointer to a dash::mpd::ISegmentEnumerator object
+                 */
+                virtual ISegmentEnumerator*                         CreateSegmentEnumerator         (IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                                                     IRepresentation *representation)   const = 0;
+
+                /**
+                 *  Fetches the Segment Index of a Representation that consists of a single Media Segment with an \c \@indexRange, see dash::mpd::ISegmentIndex.
+                 *  The bytes of the \c \@indexRange are requested first, Segment Index boxes outside of it that are referenced by a hierarchical or
+                 *  daisy-chained index are requested afterwards. A partial response has to match the requested range, the download of a server that
+                 *  ignores the range is stopped once the requested bytes have arrived. This call blocks until the index has been received.\n
+                 *  The caller is responsible for deleting the returned object.
+                 *  @param      period          the Period of the Representation
+                 *  @param      adaptationSet   the AdaptationSet of the Representation
+                 *  @param      representation  the Representation
+                 *  @return     a pointer to a dash::mpd::ISegmentIndex object, NULL if the Representation has no index within its Media Segment
+                 *              or the index could not be fetched or parsed
+                 */
+                virtual ISegmentIndex*                              LoadSegmentIndex                (IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                                                     IRepresentation *representation)   const = 0;
         };
     }
 }
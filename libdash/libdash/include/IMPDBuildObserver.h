@@ -0,0 +1,60 @@
+/**
+ *  @class      dash::IMPDBuildObserver
+ *  @brief      This interface is needed for using the parts of an MPD while dash::IDASHManager::Open() is still building the rest of it
+ *  @details    The observer is informed as soon as an <tt><b>AdaptationSet</b></tt> or a <tt><b>Period</b></tt> has been built completely,
+ *              in document order and on the thread that calls dash::IDASHManager::Open(). A player can select a Representation and
+ *              start to download its initialization segment right away, so the time to the first request does not depend on the
+ *              size of the manifest. The objects passed to the observer are the ones of the resulting dash::mpd::IMPD, they stay valid
+ *              until it is deleted. The dash::mpd::IMPD object holds its attributes and the elements that precede the current
+ *              <tt><b>Period</b></tt> in the document, e.g. the <tt><b>BaseURL</b></tt> elements, but none of the following ones.
+ *              It must not be deleted by the observer.\n
+ *              If the Periods are converted on worker threads, see dash::IDASHManager::SetPeriodConversionThreads(), the <tt><b>AdaptationSets</b></tt> are reported
+ *              by the thread that converts their <tt><b>Period</b></tt>, as soon as each of them has been built. The calls are never
+ *              concurrent, the AdaptationSets of a <tt><b>Period</b></tt> keep their document order and precede the event of the
+ *              <tt><b>Period</b></tt>, which is still reported in document order on the thread that calls dash::IDASHManager::Open().
+ *              The AdaptationSets of different Periods may interleave, and the dash::mpd::IMPD object may neither hold the current
+ *              <tt><b>Period</b></tt> nor all of the preceding ones yet.
+ *  @see        dash::IDASHManager
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IMPDBUILDOBSERVER_H_
+#define IMPDBUILDOBSERVER_H_
+
+#include "config.h"
+
+#include "IMPD.h"
+
+namespace dash
+{
+    class IMPDBuildObserver
+    {
+        public:
+            virtual ~IMPDBuildObserver(){}
+
+            /**
+             *  Informs the dash::IMPDBuildObserver object that an <tt><b>AdaptationSet</b></tt> has been built with all of its sub elements.
+             *  @param      mpd             The dash::mpd::IMPD object that is being built
+             *  @param      period          The dash::mpd::IPeriod object the <tt><b>AdaptationSet</b></tt> belongs to, it only holds the preceding sub elements
+             *  @param      adaptationSet   The dash::mpd::IAdaptationSet object that has been built
+             */
+            virtual void OnAdaptationSetBuilt   (mpd::IMPD *mpd, mpd::IPeriod *period, mpd::IAdaptationSet *adaptationSet)  = 0;
+
+            /**
+             *  Informs the dash::IMPDBuildObserver object that a <tt><b>Period</b></tt> has been built with all of its sub elements.
+             *  It follows the events of the AdaptationSets of the <tt><b>Period</b></tt>.
+             *  @param      mpd             The dash::mpd::IMPD object that is being built
+             *  @param      period          The dash::mpd::IPeriod object that has been built
+             */
+            virtual void OnPeriodBuilt          (mpd::IMPD *mpd, mpd::IPeriod *period)                                      = 0;
+    };
+}
+
+#endif /* IMPDBUILDOBSERVER_H_ */
@@ -59,17 +59,39 @@ namespace dash
                  *  This method returns a vector of pointers to dash::xml::INode objects which correspond to additional <em>XML Elements</em> of certain
                  *  MPD elements. These <em>XML Elements</em> are not specified in <em>ISO/IEC 23009-1, Part 1, 2012</em>. \n
                  *  See the example in the class description for details.
-                 *  @return     a vector of pointers to dash::xml::INode objects
+                 *  @return     a reference to a vector of pointers to dash::xml::INode objects
                  */
-                virtual const std::vector<xml::INode *>             GetAdditionalSubNodes   ()  const = 0;
+                virtual const std::vector<xml::INode *>&            GetAdditionalSubNodes   ()  const = 0;
                 
                 /**
                  *  This method returns a map with key values and mapped values of type std::string of all <em>XML Attributes</em> of certain MPD elements. \n
                  *  Some of these <em>XML Attributes</em> are not specified in <em>ISO/IEC 23009-1, Part 1, 2012</em>. \n
-                 *  See the example in the class description for details.
-                 *  @return     a map with key values and mapped values, both of type std::string
+                 *  See the example in the class description for details. \n
+                 *  The map is built on the first call and kept along with the element. GetRawAttributeCount(), GetRawAttributeKey() and
+                 *  GetRawAttributeValue() access the same attributes in document order without building it.
+                 *  @return     a reference to a map with key values and mapped values, both of type std::string
+                 */
+                virtual const std::map<std::string, std::string>&   GetRawAttributes        ()  const = 0;
+
+                /**
+                 *  Returns the number of <em>XML Attributes</em> of this MPD element.
+                 *  @return     an unsigned integer
+                 */
+                virtual size_t                                      GetRawAttributeCount    ()  const = 0;
+
+                /**
+                 *  Returns the name of an <em>XML Attribute</em> of this MPD element.
+                 *  @param      index   the index of the attribute, which must be less than GetRawAttributeCount()
+                 *  @return     a reference to a string
+                 */
+                virtual const std::string&                          GetRawAttributeKey      (size_t index)  const = 0;
+
+                /**
+                 *  Returns the value of an <em>XML Attribute</em> of this MPD element.
+                 *  @param      index   the index of the attribute, which must be less than GetRawAttributeCount()
+                 *  @return     a reference to a string
                  */
-                virtual const std::map<std::string, std::string>    GetRawAttributes        ()  const = 0;
+                virtual const std::string&                          GetRawAttributeValue    (size_t index)  const = 0;
         };
     }
 }
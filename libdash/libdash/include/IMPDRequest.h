@@ -0,0 +1,53 @@
+/**
+ *  @class      dash::IMPDRequest
+ *  @brief      This interface is needed for waiting for and canceling an MPD that is fetched and built by dash::IDASHManager::OpenAsync()
+ *  @details    The MPD is fetched and built on a thread of its own, so the calling thread is not blocked by the transfer.
+ *              The dash::IMPDBuildObserver objects attached to the manager are informed on that thread.
+ *              Deleting the request cancels it if it has not completed yet and waits for its thread to finish.
+ *  @see        dash::IDASHManager
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IMPDREQUEST_H_
+#define IMPDREQUEST_H_
+
+#include "config.h"
+
+#include "IMPD.h"
+
+namespace dash
+{
+    class IMPDRequest
+    {
+        public:
+            virtual ~IMPDRequest(){}
+
+            /**
+             *  Blocks until the request has completed and returns the resulting MPD. The caller takes the ownership of
+             *  the dash::mpd::IMPD object, so the following calls return NULL.
+             *  @return     a pointer to an dash::mpd::IMPD object or NULL if the MPD could not be fetched or parsed or the request has been canceled
+             */
+            virtual mpd::IMPD*  Wait        () = 0;
+
+            /**
+             *  Returns whether the request has completed, i.e. whether Wait() would return without blocking.
+             *  @return     a bool value
+             */
+            virtual bool        IsCompleted () = 0;
+
+            /**
+             *  Cancels the request. A running transfer is aborted, an MPD that is already being parsed is discarded.
+             *  Has no effect if the request has completed already.
+             */
+            virtual void        Cancel      () = 0;
+    };
+}
+
+#endif /* IMPDREQUEST_H_ */
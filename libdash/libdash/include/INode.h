@@ -36,10 +36,31 @@ namespace dash
                 virtual const std::vector<INode *>&                 GetNodes            ()  const = 0;
 
                 /**
-                 *  Returns a vector of attribute names belonging to this <em>XML Element</em>
-                 *  @return     a vector of strings
+                 *  Returns a vector of attribute names belonging to this <em>XML Element</em>.
+                 *  The vector is built on the first call, see GetAttributeCount() for an access that does not build it.
+                 *  @return     a reference to a vector of strings
                  */
-                virtual std::vector<std::string>                    GetAttributeKeys    ()  const = 0;
+                virtual const std::vector<std::string>&             GetAttributeKeys    ()  const = 0;
+
+                /**
+                 *  Returns the number of <em>XML Attributes</em> of this <em>XML Element</em>
+                 *  @return     an unsigned integer
+                 */
+                virtual size_t                                      GetAttributeCount   ()  const = 0;
+
+                /**
+                 *  Returns the name of the <em>XML Attribute</em> at the given index
+                 *  @param      index   the index of the attribute, which must be less than GetAttributeCount()
+                 *  @return     a reference to a string
+                 */
+                virtual const std::string&                          GetAttributeKey     (size_t index)  const = 0;
+
+                /**
+                 *  Returns the value of the <em>XML Attribute</em> at the given index
+                 *  @param      index   the index of the attribute, which must be less than GetAttributeCount()
+                 *  @return     a reference to a string
+                 */
+                virtual const std::string&                          GetAttributeValue   (size_t index)  const = 0;
 
                 /**
                  *  Returns the name of this <em>XML Element</em>
@@ -49,12 +70,13 @@ namespace dash
 
                 /**
                  *  Returns the text contained in this <em>XML Element</em>
-                 *  @return     a string
+                 *  @return     a reference to a string
                  */
-                virtual std::string                                 GetText             ()  const = 0;
+                virtual const std::string&                          GetText             ()  const = 0;
 
                 /**
-                 *  Returns a std::map of key value / mapped value pairs corresponding to the <em>XML Attributes</em> and their values of this <em>XML Element</em>
+                 *  Returns a std::map of key value / mapped value pairs corresponding to the <em>XML Attributes</em> and their values of this <em>XML Element</em>.
+                 *  The map is built on the first call.
                  *  @return     a reference to a map with key values and mapped values, both of type std::string
                  */
                 virtual const std::map<std::string, std::string>&   GetAttributes       ()  const = 0;
@@ -76,7 +98,7 @@ namespace dash
                  *  @param      key     the name of the desired <em>XML Attribute</em>
                  *  @return     a reference to a string
                  */
-                virtual const std::string&                          GetAttributeValue   (std::string key) const = 0;
+                virtual const std::string&                          GetAttributeValue   (const std::string& key) const = 0;
 
                 /**
                  *  Returns a bool value determininig whether the <em>XML Attribute</em> name is contained in this <em>XML Element</em> or not.
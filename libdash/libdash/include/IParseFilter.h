@@ -0,0 +1,61 @@
+/**
+ *  @class      dash::IParseFilter
+ *  @brief      This interface is needed for selecting the <tt><b>Period</b></tt> and <tt><b>AdaptationSet</b></tt> elements that are built by dash::IDASHManager::Open()
+ *  @details    The parser asks the filter as soon as it has read the start tag of an element, only its attributes are known at that point.
+ *              The sub elements of a rejected element are skipped in the XML reader without being converted, so a client that is only
+ *              interested in a part of a large MPD does not pay for the rest of it. The filter is called on the thread that calls
+ *              dash::IDASHManager::Open(), even if the Periods are converted on worker threads.
+ *  @see        dash::ParseOptions dash::IDASHManager
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IPARSEFILTER_H_
+#define IPARSEFILTER_H_
+
+#include "config.h"
+
+#include "IPeriod.h"
+#include "IAdaptationSet.h"
+
+namespace dash
+{
+    class IParseFilter
+    {
+        public:
+            virtual ~IParseFilter(){}
+
+            /**
+             *  Decides whether a <tt><b>Period</b></tt> element is built.
+             *  @param      period  A dash::mpd::IPeriod object that only holds the attributes of the element, it is deleted after the call returns
+             *  @param      index   The position of the <tt><b>Period</b></tt> among all <tt><b>Period</b></tt> elements of the MPD, including the rejected ones
+             *  @return     true if the <tt><b>Period</b></tt> should be part of the MPD
+             */
+            virtual bool    AcceptPeriod        (const mpd::IPeriod *period, size_t index) = 0;
+
+            /**
+             *  Decides whether an <tt><b>AdaptationSet</b></tt> element is built. It is only called for AdaptationSets whose content type has been accepted.
+             *  @param      period          The dash::mpd::IPeriod object the <tt><b>AdaptationSet</b></tt> belongs to, it might not hold all of its sub elements yet
+             *  @param      adaptationSet   A dash::mpd::IAdaptationSet object that only holds the attributes of the element, it is deleted after the call returns
+             *  @return     true if the <tt><b>AdaptationSet</b></tt> should be part of the MPD
+             */
+            virtual bool    AcceptAdaptationSet (const mpd::IPeriod *period, const mpd::IAdaptationSet *adaptationSet) = 0;
+
+            /**
+             *  Decides whether the <tt><b>AdaptationSet</b></tt> elements of a content type are built. The content type is taken from the
+             *  \c \@contentType attribute of the <tt><b>AdaptationSet</b></tt>, or from the type of its \c \@mimeType attribute if it is missing.
+             *  AdaptationSets that declare neither attribute are only passed to AcceptAdaptationSet().
+             *  @param      contentType The content type, e.g. \c video, \c audio or \c text
+             *  @return     true if AdaptationSets of this content type should be part of the MPD
+             */
+            virtual bool    AcceptContentType   (const std::string &contentType) = 0;
+    };
+}
+
+#endif /* IPARSEFILTER_H_ */
@@ -0,0 +1,50 @@
+/**
+ *  @class      dash::mpd::IPatchLocation
+ *  @brief      This interface is needed for accessing the attributes and the content of <tt><b>PatchLocation</b></tt> elements
+ *              as specified in <em>ISO/IEC 23009-1, Part 1, 2022</em>, section 5.15
+ *  @details    A PatchLocation announces a location at which an MPD Patch document is available. A patch describes the changes between the
+ *              MPD with the same \c \@id and \c \@publishTime and its next version as add, replace and remove operations, so a client
+ *              that refreshes a live MPD only transfers the changes instead of the whole MPD.
+ *  @see        dash::mpd::IMPDElement dash::mpd::IMPD
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IPATCHLOCATION_H_
+#define IPATCHLOCATION_H_
+
+#include "config.h"
+
+#include "IMPDElement.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class IPatchLocation : public virtual IMPDElement
+        {
+            public:
+                virtual ~IPatchLocation(){}
+
+                /**
+                 *  Returns the reference to a string representing the URL of the MPD Patch document. A relative URL is resolved against the location of the MPD.
+                 *  @return     a reference to a string
+                 */
+                virtual const std::string&  GetUrl  ()  const = 0;
+
+                /**
+                 *  Returns the time in seconds after the \c \@publishTime of the MPD until which the patch location may be used.
+                 *  @return     a double value, 0 if the \c \@ttl attribute is not present, in which case the location does not expire
+                 */
+                virtual double              GetTTL  ()  const = 0;
+        };
+    }
+}
+
+#endif /* IPATCHLOCATION_H_ */
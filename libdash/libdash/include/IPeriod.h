@@ -51,6 +51,7 @@
 #include "ISegmentTemplate.h"
 #include "IAdaptationSet.h"
 #include "ISubset.h"
+#include "MPDValues.h"
 
 namespace dash
 {
@@ -142,6 +143,20 @@ namespace dash
                  */
                 virtual const std::string&                      GetDuration             ()  const = 0;
 
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the \em PeriodStart time decoded from the attribute returned by GetStart().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                         GetStartValue           ()  const = 0;
+
+                /**
+                 *  Returns a reference to a dash::mpd::Duration that holds the duration decoded from the attribute returned by GetDuration().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::Duration
+                 */
+                virtual const Duration&                         GetDurationValue        ()  const = 0;
+
                 /**
                  *  When set to \c 'true', this is equivalent as if the <tt><b>AdaptationSet</b>\@bitstreamSwitching</tt> for each Adaptation Set contained in this Period is set to \c 'true'.
                  *  In this case, the <tt><b>AdaptationSet</b>\@bitstreamSwitching</tt> attribute shall not be set to \c 'false' for any Adaptation Set in this Period.
@@ -0,0 +1,84 @@
+/**
+ *  @class      dash::mpd::IRefreshReport
+ *  @brief      This interface is needed for finding out which parts of a dash::mpd::IMPD have been changed by dash::IDASHManager::Refresh()
+ *  @details    A refresh merges a newly retrieved version of a dynamic MPD into the existing object graph.
+ *              <tt><b>Period</b></tt>, <tt><b>AdaptationSet</b></tt> and <tt><b>Representation</b></tt> elements are matched by their \c \@id attribute
+ *              (or by their position if it is missing). Matched elements keep their pointers, their attributes are updated in place
+ *              and new <tt><b>S</b></tt> elements are appended to the existing <tt><b>SegmentTimeline</b></tt>.
+ *              Elements that are no longer present in the MPD are deleted, so pointers to them must not be used after the refresh.
+ *  @see        dash::IDASHManager dash::mpd::IMPDElement
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IREFRESHREPORT_H_
+#define IREFRESHREPORT_H_
+
+#include "config.h"
+
+#include "IMPDElement.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class IRefreshReport
+        {
+            public:
+                virtual ~IRefreshReport(){}
+
+                /**
+                 *  Returns whether the refresh changed anything in the MPD.
+                 *  @return     a bool value
+                 */
+                virtual bool                                HasChanges                  ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the elements which have been inserted into the MPD,
+                 *  e.g. new <tt><b>Period</b></tt>, <tt><b>AdaptationSet</b></tt> or <tt><b>Representation</b></tt> elements.
+                 *  @return     a reference to a vector of pointers to dash::mpd::IMPDElement objects
+                 */
+                virtual const std::vector<IMPDElement *>&   GetAddedElements            ()  const = 0;
+
+                /**
+                 *  Returns a reference to a vector of pointers to the elements which have been kept but whose attributes or sub elements have changed.
+                 *  A <tt><b>SegmentTimeline</b></tt> is listed here if <tt><b>S</b></tt> elements have been appended, removed or changed.
+                 *  @return     a reference to a vector of pointers to dash::mpd::IMPDElement objects
+                 */
+                virtual const std::vector<IMPDElement *>&   GetUpdatedElements          ()  const = 0;
+
+                /**
+                 *  Returns the number of elements that have been removed from the MPD and deleted.
+                 *  @return     an unsigned integer
+                 */
+                virtual uint32_t                            GetRemovedElements          ()  const = 0;
+
+                /**
+                 *  Returns the number of <tt><b>S</b></tt> elements that have been appended to existing <tt><b>SegmentTimeline</b></tt> elements.
+                 *  @return     an unsigned integer
+                 */
+                virtual uint32_t                            GetAppendedTimelineEntries  ()  const = 0;
+
+                /**
+                 *  Returns the number of <tt><b>S</b></tt> elements that have been removed from existing <tt><b>SegmentTimeline</b></tt> elements.
+                 *  @return     an unsigned integer
+                 */
+                virtual uint32_t                            GetRemovedTimelineEntries   ()  const = 0;
+
+                /**
+                 *  Returns whether the server answered that the MPD has not been modified since it has been fetched, see dash::mpd::IMPD::GetETag().
+                 *  The MPD has not been transferred and parsed again in that case, only its fetch time has been updated.
+                 *  @return     a bool value
+                 */
+                virtual bool                                IsNotModified               ()  const = 0;
+        };
+    }
+}
+
+#endif /* IREFRESHREPORT_H_ */
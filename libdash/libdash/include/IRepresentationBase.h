@@ -21,6 +21,7 @@
 
 #include "IMPDElement.h"
 #include "IDescriptor.h"
+#include "MPDValues.h"
 
 namespace dash
 {
@@ -82,38 +83,45 @@ namespace dash
                 virtual uint32_t                            GetHeight                       () const = 0;
 
                 /**
-                 *  Returns a string that specifies the sample aspect ratio of the video media component type, 
+                 *  Returns a reference to a string that specifies the sample aspect ratio of the video media component type, 
                  *  in the form of a string consisting of two integers separated by ':', e.g., \"10:11\". 
                  *  The first number specifies the horizontal size of the encoded video pixels (samples) in arbitrary units. 
                  *  The second number specifies the vertical size of the encoded video pixels (samples) in same units as the horizontal size.
-                 *  @return     a string
+                 *  @return     a reference to a string
                  */
-                virtual std::string                         GetSar                          () const = 0;
+                virtual const std::string&                  GetSar                          () const = 0;
 
                 /**
-                 *  Returns a string that specifies the output frame rate (or in the case of interlaced, half the output field rate) 
+                 *  Returns a reference to a string that specifies the output frame rate (or in the case of interlaced, half the output field rate) 
                  *  of the video media type in the Representation. If the frame or field rate is varying, the value is the average frame 
                  *  or half the average field rate field rate over the entire duration of the Representation.\n
                  *  The value is coded as a string, either containing two integers separated by a \"/\", (\"F/D\"), or a single integer \"F\".
                  *  The frame rate is the division F/D, or F, respectively, per second (i.e. the default value of D is \"1\").
-                 *  @return     a string
+                 *  @return     a reference to a string
                  */
-                virtual std::string                         GetFrameRate                    () const = 0;
+                virtual const std::string&                  GetFrameRate                    () const = 0;
 
                 /**
-                 *  Returns a string that represents an audio sampling rate. \n
+                 *  Returns a reference to a dash::mpd::FrameRate that holds the frame rate decoded from the attribute returned by GetFrameRate().
+                 *  The value is not valid if the attribute is not present or malformed.
+                 *  @return     a reference to a dash::mpd::FrameRate
+                 */
+                virtual const FrameRate&                    GetFrameRateValue               () const = 0;
+
+                /**
+                 *  Returns a reference to a string that represents an audio sampling rate. \n
                  *  Either a single decimal integer value specifying the sampling rate or a whitespace separated pair of decimal integer 
                  *  values specifying the minimum and maximum sampling rate of the audio media component type. The values are in samples per second.
-                 *  @return     a string
+                 *  @return     a reference to a string
                  */
-                virtual std::string                         GetAudioSamplingRate            () const = 0;
+                virtual const std::string&                  GetAudioSamplingRate            () const = 0;
 
                 /**
-                 *  Returns a string that specifies the MIME type of the concatenation of the Initialization Segment, if present, 
+                 *  Returns a reference to a string that specifies the MIME type of the concatenation of the Initialization Segment, if present, 
                  *  and all consecutive Media Segments in the Representation.
-                 *  @return     a string
+                 *  @return     a reference to a string
                  */
-                virtual std::string                         GetMimeType                     () const = 0;
+                virtual const std::string&                  GetMimeType                     () const = 0;
 
                 /**
                  *  Returns a reference to a vector of strings that specifies the profiles of Segments that are essential to process the Representation. 
@@ -168,11 +176,11 @@ namespace dash
                 virtual bool                                HasCodingDependency             () const = 0;
 
                 /**
-                 *  Returns a string that specifies the scan type of the source material of the video media component type. 
+                 *  Returns a reference to a string that specifies the scan type of the source material of the video media component type. 
                  *  The value may be equal to one of \c \"progressive\", \c \"interlaced\" and \c \"unknown\".
-                 *  @return     a string
+                 *  @return     a reference to a string
                  */
-                virtual std::string                         GetScanType                     () const = 0;
+                virtual const std::string&                  GetScanType                     () const = 0;
 
         };
     }
@@ -0,0 +1,89 @@
+/**
+ *  @class      dash::mpd::IResolvedBaseUrl
+ *  @brief      This interface is needed for accessing an absolute base URL that has been resolved from the <tt><b>BaseURL</b></tt> elements of an MPD
+ *  @details    The <tt><b>BaseURL</b></tt> elements of the MPD, a Period, an AdaptationSet and a Representation are resolved against each other and against the
+ *              location of the MPD once, following the reference resolution of <em>RFC 3986</em>, section 5. The result is kept split into its scheme, host,
+ *              port and path.\n
+ *              A resolved base URL that is passed as the only element of the base URL vector to the methods that create dash::mpd::ISegment objects, e.g.
+ *              dash::mpd::ISegmentTemplate::GetMediaSegmentFromNumber(), only resolves the relative part of each Segment URL instead of combining and
+ *              parsing the whole chain again for every Segment.
+ *  @see        dash::mpd::IBaseUrl dash::mpd::IMPD::ResolveBaseUrl()
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef IRESOLVEDBASEURL_H_
+#define IRESOLVEDBASEURL_H_
+
+#include "config.h"
+
+#include "IBaseUrl.h"
+#include "IHTTPTransaction.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class IResolvedBaseUrl : public virtual IBaseUrl
+        {
+            public:
+                virtual ~IResolvedBaseUrl(){}
+
+                /**
+                 *  Returns the reference to a string representing the scheme of the URL in lower case, e.g. \em http.
+                 *  @return     a reference to a string, empty if the MPD has been opened from a local path and no <tt><b>BaseURL</b></tt> is absolute
+                 */
+                virtual const std::string&  GetScheme       ()  const = 0;
+
+                /**
+                 *  Returns the reference to a string representing the host of the URL in lower case, without user information and port.
+                 *  @return     a reference to a string
+                 */
+                virtual const std::string&  GetHost         ()  const = 0;
+
+                /**
+                 *  Returns the port of the URL. If the URL does not contain a port, the default port of the scheme is returned.
+                 *  @return     the port, 0 if the URL has neither a port nor a scheme with a known default port
+                 */
+                virtual size_t              GetPort         ()  const = 0;
+
+                /**
+                 *  Returns the reference to a string representing the path of the URL, including its query.
+                 *  @return     a reference to a string
+                 */
+                virtual const std::string&  GetPath         ()  const = 0;
+
+                /**
+                 *  Returns the reference to a string of the form <em>scheme://host:port</em>. All Segments whose URLs have the same origin can be requested over
+                 *  the same connection, so it can be used as the key of a connection pool.
+                 *  @return     a reference to a string, empty if the URL has no host
+                 */
+                virtual const std::string&  GetOrigin       ()  const = 0;
+
+                /**
+                 *  Resolves a URL reference, e.g. the \c \@media attribute of a <tt><b>SegmentURL</b></tt>, against this base URL as specified in
+                 *  <em>RFC 3986</em>, section 5.2.
+                 *  @param      reference   a relative or an absolute URL
+                 *  @return     the resolved URL
+                 */
+                virtual std::string         Resolve         (const std::string& reference)  const = 0;
+
+                /**
+                 *  Returns a pointer to a dash::mpd::ISegment object for the given URL reference, which is resolved against this base URL.
+                 *  @param      uri         a relative or an absolute URL, an empty string refers to the base URL itself
+                 *  @param      range       a byte range of the form <em>first-last</em>, or an empty string
+                 *  @param      type        the type of the Segment
+                 *  @return     a pointer to a dash::mpd::ISegment object, NULL if the resolved URL is not an HTTP URL
+                 */
+                virtual ISegment*           ToSegment       (const std::string& uri, const std::string& range, dash::metrics::HTTPTransactionType type)    const = 0;
+        };
+    }
+}
+
+#endif /* IRESOLVEDBASEURL_H_ */
@@ -0,0 +1,78 @@
+/**
+ *  @class      dash::mpd::ISegmentEnumerator
+ *  @brief      This interface is needed for listing the Segments of a <tt><b>Representation</b></tt> without creating a dash::mpd::ISegment for each of them
+ *  @details    The enumerator covers all ways of addressing Segments that are specified in <em>ISO/IEC 23009-1, Part 1, 2012</em>, section 5.3.9:
+ *              <tt><b>SegmentBase</b></tt>, <tt><b>SegmentList</b></tt> and <tt><b>SegmentTemplate</b></tt>, the latter either by \c \@duration and
+ *              \c $Number$ or by its <tt><b>SegmentTimeline</b></tt>. The segment information is taken from the Representation, the AdaptationSet or the Period,
+ *              in this order, and the URLs are resolved against the <tt><b>BaseURL</b></tt> elements of all levels once.\n
+ *              The Initialization Segment is listed first, followed by the Bitstream Switching Segment and the Media Segments, each Index Segment is listed right
+ *              before the Media Segment it indexes. Each Segment is described by a dash::mpd::SegmentDescriptor, which is only turned into a downloadable
+ *              dash::mpd::ISegment by ToSegment().\n
+ *              The end of the Media Segments of a <tt><b>SegmentTemplate</b></tt> without <tt><b>SegmentTimeline</b></tt> is derived from the duration of the Period.
+ *              If it is not known, e.g. for a live stream, the enumerator does not end, see IsOpenEnded().
+ *  @see        dash::mpd::SegmentDescriptor dash::mpd::IMPD::CreateSegmentEnumerator()
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef ISEGMENTENUMERATOR_H_
+#define ISEGMENTENUMERATOR_H_
+
+#include "config.h"
+
+#include "ISegment.h"
+#include "SegmentDescriptor.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class ISegmentEnumerator
+        {
+            public:
+                virtual ~ISegmentEnumerator(){}
+
+                /**
+                 *  Describes the next Segment. The strings of the descriptor are reused, so passing the same descriptor to every call
+                 *  does not allocate memory once its URL has grown to the longest URL.
+                 *  @param      descriptor  the descriptor that is filled with the address and timing of the Segment
+                 *  @return     true if a Segment has been described, false if all Segments have been enumerated
+                 */
+                virtual bool        Next                    (SegmentDescriptor& descriptor) = 0;
+
+                /**
+                 *  Restarts the enumeration with the first Segment.
+                 */
+                virtual void        Reset                   () = 0;
+
+                /**
+                 *  Returns the number of Media Segments of the Representation.
+                 *  @return     an unsigned integer, 0 if IsOpenEnded() returns true
+                 */
+                virtual uint64_t    GetMediaSegmentCount    ()  const = 0;
+
+                /**
+                 *  Returns whether the number of Media Segments is unknown, because the Representation uses a <tt><b>SegmentTemplate</b></tt>
+                 *  without <tt><b>SegmentTimeline</b></tt> and the duration of the Period is not known. Next() never returns false in that case.
+                 *  @return     a bool value
+                 */
+                virtual bool        IsOpenEnded             ()  const = 0;
+
+                /**
+                 *  Creates a downloadable Segment for a descriptor that has been filled by this enumerator.\n
+                 *  The caller is responsible for deleting the returned object.
+                 *  @param      descriptor  a descriptor filled by Next()
+                 *  @return     a pointer to a dash::mpd::ISegment object, NULL if the URL of the descriptor is not an HTTP URL
+                 */
+                virtual ISegment*   ToSegment               (const SegmentDescriptor& descriptor)   const = 0;
+        };
+    }
+}
+
+#endif /* ISEGMENTENUMERATOR_H_ */
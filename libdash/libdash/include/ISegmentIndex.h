@@ -0,0 +1,83 @@
+/**
+ *  @class      dash::mpd::ISegmentIndex
+ *  @brief      This interface is needed for addressing the Subsegments of a <tt><b>Representation</b></tt> that consists of a single Media Segment
+ *  @details    The index is read from the Segment Index boxes (<tt>sidx</tt>) that are specified in <em>ISO/IEC 14496-12</em> and
+ *              <em>ISO/IEC 23009-1, Part 1, 2012</em>, section 6.3.4.3, and that are located in the \c \@indexRange of the Media Segment.
+ *              Hierarchical and daisy-chained indexes are followed, so the Subsegments are the leaves of the index in presentation order.
+ *              Each Subsegment is a byte range of the Media Segment that can be requested on its own, which allows to start, seek and
+ *              switch within a Representation whose Media Segment spans the whole Period.
+ *  @see        dash::mpd::IMPD::LoadSegmentIndex() dash::mpd::SegmentDescriptor
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef ISEGMENTINDEX_H_
+#define ISEGMENTINDEX_H_
+
+#include "config.h"
+
+#include "ISegment.h"
+#include "SegmentDescriptor.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class ISegmentIndex
+        {
+            public:
+                virtual ~ISegmentIndex(){}
+
+                /**
+                 *  Returns the timescale of the index, i.e. the timescale of the media stream the index refers to.
+                 *  @return     an unsigned integer
+                 */
+                virtual uint32_t    GetTimescale                    ()  const = 0;
+
+                /**
+                 *  Returns the earliest presentation time of the first Subsegment in units of GetTimescale() on the media timeline.
+                 *  @return     an unsigned integer
+                 */
+                virtual uint64_t    GetEarliestPresentationTime     ()  const = 0;
+
+                /**
+                 *  Returns the number of Subsegments.
+                 *  @return     an unsigned integer
+                 */
+                virtual size_t      GetSubsegmentCount              ()  const = 0;
+
+                /**
+                 *  Describes a Subsegment. The descriptor carries the URL of the Media Segment, the byte range of the Subsegment and its
+                 *  times in units of GetTimescale(). \c number is the index of the Subsegment.
+                 *  @param      index       the index of the Subsegment, starting with 0
+                 *  @param      descriptor  the descriptor that is filled
+                 *  @return     true if the index refers to a Subsegment, false otherwise
+                 */
+                virtual bool        GetSubsegment                   (size_t index, SegmentDescriptor& descriptor)   const = 0;
+
+                /**
+                 *  Finds the Subsegment that contains the given time. A time before the first Subsegment refers to the first one.
+                 *  @param      time        a time in units of GetTimescale() on the media timeline, i.e. including the \c \@presentationTimeOffset
+                 *  @param      index       the index of the Subsegment
+                 *  @return     true if a Subsegment has been found, false if the time lies after the last Subsegment
+                 */
+                virtual bool        FindSubsegment                  (uint64_t time, size_t& index)  const = 0;
+
+                /**
+                 *  Returns a downloadable Segment that requests the byte range of a Subsegment.\n
+                 *  The caller is responsible for deleting the returned object.
+                 *  @param      index       the index of the Subsegment, starting with 0
+                 *  @return     a pointer to a dash::mpd::ISegment object, NULL if there is no such Subsegment or the URL is not an HTTP URL
+                 */
+                virtual ISegment*   ToSegment                       (size_t index)  const = 0;
+        };
+    }
+}
+
+#endif /* ISEGMENTINDEX_H_ */
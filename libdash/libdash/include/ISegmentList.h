@@ -39,6 +39,21 @@ namespace dash
                  */
                 virtual const std::vector<ISegmentURL *>&   GetSegmentURLs  ()  const = 0;
 
+                /**
+                 *  Returns the number of <tt><b>SegmentURL</b></tt> elements contained in this SegmentList.
+                 *  Unlike GetSegmentURLs() this does not create the dash::mpd::ISegmentURL objects.
+                 *  @return     the number of <tt><b>SegmentURL</b></tt> elements
+                 */
+                virtual size_t                              GetSegmentURLCount  ()  const = 0;
+
+                /**
+                 *  Returns a pointer to the dash::mpd::ISegmentURL object at position \em index. SegmentURLs are stored in a compact form,
+                 *  only the requested object is created. It stays valid as long as this SegmentList.
+                 *  @param      index   The position of the <tt><b>SegmentURL</b></tt> element, starting at 0
+                 *  @return     a pointer to a dash::mpd::ISegmentURL object or NULL if \em index is out of range
+                 */
+                virtual ISegmentURL*                        GetSegmentURL       (size_t index)  const = 0;
+
                 /**
                  *  Returns a reference to a string that specifies a reference to an external <tt><b>SegmentList</b></tt> element.
                  *  @return     a reference to a string
@@ -122,11 +122,11 @@ namespace dash
                  *  @param      bandwidth           an integer specifying the bandwidth that will replace the identifier \em \$Bandwidth\$ in the Media template.
                  *                                  This integer will be formated according to a possibly contained format tag in the \em \$Bandwidth\$ identifier.\n
                  *                                  \b NOTE:    If there is no identifier \em \$bandwidth\$ in the template then this parameter will not be used and can be set to 0.
-                 *  @param      time                an integer corresponding to the <tt><b>SegmentTimeline</b>\@t</tt> attribute that will replace the identifier \em \$Time\$ in the Media template. 
+                 *  @param      time                a 64-bit integer corresponding to the <tt><b>SegmentTimeline</b>\@t</tt> attribute that will replace the identifier \em \$Time\$ in the Media template. 
                  *                                  This integer will be formated according to a possibly contained format tag in the \em \$Time\$ identifier.
                  *  @return     a pointer to a dash::mpd::ISegment object
                  */
-                virtual ISegment*           GetMediaSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const = 0;
+                virtual ISegment*           GetMediaSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const = 0;
 
                 /**
                  *  Returns a pointer to a dash::mpd::ISegment object that represents a Index Segment and can be downloaded.
@@ -136,11 +136,55 @@ namespace dash
                  *  @param      bandwidth           an integer specifying the bandwidth that will replace the identifier \em \$Bandwidth\$ in the Index template.
                  *                                  This integer will be formated according to a possibly contained format tag in the \em \$Bandwidth\$ identifier.\n
                  *                                  \b NOTE:    If there is no identifier \em \$bandwidth\$ in the template then this parameter will not be used and can be set to 0.
-                 *  @param      time                an integer corresponding to the <tt><b>SegmentTimeline</b>\@t</tt> attribute that will replace the identifier \em \$Time\$ in the Index template. 
+                 *  @param      time                a 64-bit integer corresponding to the <tt><b>SegmentTimeline</b>\@t</tt> attribute that will replace the identifier \em \$Time\$ in the Index template. 
                  *                                  This integer will be formated according to a possibly contained format tag in the \em \$Time\$ identifier.
                  *  @return     a pointer to a dash::mpd::ISegment object
                  */
-                virtual ISegment*           GetIndexSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const = 0;
+                virtual ISegment*           GetIndexSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const = 0;
+
+                /**
+                 *  Writes the URL that the Media template yields for the given parameters into a buffer of the caller, without resolving it against any base URL.
+                 *  The template is compiled once when it is set, so no memory is allocated as long as the buffer is large enough.
+                 *  Like \c snprintf the URL is truncated to <tt>size - 1</tt> characters and always terminated by a null character if \p size is not 0.
+                 *  @param      buffer              the buffer that receives the URL
+                 *  @param      size                the size of the buffer in bytes
+                 *  @param      representationID    a string containing the representation ID that will replace the identifier \em \$RepresentationID\$ in the Media template.
+                 *  @param      bandwidth           an integer specifying the bandwidth that will replace the identifier \em \$Bandwidth\$ in the Media template.
+                 *  @param      number              an integer specifying the Segment number that will replace the identifier \em \$Number\$ in the Media template.
+                 *  @param      time                a 64-bit integer that will replace the identifier \em \$Time\$ in the Media template.
+                 *  @return     the length of the complete URL, which is not smaller than \p size if the URL has been truncated
+                 */
+                virtual size_t              FormatMediaUrl              (char *buffer, size_t size, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint64_t time) const = 0;
+
+                /**
+                 *  Renders the URLs of the Media Segments with the numbers \p firstNumber to <tt>firstNumber + count - 1</tt> in one call, without resolving them against any base URL.
+                 *  The time that replaces the identifier \em \$Time\$ is taken from the <tt><b>SegmentTimeline</b></tt> if there is one, and is
+                 *  <tt>(number - \@startNumber) * \@duration</tt> otherwise. Numbers beyond the end of the <tt><b>SegmentTimeline</b></tt> are not rendered.
+                 *  @param      representationID    a string containing the representation ID that will replace the identifier \em \$RepresentationID\$ in the Media template.
+                 *  @param      bandwidth           an integer specifying the bandwidth that will replace the identifier \em \$Bandwidth\$ in the Media template.
+                 *  @param      firstNumber         the number of the first Segment
+                 *  @param      count               the number of Segments
+                 *  @param      urls                a string the URLs are appended to, each one terminated by a null character
+                 *  @param      offsets             a vector that receives the offset of each appended URL within \p urls
+                 *  @return     the number of URLs that have been rendered
+                 */
+                virtual size_t              FormatMediaUrlsFromNumber   (const std::string& representationID, uint32_t bandwidth, uint32_t firstNumber, uint32_t count,
+                                                                         std::string& urls, std::vector<size_t>& offsets) const = 0;
+
+                /**
+                 *  Renders the URLs of all Media Segments that overlap the time range from \p startTime to \p endTime in one call, without resolving them against any base URL.
+                 *  The Segments are taken from the <tt><b>SegmentTimeline</b></tt> if there is one, otherwise each Segment lasts \c \@duration and the Segment with the
+                 *  number \c \@startNumber starts at 0. An open ended <tt><b>SegmentTimeline</b></tt> is rendered up to \p endTime.
+                 *  @param      representationID    a string containing the representation ID that will replace the identifier \em \$RepresentationID\$ in the Media template.
+                 *  @param      bandwidth           an integer specifying the bandwidth that will replace the identifier \em \$Bandwidth\$ in the Media template.
+                 *  @param      startTime           the start of the range in units of the \c \@timescale, on the same timeline as the <tt><b>S</b>\@t</tt> attributes
+                 *  @param      endTime             the end of the range, which is not part of it
+                 *  @param      urls                a string the URLs are appended to, each one terminated by a null character
+                 *  @param      offsets             a vector that receives the offset of each appended URL within \p urls
+                 *  @return     the number of URLs that have been rendered
+                 */
+                virtual size_t              FormatMediaUrlsFromTime     (const std::string& representationID, uint32_t bandwidth, uint64_t startTime, uint64_t endTime,
+                                                                         std::string& urls, std::vector<size_t>& offsets) const = 0;
         };
     }
 }
@@ -42,7 +42,34 @@ namespace dash
                  *  Returns a reference to a vector of pointers to dash::mpd::ITimeline objects, that correspond to the to <b><tt>S</tt></b> elements.
                  *  @return     a reference to vector of pointers to dash::mpd::ITimeline objects
                  */
-                virtual std::vector<ITimeline *>&   GetTimelines ()  const = 0;
+                virtual std::vector<ITimeline *>&   GetTimelines    ()  const = 0;
+
+                /**
+                 *  Returns the number of Segments described by the <b><tt>S</tt></b> elements. The repeat counts are not expanded, the count is
+                 *  derived from one entry per <b><tt>S</tt></b> element.\n
+                 *  If the last <b><tt>S</tt></b> element has a repeat count of -1 its Segments continue up to \p endTime.
+                 *  @param      endTime     the end of the Period, in units of the \c \@timescale and on the same timeline as the \c \@t attributes
+                 *  @return     the number of Segments
+                 */
+                virtual uint64_t                    GetSegmentCount (uint64_t endTime)  const = 0;
+
+                /**
+                 *  Looks up the Segment with the given zero-based number in O(log n) of the number of <b><tt>S</tt></b> elements.
+                 *  @param      index       the zero-based number of the Segment within the timeline
+                 *  @param      startTime   receives the earliest presentation time of the Segment, in units of the \c \@timescale
+                 *  @param      duration    receives the duration of the Segment, in units of the \c \@timescale
+                 *  @return     false if the timeline does not contain a Segment with the given number
+                 */
+                virtual bool                        GetSegment      (uint64_t index, uint64_t &startTime, uint64_t &duration) const = 0;
+
+                /**
+                 *  Looks up the Segment that contains the given time in O(log n) of the number of <b><tt>S</tt></b> elements.
+                 *  Times before the first Segment map to the first Segment, times within a discontinuity map to the Segment that follows it.
+                 *  @param      time        a time in units of the \c \@timescale, on the same timeline as the \c \@t attributes
+                 *  @param      index       receives the zero-based number of the Segment
+                 *  @return     false if the time lies after the last Segment of the timeline
+                 */
+                virtual bool                        GetSegmentIndex (uint64_t time, uint64_t &index)  const = 0;
         };
     }
 }
@@ -0,0 +1,93 @@
+/**
+ *  MPDValues.h
+ *
+ *  @brief      Typed values of the MPD attributes that are coded as durations, date times and frame rates
+ *  @details    The values are decoded once when the MPD is parsed, so clients do not need to parse the strings of the
+ *              corresponding attributes again. Durations and date times are counted in ticks of 1/TicksPerSecond seconds.
+ *              A value is only valid if the attribute is present and could be decoded, the string getters of the attributes
+ *              return the original text in any case.
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef MPDVALUES_H_
+#define MPDVALUES_H_
+
+#include "config.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /**
+         *  The number of ticks per second of dash::mpd::Duration and dash::mpd::DateTime.
+         */
+        const int64_t TicksPerSecond = 1000000;
+
+        /**
+         *  @struct     dash::mpd::Duration
+         *  @brief      A value of type \c xs:duration, e.g. \c PT1H2M3.5S or \c P1DT12H.
+         *  @details    Years are counted as 365 days and months as 30 days, the duration of a negative value such as \c -PT10S is negative.
+         */
+        struct Duration
+        {
+            Duration () : ticks(0), isValid(false) {}
+
+            /**
+             *  Returns the duration in seconds.
+             *  @return     a double value
+             */
+            double  GetSeconds  ()  const { return (double) this->ticks / TicksPerSecond; }
+
+            int64_t ticks;
+            bool    isValid;
+        };
+
+        /**
+         *  @struct     dash::mpd::DateTime
+         *  @brief      A value of type \c xs:dateTime, e.g. \c 2013-04-12T10:30:00Z.
+         *  @details    The value counts the ticks since 1970-01-01T00:00:00Z. A time zone offset is taken into account,
+         *              a value without a time zone is interpreted as UTC.
+         */
+        struct DateTime
+        {
+            DateTime () : ticks(0), isValid(false) {}
+
+            /**
+             *  Returns the number of whole seconds since 1970-01-01T00:00:00Z.
+             *  @return     a 64-bit integer
+             */
+            int64_t GetEpochSeconds ()  const { return this->ticks >= 0 ? this->ticks / TicksPerSecond : -((-this->ticks + TicksPerSecond - 1) / TicksPerSecond); }
+
+            int64_t ticks;
+            bool    isValid;
+        };
+
+        /**
+         *  @struct     dash::mpd::FrameRate
+         *  @brief      A frame rate coded as \c F/D or \c F, e.g. \c 30000/1001 or \c 25.
+         */
+        struct FrameRate
+        {
+            FrameRate () : numerator(0), denominator(1), isValid(false) {}
+
+            /**
+             *  Returns the frame rate in frames per second.
+             *  @return     a double value
+             */
+            double  GetFramesPerSecond  ()  const { return (double) this->numerator / this->denominator; }
+
+            uint32_t    numerator;
+            uint32_t    denominator;
+            bool        isValid;
+        };
+    }
+}
+
+#endif /* MPDVALUES_H_ */
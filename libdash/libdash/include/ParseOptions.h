@@ -0,0 +1,54 @@
+/**
+ *  ParseOptions.h
+ *
+ *  @brief      Options that control which parts of an MPD are built by dash::IDASHManager::Open() and dash::IDASHManager::Refresh()
+ *  @details    By default every element is converted and keeps its attributes and unknown sub elements, which is what the
+ *              overloads without options do. Elements that are left out are skipped in the XML reader without being converted.
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef PARSEOPTIONS_H_
+#define PARSEOPTIONS_H_
+
+#include "config.h"
+
+#include "IParseFilter.h"
+
+namespace dash
+{
+    /**
+     *  @struct     dash::ParseOptions
+     *  @brief      The options of a single call to dash::IDASHManager::Open() or dash::IDASHManager::Refresh().
+     */
+    struct ParseOptions
+    {
+        ParseOptions () : filter(NULL), keepAdditionalSubNodes(true), keepRawAttributes(true) {}
+
+        /**
+         *  Selects the <tt><b>Period</b></tt> and <tt><b>AdaptationSet</b></tt> elements that are built, NULL builds all of them.
+         *  The filter is owned by the caller and only used during the call.
+         */
+        IParseFilter    *filter;
+
+        /**
+         *  If false, elements that are not part of the MPD schema known to the library, e.g. vendor extensions or the
+         *  children of <tt><b>ContentProtection</b></tt>, are skipped instead of being kept as additional sub nodes.
+         */
+        bool            keepAdditionalSubNodes;
+
+        /**
+         *  If false, the elements do not keep a copy of their attributes for dash::mpd::IMPDElement::GetRawAttributes(),
+         *  the attributes are only available through the typed getters. Such an MPD cannot be written by dash::IDASHManager::WriteSnapshot().
+         */
+        bool            keepRawAttributes;
+    };
+}
+
+#endif /* PARSEOPTIONS_H_ */
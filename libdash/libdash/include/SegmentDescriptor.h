@@ -0,0 +1,68 @@
+/**
+ *  SegmentDescriptor.h
+ *
+ *  @brief      The address and timing of a Segment as a plain value
+ *  @details    A descriptor is filled by dash::mpd::ISegmentEnumerator for every Segment of a Representation. It holds no
+ *              resources, so a large number of Segments can be described, stored and compared without creating a
+ *              downloadable dash::mpd::ISegment for each of them. dash::mpd::ISegmentEnumerator::ToSegment() creates the
+ *              dash::mpd::ISegment for a descriptor when it is actually downloaded.
+ *
+ *  @author     bitmovin Softwareentwicklung OG \n
+ *              Email: libdash-dev@vicky.bitmovin.net
+ *  @version    2.1
+ *  @date       2013
+ *  @copyright  bitmovin Softwareentwicklung OG, All Rights Reserved \n\n
+ *              This source code and its use and distribution, is subject to the terms
+ *              and conditions of the applicable license agreement.
+ */
+
+#ifndef SEGMENTDESCRIPTOR_H_
+#define SEGMENTDESCRIPTOR_H_
+
+#include "config.h"
+
+#include "IHTTPTransaction.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /**
+         *  @struct     dash::mpd::SegmentDescriptor
+         *  @brief      The absolute URL, the byte range, the type and the position in the media timeline of a Segment.
+         *  @details    Times are counted in units of \c timescale on the media timeline, i.e. \c startTime is the value that is
+         *              substituted for \c $Time$ and includes the \c \@presentationTimeOffset. Initialization and Bitstream
+         *              Switching Segments start with the Period and have a duration of 0, an Index Segment has the times of the Media Segment it indexes.
+         */
+        struct SegmentDescriptor
+        {
+            SegmentDescriptor () : firstByte(0), lastByte(0), hasByteRange(false), type(dash::metrics::MediaSegment), number(0),
+                                   startTime(0), duration(0), timescale(1), presentationTimeOffset(0) {}
+
+            /**
+             *  Returns the start of the Segment in seconds relative to the start of its Period.
+             *  @return     a double value
+             */
+            double  GetStartSeconds     ()  const { return ((double) this->startTime - (double) this->presentationTimeOffset) / this->timescale; }
+
+            /**
+             *  Returns the duration of the Segment in seconds.
+             *  @return     a double value
+             */
+            double  GetDurationSeconds  ()  const { return (double) this->duration / this->timescale; }
+
+            std::string                         url;
+            uint64_t                            firstByte;
+            uint64_t                            lastByte;
+            bool                                hasByteRange;
+            dash::metrics::HTTPTransactionType  type;
+            uint64_t                            number;
+            uint64_t                            startTime;
+            uint64_t                            duration;
+            uint32_t                            timescale;
+            uint64_t                            presentationTimeOffset;
+        };
+    }
+}
+
+#endif /* SEGMENTDESCRIPTOR_H_ */
@@ -33,5 +33,6 @@
 #include <iostream>
 #include <cstdlib>
 #include <string.h>
+#include <algorithm>
 
 #endif /* CONFIG_H_ */
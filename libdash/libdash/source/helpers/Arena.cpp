@@ -0,0 +1,147 @@
+/*
+ * Arena.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "Arena.h"
+
+using namespace dash::helpers;
+
+#define ARENA_ALIGNMENT     16
+#define ARENA_ALIGN(size)   (((size) + ARENA_ALIGNMENT - 1) & ~((size_t) ARENA_ALIGNMENT - 1))
+
+Arena::Arena    (size_t blockSize) :
+       block            (NULL),
+       blockSize        (blockSize),
+       offset           (blockSize),
+       allocatedBytes   (0),
+       reservedBytes    (0),
+       owners           (1)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+}
+Arena::~Arena   ()
+{
+    for (size_t i = 0; i < this->blocks.size(); i++)
+        delete[] this->blocks.at(i);
+
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+void*   Arena::Allocate             (size_t size)
+{
+    size = ARENA_ALIGN(size);
+
+    EnterCriticalSection(&this->monitorMutex);
+
+    char *memory = NULL;
+
+    if (size > this->blockSize / 4)
+    {
+        /* Large requests get a block of their own so that the current block is not wasted */
+        memory = new char[size];
+        this->blocks.push_back(memory);
+        this->reservedBytes += size;
+    }
+    else
+    {
+        if (this->offset + size > this->blockSize)
+        {
+            this->block          = new char[this->blockSize];
+            this->blocks.push_back(this->block);
+            this->reservedBytes += this->blockSize;
+            this->offset         = 0;
+        }
+
+        memory        = this->block + this->offset;
+        this->offset += size;
+    }
+
+    this->allocatedBytes += size;
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return memory;
+}
+void    Arena::Retain               ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->owners++;
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void    Arena::Release              ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    bool isUnused = --this->owners == 0;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    if (isUnused)
+        delete this;
+}
+size_t  Arena::GetAllocatedBytes    ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    size_t bytes = this->allocatedBytes;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return bytes;
+}
+size_t  Arena::GetReservedBytes     ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    size_t bytes = this->reservedBytes;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return bytes;
+}
+size_t  Arena::GetBlockCount        ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    size_t count = this->blocks.size();
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return count;
+}
+void*   Arena::AllocateObject       (size_t size, Arena *arena)
+{
+    /* Every object is preceded by the arena it lives in, NULL for objects on the heap */
+    size_t  total   = ARENA_ALIGN(sizeof(Arena *)) + size;
+    char    *memory = arena ? (char *) arena->Allocate(total) : (char *) ::operator new(total);
+
+    *(Arena **) memory = arena;
+
+    return memory + ARENA_ALIGN(sizeof(Arena *));
+}
+void    Arena::FreeObject           (void *object)
+{
+    if (object == NULL)
+        return;
+
+    char *memory = (char *) object - ARENA_ALIGN(sizeof(Arena *));
+
+    if (*(Arena **) memory == NULL)
+        ::operator delete(memory);
+}
+
+void*   ArenaAllocated::operator new    (size_t size)
+{
+    return Arena::AllocateObject(size, NULL);
+}
+void*   ArenaAllocated::operator new    (size_t size, Arena *arena)
+{
+    return Arena::AllocateObject(size, arena);
+}
+void    ArenaAllocated::operator delete (void *object)
+{
+    Arena::FreeObject(object);
+}
+void    ArenaAllocated::operator delete (void *object, Arena *)
+{
+    Arena::FreeObject(object);
+}
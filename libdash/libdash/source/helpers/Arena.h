@@ -0,0 +1,71 @@
+/*
+ * Arena.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include "config.h"
+
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace helpers
+    {
+        /*
+         *  Monotonic allocator that hands out memory from large blocks. Single allocations are never returned, all blocks
+         *  are freed at once when the arena has been released by all of its owners.
+         */
+        class Arena
+        {
+            public:
+                Arena   (size_t blockSize = 65536);
+
+                void*   Allocate            (size_t size);
+                void    Retain              ();
+                void    Release             ();
+                size_t  GetAllocatedBytes   ();
+                size_t  GetReservedBytes    ();
+                size_t  GetBlockCount       ();
+
+                static void*    AllocateObject  (size_t size, Arena *arena);
+                static void     FreeObject      (void *object);
+
+            private:
+                virtual ~Arena  ();
+
+                std::vector<char *>         blocks;
+                char                        *block;         /* the block small requests are taken from */
+                size_t                      blockSize;
+                size_t                      offset;
+                size_t                      allocatedBytes;
+                size_t                      reservedBytes;
+                uint32_t                    owners;
+                mutable CRITICAL_SECTION    monitorMutex;
+        };
+
+        /*
+         *  Base class for objects that may be placed into an Arena with new (arena) T(). Objects created with a plain
+         *  new, or with a NULL arena, are allocated on the heap. delete runs the destructor in both cases but only
+         *  frees heap memory.
+         */
+        class ArenaAllocated
+        {
+            public:
+                static void*    operator new    (size_t size);
+                static void*    operator new    (size_t size, Arena *arena);
+                static void     operator delete (void *object);
+                static void     operator delete (void *object, Arena *arena);
+        };
+    }
+}
+
+#endif /* ARENA_H_ */
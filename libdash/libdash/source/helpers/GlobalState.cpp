@@ -0,0 +1,26 @@
+/*
+ * GlobalState.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "GlobalState.h"
+
+using namespace dash::helpers;
+
+GlobalState::GlobalState    ()
+{
+    xmlInitParser();
+    curl_global_init(CURL_GLOBAL_ALL);
+}
+
+void    GlobalState::Initialize ()
+{
+    /* constructed on the first call, which does not depend on the initialization order of the translation units */
+    static GlobalState state;
+}
@@ -0,0 +1,41 @@
+/*
+ * GlobalState.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef GLOBALSTATE_H_
+#define GLOBALSTATE_H_
+
+#include "config.h"
+
+#include <libxml/parser.h>
+#include <curl/curl.h>
+
+namespace dash
+{
+    namespace helpers
+    {
+        /*
+         *  Initializes the global state of libxml2 and curl once per process. The state is never cleaned up: xmlCleanupParser
+         *  and curl_global_cleanup may only be called once, when no other part of the process uses the libraries any more,
+         *  which libdash cannot know. Every DASHManager, DOMParser, ManifestFetcher and download calls Initialize before it
+         *  uses one of the libraries.
+         */
+        class GlobalState
+        {
+            public:
+                static void Initialize  ();
+
+            private:
+                GlobalState ();
+        };
+    }
+}
+
+#endif /* GLOBALSTATE_H_ */
@@ -0,0 +1,37 @@
+/*
+ * LazyLock.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "LazyLock.h"
+
+using namespace dash::helpers;
+
+void                LazyLock::Enter     ()
+{
+    EnterCriticalSection(&GetMutex());
+}
+void                LazyLock::Leave     ()
+{
+    LeaveCriticalSection(&GetMutex());
+}
+
+CRITICAL_SECTION&   LazyLock::GetMutex  ()
+{
+    /* created on the first call, which does not depend on the initialization order of the translation units. The mutex
+       is never deleted, an MPD may still be read while other static objects are destroyed */
+    static CRITICAL_SECTION *mutex = NewMutex();
+    return *mutex;
+}
+CRITICAL_SECTION*   LazyLock::NewMutex  ()
+{
+    CRITICAL_SECTION *mutex = new CRITICAL_SECTION;
+    InitializeCriticalSection(mutex);
+    return mutex;
+}
@@ -0,0 +1,41 @@
+/*
+ * LazyLock.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef LAZYLOCK_H_
+#define LAZYLOCK_H_
+
+#include "config.h"
+
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace helpers
+    {
+        /*
+         *  The lock of the members that const getters build on their first call, e.g. the attribute maps of the elements and
+         *  nodes. Several threads may read the same MPD, so the build must not race. One lock serves all objects, the maps
+         *  are rarely requested and a lock per object would cost more than the map itself.
+         */
+        class LazyLock
+        {
+            public:
+                static void Enter   ();
+                static void Leave   ();
+
+            private:
+                static CRITICAL_SECTION&    GetMutex    ();
+                static CRITICAL_SECTION*    NewMutex    ();
+        };
+    }
+}
+
+#endif /* LAZYLOCK_H_ */
@@ -15,29 +15,51 @@ using namespace dash::helpers;
 
 void    String::Split   (const std::string &s, char delim, std::vector<std::string>& vector)
 {
-    std::stringstream           ss(s);
-    std::string                 item;
+    /* yields the items getline would, empty items are kept and a trailing delimiter does not add an item */
+    vector.reserve(vector.size() + std::count(s.begin(), s.end(), delim) + 1);
 
-    while(std::getline(ss, item, delim))
-        vector.push_back(item);
+    size_t first = 0;
+
+    while (first < s.length())
+    {
+        size_t last = s.find(delim, first);
+
+        if (last == std::string::npos)
+            last = s.length();
+
+        vector.push_back(s.substr(first, last - first));
+        first = last + 1;
+    }
 }
 void    String::Split   (const std::string &s, char delim, std::vector<uint32_t>& vector)
 {
-    size_t lengthOfString = s.length();
-    size_t pos = 0;
-    size_t i = 0;
-    uint32_t level = 0;
+    size_t first = 0;
 
-    while (pos != std::string::npos)
+    while (first < s.length())
     {
-        pos = s.find(delim, i);
+        size_t last = s.find(delim, first);
+
+        if (last == std::string::npos)
+            last = s.length();
+
+        /* the digits are read in place, leading white space and a plus sign are skipped like strtoul does */
+        size_t      pos     = first;
+        uint32_t    level   = 0;
+
+        while (pos < last && (s[pos] == ' ' || s[pos] == '\t' || s[pos] == '\r' || s[pos] == '\n'))
+            pos++;
 
-        if (i < lengthOfString)
+        if (pos < last && s[pos] == '+')
+            pos++;
+
+        while (pos < last && s[pos] >= '0' && s[pos] <= '9')
         {
-            level = strtoul(s.substr(i, pos-i).c_str(), NULL, 10);
-            vector.push_back(level);
-            i = pos + 1;
+            level = level * 10 + (s[pos] - '0');
+            pos++;
         }
+
+        vector.push_back(level);
+        first = last + 1;
     }
 }
 bool    String::ToBool  (const std::string &s)
@@ -50,4 +72,296 @@ bool    String::ToBool  (const std::string &s)
     {
         return false;
     }
-}
\ No newline at end of file
+}
+uint64_t    String::ToUInt64    (const std::string &s)
+{
+    size_t   pos    = s.find_first_not_of(" \t\r\n");
+    uint64_t value  = 0;
+
+    if (pos != std::string::npos && s[pos] == '+')
+        pos++;
+
+    while (pos < s.length() && s[pos] >= '0' && s[pos] <= '9')
+    {
+        value = value * 10 + (s[pos] - '0');
+        pos++;
+    }
+
+    return value;
+}
+int64_t     String::ToInt64     (const std::string &s)
+{
+    size_t pos = s.find_first_not_of(" \t\r\n");
+
+    if (pos != std::string::npos && s[pos] == '-')
+        return -(int64_t) ToUInt64(s.substr(pos + 1));
+
+    return (int64_t) ToUInt64(s);
+}
+dash::mpd::Duration     String::ToDuration  (const std::string &s)
+{
+    /* the designators in the order they may appear, years and months are counted as 365 and 30 days */
+    static const char       dateDesignators[]   = { 'Y', 'M', 'W', 'D' };
+    static const int64_t    dateUnits[]         = { 365 * 86400 * dash::mpd::TicksPerSecond, 30 * 86400 * dash::mpd::TicksPerSecond,
+                                                    7 * 86400 * dash::mpd::TicksPerSecond, 86400 * dash::mpd::TicksPerSecond };
+    static const char       timeDesignators[]   = { 'H', 'M', 'S' };
+    static const int64_t    timeUnits[]         = { 3600 * dash::mpd::TicksPerSecond, 60 * dash::mpd::TicksPerSecond, dash::mpd::TicksPerSecond };
+
+    dash::mpd::Duration duration;
+    const char          *first      = s.c_str();
+    const char          *last       = first + s.length();
+    bool                isNegative  = false;
+    bool                isTime      = false;
+    size_t              next        = 0;
+    int64_t             ticks       = 0;
+
+    Trim(first, last);
+
+    if (first < last && *first == '-')
+    {
+        isNegative = true;
+        first++;
+    }
+
+    if (first == last || *first++ != 'P' || first == last)
+        return duration;
+
+    while (first < last)
+    {
+        if (*first == 'T')
+        {
+            if (isTime || ++first == last)
+                return duration;
+
+            isTime  = true;
+            next    = 0;
+            continue;
+        }
+
+        const char      *designators    = isTime ? timeDesignators  : dateDesignators;
+        const int64_t   *units          = isTime ? timeUnits        : dateUnits;
+        size_t          count           = isTime ? sizeof(timeDesignators) : sizeof(dateDesignators);
+        const char      *number         = first;
+
+        while (first < last && ((*first >= '0' && *first <= '9') || *first == '.' || *first == ','))
+            first++;
+
+        if (first == last)
+            return duration;
+
+        while (next < count && designators[next] != *first)
+            next++;
+
+        if (next == count)
+            return duration;
+
+        int64_t value = 0;
+
+        if (!ReadTicks(number, first, units[next], value) || value > INT64_MAX - ticks)
+            return duration;
+
+        ticks += value;
+        first++;
+        next++;
+    }
+
+    duration.ticks      = isNegative ? -ticks : ticks;
+    duration.isValid    = true;
+    return duration;
+}
+dash::mpd::DateTime     String::ToDateTime  (const std::string &s)
+{
+    dash::mpd::DateTime dateTime;
+    const char          *first      = s.c_str();
+    const char          *last       = first + s.length();
+    bool                isNegative  = false;
+    uint32_t            year        = 0;
+    uint32_t            month       = 0;
+    uint32_t            day         = 0;
+    uint32_t            hour        = 0;
+    uint32_t            minute      = 0;
+    int64_t             second      = 0;
+
+    Trim(first, last);
+
+    if (first < last && *first == '-')
+    {
+        isNegative = true;
+        first++;
+    }
+
+    /* the year has at least four digits, all the other fields have two */
+    const char *yearStart = first;
+
+    if (!ReadNumber(first, last, 9, year) || first - yearStart < 4 || first == last || *first++ != '-' ||
+        !ReadNumber(first, last, 2, month) || first == last || *first++ != '-' ||
+        !ReadNumber(first, last, 2, day) || first == last || *first++ != 'T' ||
+        !ReadNumber(first, last, 2, hour) || first == last || *first++ != ':' ||
+        !ReadNumber(first, last, 2, minute) || first == last || *first++ != ':')
+        return dateTime;
+
+    const char *seconds = first;
+
+    while (first < last && ((*first >= '0' && *first <= '9') || *first == '.'))
+        first++;
+
+    if (first - seconds < 2 || seconds[0] == '.' || seconds[1] == '.' || (first - seconds > 2 && seconds[2] != '.') ||
+        !ReadTicks(seconds, first, dash::mpd::TicksPerSecond, second))
+        return dateTime;
+
+    static const uint32_t daysInMonth[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+    int64_t signedYear  = isNegative ? -(int64_t) year : year;
+    bool    isLeapYear  = (signedYear % 4 == 0 && signedYear % 100 != 0) || signedYear % 400 == 0;
+
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth[month - 1] || (month == 2 && day == 29 && !isLeapYear) ||
+        minute > 59 || second >= 60 * dash::mpd::TicksPerSecond || hour > 24 || (hour == 24 && (minute || second)))
+        return dateTime;
+
+    int64_t offset = 0;
+
+    if (first < last && *first == 'Z')
+    {
+        first++;
+    }
+    else if (first < last && (*first == '+' || *first == '-'))
+    {
+        bool        isWest          = *first++ == '-';
+        uint32_t    offsetHours     = 0;
+        uint32_t    offsetMinutes   = 0;
+
+        if (!ReadNumber(first, last, 2, offsetHours) || first == last || *first++ != ':' || !ReadNumber(first, last, 2, offsetMinutes) ||
+            offsetHours > 14 || offsetMinutes > 59)
+            return dateTime;
+
+        offset = (offsetHours * 60 + offsetMinutes) * 60 * dash::mpd::TicksPerSecond;
+
+        if (isWest)
+            offset = -offset;
+    }
+
+    if (first != last)
+        return dateTime;
+
+    /* the ticks overflow for years beyond about 290000, such dates are rejected */
+    int64_t days = DaysFromCivil(signedYear, month, day);
+
+    if (days > 106751990 || days < -106751990)
+        return dateTime;
+
+    dateTime.ticks      = days * 86400 * dash::mpd::TicksPerSecond + (hour * 3600 + minute * 60) * dash::mpd::TicksPerSecond + second - offset;
+    dateTime.isValid    = true;
+    return dateTime;
+}
+dash::mpd::FrameRate    String::ToFrameRate (const std::string &s)
+{
+    dash::mpd::FrameRate    frameRate;
+    const char              *first      = s.c_str();
+    const char              *last       = first + s.length();
+    uint32_t                numerator   = 0;
+    uint32_t                denominator = 1;
+
+    Trim(first, last);
+
+    if (!ReadNumber(first, last, 10, numerator))
+        return frameRate;
+
+    if (first < last && *first == '/')
+    {
+        first++;
+
+        if (!ReadNumber(first, last, 10, denominator) || denominator == 0)
+            return frameRate;
+    }
+
+    if (first != last)
+        return frameRate;
+
+    frameRate.numerator     = numerator;
+    frameRate.denominator   = denominator;
+    frameRate.isValid       = true;
+    return frameRate;
+}
+void        String::Trim        (const char *&first, const char *&last)
+{
+    while (first < last && (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\n'))
+        first++;
+
+    while (last > first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r' || last[-1] == '\n'))
+        last--;
+}
+bool        String::ReadNumber  (const char *&first, const char *last, int digits, uint32_t &number)
+{
+    /* reads one up to the given number of digits and fails if more follow, the two digit fields need both of them */
+    uint64_t    value   = 0;
+    int         count   = 0;
+
+    while (first < last && *first >= '0' && *first <= '9' && count < digits)
+    {
+        value = value * 10 + (*first - '0');
+        first++;
+        count++;
+    }
+
+    if (count == 0 || (digits == 2 && count != 2) || value > 0xFFFFFFFF || (first < last && *first >= '0' && *first <= '9'))
+        return false;
+
+    number = (uint32_t) value;
+    return true;
+}
+bool        String::ReadTicks   (const char *&first, const char *last, int64_t unit, int64_t &ticks)
+{
+    /* a decimal number of units, the digits of the fraction are added as long as they are not below one tick */
+    int64_t value   = 0;
+    bool    isEmpty = true;
+
+    while (first < last && *first >= '0' && *first <= '9')
+    {
+        int digit = *first - '0';
+
+        if (value > (INT64_MAX / unit - digit) / 10)
+            return false;
+
+        value = value * 10 + digit;
+        first++;
+        isEmpty = false;
+    }
+
+    value *= unit;
+
+    if (first < last && (*first == '.' || *first == ','))
+    {
+        first++;
+
+        int64_t scale = unit;
+
+        if (first == last)
+            return false;
+
+        while (first < last && *first >= '0' && *first <= '9')
+        {
+            scale /= 10;
+            value += (*first - '0') * scale;
+            first++;
+            isEmpty = false;
+        }
+    }
+
+    if (isEmpty || first != last)
+        return false;
+
+    ticks = value;
+    return true;
+}
+int64_t     String::DaysFromCivil   (int64_t year, uint32_t month, uint32_t day)
+{
+    /* days since 1970-01-01 in the proleptic Gregorian calendar, the years are counted in eras of 400 years from March */
+    year -= month <= 2;
+
+    int64_t     era             = (year >= 0 ? year : year - 399) / 400;
+    int64_t     yearOfEra       = year - era * 400;
+    int64_t     dayOfYear       = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int64_t     dayOfEra        = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * 146097 + dayOfEra - 719468;
+}
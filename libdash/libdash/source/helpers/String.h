@@ -14,6 +14,8 @@
 
 #include "config.h"
 
+#include "MPDValues.h"
+
 namespace dash
 {
     namespace helpers
@@ -24,6 +26,24 @@ namespace dash
                 static void Split   (const std::string &s, char delim, std::vector<std::string>& vector);
                 static void Split   (const std::string &s, char delim, std::vector<uint32_t>& vector);
                 static bool ToBool  (const std::string &s);
+
+                /* strtoul counterparts for 64-bit values, parsing stops at the first character that is not a digit */
+                static uint64_t ToUInt64    (const std::string &s);
+                static int64_t  ToInt64     (const std::string &s);
+
+                /*
+                 *  Decoders for the xs:duration, xs:dateTime and frame rate attributes of the MPD. They work on the
+                 *  characters of the string in place and return an invalid value if it does not match the format.
+                 */
+                static dash::mpd::Duration  ToDuration  (const std::string &s);
+                static dash::mpd::DateTime  ToDateTime  (const std::string &s);
+                static dash::mpd::FrameRate ToFrameRate (const std::string &s);
+
+            private:
+                static void     Trim            (const char *&first, const char *&last);
+                static bool     ReadNumber      (const char *&first, const char *last, int digits, uint32_t &number);
+                static bool     ReadTicks       (const char *&first, const char *last, int64_t unit, int64_t &ticks);
+                static int64_t  DaysFromCivil   (int64_t year, uint32_t month, uint32_t day);
         };
     }
 }
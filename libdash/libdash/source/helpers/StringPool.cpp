@@ -0,0 +1,196 @@
+/*
+ * StringPool.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "StringPool.h"
+
+using namespace dash::helpers;
+
+static const std::string emptyString;
+
+InternedString::InternedString  () :
+                entry           (NULL)
+{
+}
+InternedString::InternedString  (const InternedString &other) :
+                entry           (other.entry)
+{
+    if (this->entry)
+        this->entry->second.pool->AddReference(this->entry);
+}
+InternedString::InternedString  (Entry *entry) :
+                entry           (entry)
+{
+}
+InternedString::~InternedString ()
+{
+    if (this->entry)
+        this->entry->second.pool->RemoveReference(this->entry);
+}
+
+InternedString&     InternedString::operator=   (const InternedString &other)
+{
+    if (this->entry == other.entry)
+        return *this;
+
+    if (other.entry)
+        other.entry->second.pool->AddReference(other.entry);
+
+    if (this->entry)
+        this->entry->second.pool->RemoveReference(this->entry);
+
+    this->entry = other.entry;
+    return *this;
+}
+bool                InternedString::operator==  (const InternedString &other) const
+{
+    return this->entry == other.entry || this->Get() == other.Get();
+}
+bool                InternedString::operator!=  (const InternedString &other) const
+{
+    return !(*this == other);
+}
+const std::string&  InternedString::Get         () const
+{
+    if (this->entry)
+        return this->entry->first;
+
+    return emptyString;
+}
+int                 InternedString::GetTag      () const
+{
+    if (this->entry)
+        return this->entry->second.tag;
+
+    return 0;
+}
+StringPool*         InternedString::GetPool     () const
+{
+    if (this->entry)
+        return this->entry->second.pool;
+
+    return NULL;
+}
+
+StringPool::StringPool  (StringTagger tagger) :
+            tagger      (tagger),
+            owners      (1),
+            references  (0)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+}
+StringPool::~StringPool ()
+{
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+InternedString  StringPool::Intern              (const std::string &value)
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    std::map<std::string, StringPoolEntry>::iterator it = this->strings.find(value);
+
+    if (it == this->strings.end())
+    {
+        StringPoolEntry entry = { 0, this, this->tagger ? this->tagger(value) : 0 };
+        it = this->strings.insert(std::make_pair(value, entry)).first;
+    }
+
+    it->second.references++;
+    this->references++;
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return InternedString(&(*it));
+}
+InternedString  StringPool::Intern              (const char *value)
+{
+    return this->Intern(std::string(value ? value : ""));
+}
+void            StringPool::Retain              ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->owners++;
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void            StringPool::Release             ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->owners--;
+    bool isUnused = this->IsUnused();
+    LeaveCriticalSection(&this->monitorMutex);
+
+    if (isUnused)
+        delete this;
+}
+size_t          StringPool::GetStringCount      ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    size_t count = this->strings.size();
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return count;
+}
+size_t          StringPool::GetStringBytes      ()
+{
+    size_t bytes = 0;
+
+    EnterCriticalSection(&this->monitorMutex);
+    for (std::map<std::string, StringPoolEntry>::const_iterator it = this->strings.begin(); it != this->strings.end(); ++it)
+        bytes += it->first.size();
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return bytes;
+}
+size_t          StringPool::GetReferenceCount   ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    size_t count = this->references;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return count;
+}
+size_t          StringPool::GetReferencedBytes  ()
+{
+    size_t bytes = 0;
+
+    EnterCriticalSection(&this->monitorMutex);
+    for (std::map<std::string, StringPoolEntry>::const_iterator it = this->strings.begin(); it != this->strings.end(); ++it)
+        bytes += it->first.size() * it->second.references;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return bytes;
+}
+void            StringPool::AddReference        (InternedString::Entry *entry)
+{
+    EnterCriticalSection(&this->monitorMutex);
+    entry->second.references++;
+    this->references++;
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void            StringPool::RemoveReference     (InternedString::Entry *entry)
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    this->references--;
+
+    if (--entry->second.references == 0)
+        this->strings.erase(this->strings.find(entry->first));
+
+    bool isUnused = this->IsUnused();
+    LeaveCriticalSection(&this->monitorMutex);
+
+    if (isUnused)
+        delete this;
+}
+bool            StringPool::IsUnused            () const
+{
+    return this->owners == 0 && this->strings.empty();
+}
@@ -0,0 +1,103 @@
+/*
+ * StringPool.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef STRINGPOOL_H_
+#define STRINGPOOL_H_
+
+#include "config.h"
+
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace helpers
+    {
+        class StringPool;
+
+        /*
+         *  Computes a value that is stored along with every distinct string of a pool, e.g. an id for known names.
+         */
+        typedef int (*StringTagger) (const std::string &value);
+
+        struct StringPoolEntry
+        {
+            uint32_t    references;
+            StringPool  *pool;
+            int         tag;
+        };
+
+        /*
+         *  Reference counted handle to a string stored in a StringPool. Copying a handle only increases the reference
+         *  count, the string is removed from the pool when the last handle is destroyed.
+         */
+        class InternedString
+        {
+            public:
+                InternedString          ();
+                InternedString          (const InternedString &other);
+                ~InternedString         ();
+
+                InternedString&     operator=   (const InternedString &other);
+                bool                operator==  (const InternedString &other) const;
+                bool                operator!=  (const InternedString &other) const;
+                const std::string&  Get         () const;
+                int                 GetTag      () const;
+                StringPool*         GetPool     () const;
+
+            private:
+                friend class StringPool;
+                typedef std::pair<const std::string, StringPoolEntry> Entry;
+
+                explicit InternedString (Entry *entry);
+
+                Entry   *entry;
+        };
+
+        typedef std::pair<InternedString, InternedString>   InternedAttribute;
+        typedef std::vector<InternedAttribute>              InternedAttributes;
+
+        /*
+         *  Stores every distinct string only once. The pool is shared by all objects built from one MPD and deletes
+         *  itself when it has been released by its owners and no handle refers to it anymore.
+         */
+        class StringPool
+        {
+            public:
+                StringPool  (StringTagger tagger = NULL);
+
+                InternedString  Intern              (const std::string &value);
+                InternedString  Intern              (const char *value);
+                void            Retain              ();
+                void            Release             ();
+                size_t          GetStringCount      ();
+                size_t          GetStringBytes      ();
+                size_t          GetReferenceCount   ();
+                size_t          GetReferencedBytes  ();
+
+            private:
+                friend class InternedString;
+
+                virtual ~StringPool ();
+
+                void    AddReference        (InternedString::Entry *entry);
+                void    RemoveReference     (InternedString::Entry *entry);
+                bool    IsUnused            () const;
+
+                std::map<std::string, StringPoolEntry>  strings;
+                StringTagger                            tagger;
+                uint32_t                                owners;
+                size_t                                  references;
+                mutable CRITICAL_SECTION                monitorMutex;
+        };
+    }
+}
+
+#endif /* STRINGPOOL_H_ */
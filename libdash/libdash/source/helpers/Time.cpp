@@ -15,19 +15,29 @@ using namespace dash::helpers;
 
 uint32_t    Time::GetCurrentUTCTimeInSec   ()
 {
-    return mktime(Time::GetCurrentUTCTime());
+    struct tm utcTime;
+    Time::GetCurrentUTCTime(&utcTime);
+
+    return mktime(&utcTime);
 }
 std::string Time::GetCurrentUTCTimeStr   ()
 {
+    struct tm utcTime;
+    Time::GetCurrentUTCTime(&utcTime);
+
     char timeString[30];
-    strftime(timeString, 30, "%Y-%m-%dT%H:%M:%SZ", Time::GetCurrentUTCTime());
+    strftime(timeString, 30, "%Y-%m-%dT%H:%M:%SZ", &utcTime);
 
     return std::string(timeString);
 }
-struct tm*  Time::GetCurrentUTCTime     ()
+void        Time::GetCurrentUTCTime     (struct tm *utcTime)
 {
     time_t      rawTime;
 
     time(&rawTime);
-    return gmtime(&rawTime);
+#if defined _WIN32 || defined _WIN64
+    gmtime_s(utcTime, &rawTime);
+#else
+    gmtime_r(&rawTime, utcTime);
+#endif
 }
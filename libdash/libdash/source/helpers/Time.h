@@ -26,7 +26,8 @@ namespace dash
                 static std::string  GetCurrentUTCTimeStr    ();
 
             private:
-                static struct tm*   GetCurrentUTCTime       ();
+                /* fills the given struct instead of returning the static one of gmtime, which is shared by all threads */
+                static void         GetCurrentUTCTime       (struct tm *utcTime);
 
         };
     }
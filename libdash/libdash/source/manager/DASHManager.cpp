@@ -11,34 +11,409 @@
 
 #include "DASHManager.h"
 
+#include <limits.h>
+
 using namespace dash;
 using namespace dash::xml;
 using namespace dash::mpd;
 using namespace dash::network;
 using namespace dash::helpers;
 
-DASHManager::DASHManager            ()
+DASHManager::DASHManager            () :
+             arenaAllocation        (false),
+             periodConversionThreads(0),
+             xlinkParallelism       (4)
 {
+    GlobalState::Initialize();
 }
 DASHManager::~DASHManager           ()
 {
 }
 IMPD*           DASHManager::Open   (char *path)
 {
-    DOMParser parser(path);
+    return this->Open(path, ParseOptions());
+}
+IMPD*           DASHManager::Open   (const char *data, size_t length, const std::string &baseUrl)
+{
+    return this->Open(data, length, baseUrl, ParseOptions());
+}
+IMPD*           DASHManager::Open   (const char *path, const std::string &baseUrl)
+{
+    return this->Open(path, baseUrl, ParseOptions());
+}
+IMPD*           DASHManager::Open   (char *path, const ParseOptions &options)
+{
+    if (path == NULL)
+        return NULL;
+
+    ManifestTransfer transfer(path);
+
+    return this->Open(transfer, options);
+}
+IMPD*           DASHManager::Open   (ManifestTransfer &transfer, const ParseOptions &options)
+{
+    if (!ManifestFetcher::IsRemoteUrl(transfer.GetUrl()))
+    {
+        DOMParser parser(transfer.GetUrl());
+
+        return this->Open(parser, options);
+    }
 
     uint32_t fetchTime = Time::GetCurrentUTCTimeInSec();
 
-    if (!parser.Parse())
+    if (!this->fetcher.Fetch(transfer) || transfer.IsNotModified() || transfer.IsCanceled() ||
+        transfer.GetData().empty() || transfer.GetData().size() > INT_MAX)
         return NULL;
 
-    MPD* mpd = parser.GetRootNode()->ToMPD();
+    /* relative BaseURLs are resolved against the location the MPD has been redirected to */
+    DOMParser parser(transfer.GetData().data(), transfer.GetData().size(), transfer.GetEffectiveUrl());
+
+    MPD *mpd = this->Open(parser, options);
 
     if (mpd)
+    {
         mpd->SetFetchTime(fetchTime);
+        mpd->SetETag(transfer.GetETag());
+        mpd->SetLastModified(transfer.GetLastModified());
+    }
+
+    return mpd;
+}
+IMPDRequest*    DASHManager::OpenAsync  (const char *url)
+{
+    return this->OpenAsync(url, ParseOptions());
+}
+IMPDRequest*    DASHManager::OpenAsync  (const char *url, const ParseOptions &options)
+{
+    if (url == NULL)
+        return NULL;
+
+    MPDRequest *request = new MPDRequest(this, url, options);
+
+    if (!request->Start())
+    {
+        delete request;
+        return NULL;
+    }
+
+    return request;
+}
+IMPD*           DASHManager::Open   (const char *data, size_t length, const std::string &baseUrl, const ParseOptions &options)
+{
+    if (data == NULL || length == 0 || length > INT_MAX)
+        return NULL;
+
+    DOMParser parser(data, length, baseUrl);
+
+    return this->Open(parser, options);
+}
+IMPD*           DASHManager::Open   (const char *path, const std::string &baseUrl, const ParseOptions &options)
+{
+    mapped_file_t file;
+
+    if (!MapFilePortable(path, &file))
+        return NULL;
+
+    IMPD *mpd = this->Open(file.data, file.size, baseUrl, options);
+
+    UnmapFilePortable(&file);
+
+    return mpd;
+}
+MPD*            DASHManager::Open   (DOMParser &parser, const ParseOptions &options)
+{
+    uint32_t fetchTime = Time::GetCurrentUTCTimeInSec();
+
+    if (this->arenaAllocation)
+    {
+        Arena *arena = new Arena();
+        parser.SetArena(arena);
+        arena->Release();
+    }
+
+    parser.SetPeriodThreads(this->periodConversionThreads);
+    parser.SetParseOptions(options);
+    parser.SetBuildObservers(this->buildObservers);
+    parser.SetXLinkResolution(this->xlinkParallelism > 0);
+
+    MPD* mpd = parser.BuildMPD();
+
+    if (mpd == NULL)
+        return NULL;
+
+    if (this->xlinkParallelism)
+    {
+        XLinkResolver resolver(&this->fetcher, &this->xlinkCache, this->xlinkParallelism);
+
+        resolver.SetParseOptions(options);
+        resolver.SetBuildObservers(this->buildObservers);
+        resolver.Resolve(mpd);
+    }
+
+    mpd->SetFetchTime(fetchTime);
 
     return mpd;
 }
+IRefreshReport* DASHManager::Refresh    (IMPD *mpd, char *path)
+{
+    return this->Refresh(mpd, path, ParseOptions());
+}
+IRefreshReport* DASHManager::Refresh    (IMPD *mpd, const char *data, size_t length, const std::string &baseUrl)
+{
+    return this->Refresh(mpd, data, length, baseUrl, ParseOptions());
+}
+IRefreshReport* DASHManager::Refresh    (IMPD *mpd, char *path, const ParseOptions &options)
+{
+    if (path == NULL)
+        return NULL;
+
+    if (!ManifestFetcher::IsRemoteUrl(path))
+    {
+        DOMParser parser(path);
+
+        return this->Refresh(mpd, parser, options);
+    }
+
+    MPD *current = dynamic_cast<MPD *>(mpd);
+
+    if (current == NULL)
+        return NULL;
+
+    uint32_t        fetchTime   = Time::GetCurrentUTCTimeInSec();
+    IRefreshReport  *report     = this->RefreshWithPatch(current, options);
+
+    if (report)
+    {
+        current->SetFetchTime(fetchTime);
+        return report;
+    }
+
+    /* the patch could not be fetched or does not match the MPD, the whole MPD is fetched instead */
+    ManifestTransfer transfer(path);
+    transfer.SetValidators(current->GetETag(), current->GetLastModified());
+
+    if (!this->fetcher.Fetch(transfer))
+        return NULL;
+
+    /* the MPD is still valid at the time of the request, nothing has to be parsed */
+    if (transfer.IsNotModified())
+    {
+        RefreshReport *report = new RefreshReport();
+        report->SetNotModified(true);
+
+        current->SetFetchTime(fetchTime);
+
+        return report;
+    }
+
+    if (transfer.GetData().empty() || transfer.GetData().size() > INT_MAX)
+        return NULL;
+
+    DOMParser parser(transfer.GetData().data(), transfer.GetData().size(), transfer.GetEffectiveUrl());
+
+    report = this->Refresh(mpd, parser, options);
+
+    if (report)
+    {
+        current->SetFetchTime(fetchTime);
+        current->SetETag(transfer.GetETag());
+        current->SetLastModified(transfer.GetLastModified());
+    }
+
+    return report;
+}
+IRefreshReport* DASHManager::Refresh    (IMPD *mpd, const char *data, size_t length, const std::string &baseUrl, const ParseOptions &options)
+{
+    if (data == NULL || length == 0 || length > INT_MAX)
+        return NULL;
+
+    DOMParser parser(data, length, baseUrl);
+
+    return this->Refresh(mpd, parser, options);
+}
+IRefreshReport* DASHManager::ApplyPatch (IMPD *mpd, const char *data, size_t length)
+{
+    return this->ApplyPatch(mpd, data, length, ParseOptions());
+}
+IRefreshReport* DASHManager::ApplyPatch (IMPD *mpd, const char *data, size_t length, const ParseOptions &options)
+{
+    MPD *current = dynamic_cast<MPD *>(mpd);
+
+    /* the operations are applied to the element tree, which needs the raw attributes to be written back into nodes */
+    if (current == NULL || data == NULL || length == 0 || length > INT_MAX ||
+        current->GetStringPool() == NULL || !current->AreRawAttributesRetained())
+        return NULL;
+
+    uint32_t        fetchTime   = Time::GetCurrentUTCTimeInSec();
+    PatchDocument   patch(data, length, current);
+
+    if (!patch.IsApplicableTo(current))
+        return NULL;
+
+    RefreshReport *report = new RefreshReport();
+
+    if (!patch.Apply(current, options, *report))
+    {
+        /* the operations before the failed one may have changed the MPD, so it no longer is the version the validators
+           describe. Without them the next fetch of the whole MPD is unconditional and merges everything that differs */
+        current->SetETag("");
+        current->SetLastModified("");
+
+        delete report;
+        return NULL;
+    }
+
+    /* the Periods and AdaptationSets a patch adds may link to remote elements */
+    if (this->xlinkParallelism)
+    {
+        XLinkResolver resolver(&this->fetcher, &this->xlinkCache, this->xlinkParallelism);
+
+        resolver.SetParseOptions(options);
+        resolver.Resolve(current);
+    }
+
+    current->SetFetchTime(fetchTime);
+
+    /* the validators belong to the MPD that has been fetched last, not to the patched one */
+    current->SetETag("");
+    current->SetLastModified("");
+
+    return report;
+}
+IRefreshReport* DASHManager::Refresh    (IMPD *mpd, DOMParser &parser, const ParseOptions &options)
+{
+    MPD *current = dynamic_cast<MPD *>(mpd);
+
+    if (current == NULL)
+        return NULL;
+
+    if (current->GetStringPool())
+        parser.SetStringPool(current->GetStringPool());
+
+    /* the update is built on the heap, not into the arena of the current MPD. The elements that are merged are moved
+       into the current MPD and deleted with it, all others with the update, so the arena does not grow with every refresh */
+    parser.SetPeriodThreads(this->periodConversionThreads);
+    parser.SetParseOptions(options);
+
+    uint32_t fetchTime = Time::GetCurrentUTCTimeInSec();
+
+    MPD *update = parser.BuildMPD();
+
+    if (update == NULL)
+        return NULL;
+
+    /* the update is compared with the resolved elements of the current MPD */
+    if (this->xlinkParallelism)
+    {
+        XLinkResolver resolver(&this->fetcher, &this->xlinkCache, this->xlinkParallelism);
+
+        resolver.SetParseOptions(options);
+        resolver.Resolve(update);
+    }
+
+    RefreshReport *report = new RefreshReport();
+
+    current->Refresh(update, *report);
+    current->SetFetchTime(fetchTime);
+
+    delete update;
+
+    return report;
+}
+bool            DASHManager::WriteSnapshot  (IMPD *mpd, const char *path)
+{
+    SnapshotWriter writer;
+
+    return writer.Write(mpd, path);
+}
+IMPD*           DASHManager::OpenSnapshot   (const char *path)
+{
+    if (path == NULL)
+        return NULL;
+
+    SnapshotReader reader(path);
+
+    if (this->arenaAllocation)
+    {
+        Arena *arena = new Arena();
+        reader.SetArena(arena);
+        arena->Release();
+    }
+
+    return reader.BuildMPD();
+}
+void            DASHManager::SetArenaAllocation         (bool enable)
+{
+    this->arenaAllocation = enable;
+}
+void            DASHManager::SetPeriodConversionThreads (size_t threads)
+{
+    this->periodConversionThreads = threads;
+}
+void            DASHManager::AttachBuildObserver        (IMPDBuildObserver *observer)
+{
+    this->buildObservers.push_back(observer);
+}
+void            DASHManager::DetachBuildObserver        (IMPDBuildObserver *observer)
+{
+    for (size_t i = 0; i < this->buildObservers.size(); i++)
+    {
+        if (this->buildObservers.at(i) == observer)
+        {
+            this->buildObservers.erase(this->buildObservers.begin() + i);
+            return;
+        }
+    }
+}
+void            DASHManager::SetFetchTimeout            (uint32_t milliseconds)
+{
+    this->fetcher.SetTimeout(milliseconds);
+}
+IRefreshReport* DASHManager::RefreshWithPatch   (MPD *mpd, const ParseOptions &options)
+{
+    if (mpd->GetPatchLocations().empty() || mpd->GetMPDPathBaseUrl() == NULL)
+        return NULL;
+
+    const IPatchLocation    *location   = mpd->GetPatchLocations().at(0);
+    const DateTime          &published  = mpd->GetPublishTimeValue();
+
+    /* the location expires ttl seconds after the MPD has been published */
+    if (location->GetTTL() > 0 && published.isValid && Time::GetCurrentUTCTimeInSec() > published.GetEpochSeconds() + location->GetTTL())
+        return NULL;
+
+    /* the location is relative to the MPD, i.e. to the location it has been redirected to */
+    std::vector<IBaseUrl *> path(1, mpd->GetMPDPathBaseUrl());
+    ResolvedBaseUrl         *base   = mpd->ResolveBaseUrl(path);
+    std::string             url     = base->Resolve(location->GetUrl());
+
+    delete base;
+
+    ManifestTransfer transfer(url);
+
+    if (!this->fetcher.Fetch(transfer) || transfer.IsNotModified() || transfer.GetData().empty())
+        return NULL;
+
+    return this->ApplyPatch(mpd, transfer.GetData().data(), transfer.GetData().size(), options);
+}
+void            DASHManager::SetXLinkParallelism        (size_t connections)
+{
+    this->xlinkParallelism = connections;
+}
+void            DASHManager::SetXLinkCacheTime          (uint32_t seconds)
+{
+    this->xlinkCache.SetTimeToLive(seconds);
+}
+bool            DASHManager::ResolveXLink               (IMPD *mpd, IMPDElement *element)
+{
+    MPD *current = dynamic_cast<MPD *>(mpd);
+
+    if (current == NULL || element == NULL)
+        return false;
+
+    XLinkResolver resolver(&this->fetcher, &this->xlinkCache, this->xlinkParallelism);
+
+    return resolver.Resolve(current, element);
+}
 void            DASHManager::Delete ()
 {
     delete this;
@@ -16,8 +16,19 @@
 
 #include "../xml/Node.h"
 #include "../xml/DOMParser.h"
+#include "../xml/SnapshotReader.h"
+#include "../xml/SnapshotWriter.h"
+#include "../xml/XLinkResolver.h"
+#include "../xml/PatchDocument.h"
+#include "../network/ManifestFetcher.h"
+#include "../network/ManifestTransfer.h"
+#include "../network/FragmentCache.h"
 #include "IDASHManager.h"
+#include "MPDRequest.h"
 #include "../helpers/Time.h"
+#include "../helpers/GlobalState.h"
+#include "../mpd/RefreshReport.h"
+#include "../portable/MemoryMapping.h"
 
 namespace dash
 {
@@ -28,7 +39,58 @@ namespace dash
             virtual ~DASHManager    ();
 
             mpd::IMPD*  Open    (char *path);
+            mpd::IMPD*  Open    (const char *data, size_t length, const std::string &baseUrl);
+            mpd::IMPD*  Open    (const char *path, const std::string &baseUrl);
+            mpd::IMPD*  Open    (char *path, const ParseOptions &options);
+            mpd::IMPD*  Open    (const char *data, size_t length, const std::string &baseUrl, const ParseOptions &options);
+            mpd::IMPD*  Open    (const char *path, const std::string &baseUrl, const ParseOptions &options);
             void        Delete  ();
+
+            IMPDRequest*    OpenAsync   (const char *url);
+            IMPDRequest*    OpenAsync   (const char *url, const ParseOptions &options);
+
+            /*
+             *  Fetches the MPD of the transfer over HTTP or reads it from a local file, used by the threads of the MPDRequests as well.
+             */
+            mpd::IMPD*      Open        (network::ManifestTransfer &transfer, const ParseOptions &options);
+
+            void        SetArenaAllocation          (bool enable);
+            void        SetPeriodConversionThreads  (size_t threads);
+            void        AttachBuildObserver         (IMPDBuildObserver *observer);
+            void        DetachBuildObserver         (IMPDBuildObserver *observer);
+            void        SetFetchTimeout             (uint32_t milliseconds);
+            void        SetXLinkParallelism         (size_t connections);
+            void        SetXLinkCacheTime           (uint32_t seconds);
+
+            bool        ResolveXLink    (mpd::IMPD *mpd, mpd::IMPDElement *element);
+
+            mpd::IRefreshReport*    Refresh (mpd::IMPD *mpd, char *path);
+            mpd::IRefreshReport*    Refresh (mpd::IMPD *mpd, const char *data, size_t length, const std::string &baseUrl);
+            mpd::IRefreshReport*    Refresh (mpd::IMPD *mpd, char *path, const ParseOptions &options);
+            mpd::IRefreshReport*    Refresh (mpd::IMPD *mpd, const char *data, size_t length, const std::string &baseUrl, const ParseOptions &options);
+
+            mpd::IRefreshReport*    ApplyPatch  (mpd::IMPD *mpd, const char *data, size_t length);
+            mpd::IRefreshReport*    ApplyPatch  (mpd::IMPD *mpd, const char *data, size_t length, const ParseOptions &options);
+
+            bool        WriteSnapshot   (mpd::IMPD *mpd, const char *path);
+            mpd::IMPD*  OpenSnapshot    (const char *path);
+
+        private:
+            mpd::MPD*               Open    (xml::DOMParser &parser, const ParseOptions &options);
+            mpd::IRefreshReport*    Refresh (mpd::IMPD *mpd, xml::DOMParser &parser, const ParseOptions &options);
+
+            /*
+             *  Fetches the patch the MPD announces and applies it, NULL is returned if the MPD has to be fetched completely.
+             */
+            mpd::IRefreshReport*    RefreshWithPatch    (mpd::MPD *mpd, const ParseOptions &options);
+
+            bool    arenaAllocation;
+            size_t  periodConversionThreads;
+            size_t  xlinkParallelism;
+
+            std::vector<IMPDBuildObserver *>    buildObservers;
+            network::ManifestFetcher            fetcher;
+            network::FragmentCache              xlinkCache;
     };
 }
 
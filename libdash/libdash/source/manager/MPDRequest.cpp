@@ -0,0 +1,107 @@
+/*
+ * MPDRequest.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "MPDRequest.h"
+#include "DASHManager.h"
+
+using namespace dash;
+using namespace dash::mpd;
+using namespace dash::network;
+
+MPDRequest::MPDRequest  (DASHManager *manager, const std::string &url, const ParseOptions &options) :
+            manager     (manager),
+            options     (options),
+            transfer    (url),
+            thread      (NULL),
+            mpd         (NULL),
+            isCompleted (false),
+            isCanceled  (false)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+    InitializeConditionVariable(&this->completed);
+}
+MPDRequest::~MPDRequest ()
+{
+    if (this->thread)
+    {
+        this->Cancel();
+        JoinThread(this->thread);
+        DestroyThreadPortable(this->thread);
+    }
+
+    delete this->mpd;
+
+    DeleteConditionVariable(&this->completed);
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+bool    MPDRequest::Start       ()
+{
+    this->thread = CreateThreadPortable(Run, this);
+
+    return this->thread != NULL;
+}
+IMPD*   MPDRequest::Wait        ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    while (!this->isCompleted)
+        SleepConditionVariableCS(&this->completed, &this->monitorMutex, INFINITE);
+
+    IMPD *mpd = this->mpd;
+    this->mpd = NULL;
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return mpd;
+}
+bool    MPDRequest::IsCompleted ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    bool completed = this->isCompleted;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return completed;
+}
+void    MPDRequest::Cancel      ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    if (!this->isCompleted)
+    {
+        this->isCanceled = true;
+        this->transfer.Cancel();
+    }
+
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void*   MPDRequest::Run         (void *mpdRequest)
+{
+    MPDRequest  *request    = (MPDRequest *) mpdRequest;
+    IMPD        *mpd        = request->manager->Open(request->transfer, request->options);
+
+    EnterCriticalSection(&request->monitorMutex);
+
+    /* the MPD might have been parsed already when the request has been canceled */
+    if (request->isCanceled)
+    {
+        delete mpd;
+        mpd = NULL;
+    }
+
+    request->mpd            = mpd;
+    request->isCompleted    = true;
+
+    WakeAllConditionVariable(&request->completed);
+    LeaveCriticalSection(&request->monitorMutex);
+
+    return NULL;
+}
@@ -0,0 +1,56 @@
+/*
+ * MPDRequest.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MPDREQUEST_H_
+#define MPDREQUEST_H_
+
+#include "config.h"
+
+#include "IMPDRequest.h"
+#include "ParseOptions.h"
+#include "../network/ManifestTransfer.h"
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    class DASHManager;
+
+    class MPDRequest : public IMPDRequest
+    {
+        public:
+            MPDRequest          (DASHManager *manager, const std::string &url, const ParseOptions &options);
+            virtual ~MPDRequest ();
+
+            mpd::IMPD*  Wait        ();
+            bool        IsCompleted ();
+            void        Cancel      ();
+
+            /*
+             *  Starts the thread that fetches and builds the MPD, returns false if it could not be created.
+             */
+            bool        Start       ();
+
+        private:
+            static void*    Run     (void *request);
+
+            DASHManager                 *manager;
+            ParseOptions                options;
+            network::ManifestTransfer   transfer;
+            THREAD_HANDLE               thread;
+            mpd::IMPD                   *mpd;
+            bool                        isCompleted;
+            bool                        isCanceled;
+            CRITICAL_SECTION            monitorMutex;
+            CONDITION_VARIABLE          completed;
+    };
+}
+
+#endif /* MPDREQUEST_H_ */
@@ -13,29 +13,87 @@
 
 using namespace dash::mpd;
 using namespace dash::xml;
+using namespace dash::helpers;
 
-AbstractMPDElement::AbstractMPDElement      ()
+AbstractMPDElement::AbstractMPDElement      () :
+                    rawAttributeMap         (NULL),
+                    digest                  (0)
 {
 }
 AbstractMPDElement::~AbstractMPDElement     ()
 {
     for(size_t i = 0; i < this->additionalSubNodes.size(); i++)
         delete(this->additionalSubNodes.at(i));
+
+    delete(this->rawAttributeMap);
 }
 
-const std::vector<INode *>                  AbstractMPDElement::GetAdditionalSubNodes   ()  const
+const std::vector<INode *>&                 AbstractMPDElement::GetAdditionalSubNodes   ()  const
 {
     return this->additionalSubNodes;
 }
-const std::map<std::string, std::string>    AbstractMPDElement::GetRawAttributes        ()  const
+const std::map<std::string, std::string>&   AbstractMPDElement::GetRawAttributes        ()  const
+{
+    LazyLock::Enter();
+
+    if (this->rawAttributeMap == NULL)
+    {
+        std::map<std::string, std::string> *map = new std::map<std::string, std::string>();
+
+        for (size_t i = 0; i < this->rawAttributes.size(); i++)
+            map->insert(std::make_pair(this->rawAttributes.at(i).first.Get(), this->rawAttributes.at(i).second.Get()));
+
+        this->rawAttributeMap = map;
+    }
+
+    const std::map<std::string, std::string> &map = *this->rawAttributeMap;
+    LazyLock::Leave();
+
+    return map;
+}
+size_t                                      AbstractMPDElement::GetRawAttributeCount    ()  const
+{
+    return this->rawAttributes.size();
+}
+const std::string&                          AbstractMPDElement::GetRawAttributeKey      (size_t index)  const
+{
+    return this->rawAttributes.at(index).first.Get();
+}
+const std::string&                          AbstractMPDElement::GetRawAttributeValue    (size_t index)  const
 {
-    return this->rawAttributes;
+    return this->rawAttributes.at(index).second.Get();
 }
 void                                        AbstractMPDElement::AddAdditionalSubNode    (INode *node)
 {
     this->additionalSubNodes.push_back(node);
 }
-void                                        AbstractMPDElement::AddRawAttributes        (std::map<std::string, std::string> attributes)
+void                                        AbstractMPDElement::AddRawAttributes        (const InternedAttributes &attributes)
 {
     this->rawAttributes = attributes;
+
+    delete(this->rawAttributeMap);
+    this->rawAttributeMap = NULL;
+}
+bool                                        AbstractMPDElement::HasRawAttribute         (const std::string &key)    const
+{
+    for (size_t i = 0; i < this->rawAttributes.size(); i++)
+        if (this->rawAttributes.at(i).first.Get() == key)
+            return true;
+
+    return false;
+}
+uint64_t                                    AbstractMPDElement::GetDigest               ()  const
+{
+    return this->digest;
+}
+void                                        AbstractMPDElement::SetDigest               (uint64_t digest)
+{
+    this->digest = digest;
+}
+void                                        AbstractMPDElement::SwapElement             (AbstractMPDElement &other)
+{
+    std::swap(this->additionalSubNodes, other.additionalSubNodes);
+    std::swap(this->rawAttributes, other.rawAttributes);
+    std::swap(this->rawAttributeMap, other.rawAttributeMap);
+    std::swap(this->digest, other.digest);
 }
\ No newline at end of file
@@ -15,25 +15,41 @@
 #include "config.h"
 
 #include "IMPDElement.h"
+#include "../helpers/StringPool.h"
+#include "../helpers/Arena.h"
+#include "../helpers/LazyLock.h"
 
 namespace dash
 {
     namespace mpd
     {
-        class AbstractMPDElement : public virtual IMPDElement
+        class AbstractMPDElement : public virtual IMPDElement, public helpers::ArenaAllocated
         {
             public:
                 AbstractMPDElement          ();
                 virtual ~AbstractMPDElement ();
 
-                virtual const std::vector<xml::INode *>             GetAdditionalSubNodes   ()  const;
-                virtual const std::map<std::string, std::string>    GetRawAttributes        ()  const;
+                virtual const std::vector<xml::INode *>&            GetAdditionalSubNodes   ()  const;
+                virtual const std::map<std::string, std::string>&   GetRawAttributes        ()  const;
+                virtual size_t                                      GetRawAttributeCount    ()  const;
+                virtual const std::string&                          GetRawAttributeKey      (size_t index)  const;
+                virtual const std::string&                          GetRawAttributeValue    (size_t index)  const;
                 virtual void                                        AddAdditionalSubNode    (xml::INode * node);
-                virtual void                                        AddRawAttributes        (std::map<std::string, std::string> attributes);
+                virtual void                                        AddRawAttributes        (const helpers::InternedAttributes &attributes);
+                bool                                                HasRawAttribute         (const std::string &key)    const;
+                uint64_t                                            GetDigest               ()  const;
+                void                                                SetDigest               (uint64_t digest);
+
+            protected:
+                void                                                SwapElement             (AbstractMPDElement &other);
 
             private:
                 std::vector<xml::INode *>           additionalSubNodes;
-                std::map<std::string, std::string>  rawAttributes;
+                helpers::InternedAttributes         rawAttributes;
+
+                /* built by GetRawAttributes under the LazyLock, most elements are never asked for it */
+                mutable std::map<std::string, std::string>  *rawAttributeMap;
+                uint64_t                            digest;
         };
     }
 }
@@ -13,6 +13,7 @@
 #include <cstdlib>
 
 using namespace dash::mpd;
+using namespace dash::helpers;
 
 AdaptationSet::AdaptationSet    () :
                 segmentBase(NULL),
@@ -21,6 +22,7 @@ AdaptationSet::AdaptationSet    () :
                 xlinkHref(""),
                 xlinkActuate("onRequest"),
                 id(0),
+                group(0),
                 lang(""),
                 contentType(""),
                 par(""),
@@ -253,7 +255,8 @@ const std::string&                      AdaptationSet::GetMinFramerate
 }
 void                                    AdaptationSet::SetMinFramerate                  (const std::string& minFramerate)
 {
-    this->minFramerate = minFramerate;
+    this->minFramerate      = minFramerate;
+    this->minFramerateValue = String::ToFrameRate(minFramerate);
 }
 const std::string&                      AdaptationSet::GetMaxFramerate                  ()  const
 {
@@ -261,7 +264,16 @@ const std::string&                      AdaptationSet::GetMaxFramerate
 }
 void                                    AdaptationSet::SetMaxFramerate                  (const std::string& maxFramerate)
 {
-    this->maxFramerate = maxFramerate;
+    this->maxFramerate      = maxFramerate;
+    this->maxFramerateValue = String::ToFrameRate(maxFramerate);
+}
+const FrameRate&                        AdaptationSet::GetMinFramerateValue             ()  const
+{
+    return this->minFramerateValue;
+}
+const FrameRate&                        AdaptationSet::GetMaxFramerateValue             ()  const
+{
+    return this->maxFramerateValue;
 }
 bool                                    AdaptationSet::SegmentAlignmentIsBoolValue      () const
 {
@@ -341,3 +353,48 @@ void                                    AdaptationSet::SetBitstreamSwitching
 {
     this->isBitstreamSwitching = value;
 }
+void                                    AdaptationSet::Refresh                          (AdaptationSet *update, RefreshReport &report)
+{
+    if (this->GetDigest() != update->GetDigest())
+    {
+        this->SwapElement(*update);
+        this->SwapRepresentationBase(*update);
+        std::swap(this->accessibility,              update->accessibility);
+        std::swap(this->role,                       update->role);
+        std::swap(this->rating,                     update->rating);
+        std::swap(this->viewpoint,                  update->viewpoint);
+        std::swap(this->contentComponent,           update->contentComponent);
+        std::swap(this->baseURLs,                   update->baseURLs);
+        std::swap(this->xlinkHref,                  update->xlinkHref);
+        std::swap(this->xlinkActuate,               update->xlinkActuate);
+        std::swap(this->id,                         update->id);
+        std::swap(this->group,                      update->group);
+        std::swap(this->lang,                       update->lang);
+        std::swap(this->contentType,                update->contentType);
+        std::swap(this->par,                        update->par);
+        std::swap(this->minBandwidth,               update->minBandwidth);
+        std::swap(this->maxBandwidth,               update->maxBandwidth);
+        std::swap(this->minWidth,                   update->minWidth);
+        std::swap(this->maxWidth,                   update->maxWidth);
+        std::swap(this->minHeight,                  update->minHeight);
+        std::swap(this->maxHeight,                  update->maxHeight);
+        std::swap(this->minFramerate,               update->minFramerate);
+        std::swap(this->maxFramerate,               update->maxFramerate);
+        std::swap(this->minFramerateValue,          update->minFramerateValue);
+        std::swap(this->maxFramerateValue,          update->maxFramerateValue);
+        std::swap(this->segmentAlignmentIsBool,     update->segmentAlignmentIsBool);
+        std::swap(this->subsegmentAlignmentIsBool,  update->subsegmentAlignmentIsBool);
+        std::swap(this->usesSegmentAlignment,       update->usesSegmentAlignment);
+        std::swap(this->usesSubsegmentAlignment,    update->usesSubsegmentAlignment);
+        std::swap(this->segmentAlignment,           update->segmentAlignment);
+        std::swap(this->subsegmentAlignment,        update->subsegmentAlignment);
+        std::swap(this->subsegmentStartsWithSAP,    update->subsegmentStartsWithSAP);
+        std::swap(this->isBitstreamSwitching,       update->isBitstreamSwitching);
+        report.AddUpdatedElement(this);
+    }
+
+    RefreshElement(this->segmentBase,       update->segmentBase,        report);
+    RefreshElement(this->segmentList,       update->segmentList,        report);
+    RefreshElement(this->segmentTemplate,   update->segmentTemplate,    report);
+    RefreshElements(this->representation,   update->representation,     report);
+}
\ No newline at end of file
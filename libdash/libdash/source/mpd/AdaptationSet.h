@@ -58,6 +58,8 @@ namespace dash
                 uint32_t                                GetMaxHeight                    ()  const;
                 const std::string&                      GetMinFramerate                 ()  const;
                 const std::string&                      GetMaxFramerate                 ()  const;
+                const FrameRate&                        GetMinFramerateValue            ()  const;
+                const FrameRate&                        GetMaxFramerateValue            ()  const;
                 bool                                    SegmentAlignmentIsBoolValue     ()  const;
                 bool                                    HasSegmentAlignment             ()  const;
                 uint32_t                                GetSegmentAligment              ()  const;
@@ -97,6 +99,13 @@ namespace dash
                 void    SetSubsegmentStartsWithSAP  (uint8_t subsegmentStartsWithSAP);
                 void    SetBitstreamSwitching       (bool value);
 
+                /*
+                 *  Takes over the attributes and sub elements of the given AdaptationSet if they differ, refreshes
+                 *  the segment information in place and matches the Representations by their id.
+                 *  The update is deleted by the caller afterwards.
+                 */
+                void    Refresh                     (AdaptationSet *update, RefreshReport &report);
+
             private:
                 std::vector<Descriptor *>       accessibility;
                 std::vector<Descriptor *>       role;
@@ -123,6 +132,8 @@ namespace dash
                 uint32_t                        maxHeight;
                 std::string                     minFramerate;
                 std::string                     maxFramerate;
+                FrameRate                       minFramerateValue;
+                FrameRate                       maxFramerateValue;
                 bool                            segmentAlignmentIsBool;
                 bool                            subsegmentAlignmentIsBool;
                 bool                            usesSegmentAlignment;
@@ -0,0 +1,279 @@
+/*
+ * CompiledURLTemplate.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "CompiledURLTemplate.h"
+
+#include <cstdlib>
+#include <algorithm>
+
+using namespace dash::mpd;
+
+const uint32_t CompiledURLTemplate::MAXDIGITS;
+
+CompiledURLTemplate::CompiledURLTemplate    () :
+                     fixedLength            (0),
+                     representationIDs      (0)
+{
+}
+CompiledURLTemplate::~CompiledURLTemplate   ()
+{
+}
+
+void        CompiledURLTemplate::Compile        (const std::string &templ)
+{
+    this->tokens.clear();
+    this->literals.clear();
+    this->fixedLength       = 0;
+    this->representationIDs = 0;
+
+    size_t first = 0;
+
+    while (first < templ.size())
+    {
+        size_t open = templ.find('$', first);
+
+        if (open == std::string::npos)
+            break;
+
+        size_t close = templ.find('$', open + 1);
+
+        /* a dollar sign without a closing one is not an identifier */
+        if (close == std::string::npos)
+            break;
+
+        this->AddLiteral(templ.data() + first, open - first);
+
+        if (close == open + 1)
+            this->AddLiteral("$", 1);
+        else
+            this->AddIdentifier(templ.substr(open + 1, close - open - 1));
+
+        first = close + 1;
+    }
+
+    this->AddLiteral(templ.data() + first, templ.size() - first);
+}
+void        CompiledURLTemplate::Swap           (CompiledURLTemplate &other)
+{
+    this->tokens.swap(other.tokens);
+    this->literals.swap(other.literals);
+    std::swap(this->fixedLength,        other.fixedLength);
+    std::swap(this->representationIDs,  other.representationIDs);
+}
+bool        CompiledURLTemplate::HasNumber      ()  const
+{
+    for (size_t i = 0; i < this->tokens.size(); i++)
+        if (this->tokens[i].type == Number)
+            return true;
+
+    return false;
+}
+bool        CompiledURLTemplate::HasTime        ()  const
+{
+    for (size_t i = 0; i < this->tokens.size(); i++)
+        if (this->tokens[i].type == Time)
+            return true;
+
+    return false;
+}
+size_t      CompiledURLTemplate::GetMaxLength   (size_t representationIDLength)    const
+{
+    return this->fixedLength + this->representationIDs * representationIDLength;
+}
+size_t      CompiledURLTemplate::Render         (char *buffer, const std::string &representationID, uint32_t bandwidth, uint64_t number, uint64_t time)  const
+{
+    char *out = buffer;
+
+    for (size_t i = 0; i < this->tokens.size(); i++)
+    {
+        const Token &token = this->tokens[i];
+
+        switch (token.type)
+        {
+            case Literal:
+                memcpy(out, this->literals.data() + token.offset, token.length);
+                out += token.length;
+                break;
+            case RepresentationID:
+                memcpy(out, representationID.data(), representationID.size());
+                out += representationID.size();
+                break;
+            case Number:
+                out += WriteNumber(out, number, token.length);
+                break;
+            case Bandwidth:
+                out += WriteNumber(out, bandwidth, token.length);
+                break;
+            case Time:
+                out += WriteNumber(out, time, token.length);
+                break;
+        }
+    }
+
+    return out - buffer;
+}
+std::string CompiledURLTemplate::Render         (const std::string &representationID, uint32_t bandwidth, uint64_t number, uint64_t time)  const
+{
+    /* a template without identifiers is its only literal */
+    if (this->tokens.size() == 1 && this->tokens[0].type == Literal)
+        return this->literals;
+
+    std::string uri(this->GetMaxLength(representationID.size()), '\0');
+
+    if (uri.empty())
+        return uri;
+
+    uri.resize(this->Render(&uri[0], representationID, bandwidth, number, time));
+    return uri;
+}
+void        CompiledURLTemplate::Bind           (const std::string &representationID, uint32_t bandwidth, CompiledURLTemplate &bound)  const
+{
+    bound.tokens.clear();
+    bound.literals.clear();
+    bound.fixedLength       = 0;
+    bound.representationIDs = 0;
+
+    bound.tokens.reserve(this->tokens.size());
+    bound.literals.reserve(this->GetMaxLength(representationID.size()));
+
+    for (size_t i = 0; i < this->tokens.size(); i++)
+    {
+        const Token &token = this->tokens[i];
+        char        digits[MAXDIGITS + 255];
+
+        switch (token.type)
+        {
+            case Literal:
+                bound.AddLiteral(this->literals.data() + token.offset, token.length);
+                break;
+            case RepresentationID:
+                bound.AddLiteral(representationID.data(), representationID.size());
+                break;
+            case Bandwidth:
+                bound.AddLiteral(digits, WriteNumber(digits, bandwidth, token.length));
+                break;
+            default:
+                bound.tokens.push_back(token);
+                bound.fixedLength += token.length > MAXDIGITS ? token.length : MAXDIGITS;
+                break;
+        }
+    }
+}
+void        CompiledURLTemplate::AddLiteral     (const char *literal, size_t length)
+{
+    if (length == 0)
+        return;
+
+    /* adjacent literals, e.g. around an escaped dollar sign, are copied in one piece */
+    if (this->tokens.size() && this->tokens.back().type == Literal)
+    {
+        this->tokens.back().length += (uint32_t) length;
+    }
+    else
+    {
+        Token token;
+
+        token.type      = Literal;
+        token.offset    = (uint32_t) this->literals.size();
+        token.length    = (uint32_t) length;
+
+        this->tokens.push_back(token);
+    }
+
+    this->literals.append(literal, length);
+    this->fixedLength += length;
+}
+void        CompiledURLTemplate::AddIdentifier  (const std::string &identifier)
+{
+    size_t      percent = identifier.find('%');
+    std::string name    = identifier.substr(0, percent);
+    Token       token;
+
+    token.offset    = 0;
+    token.length    = 0;
+
+    if (name == "RepresentationID" && percent == std::string::npos)
+    {
+        token.type = RepresentationID;
+        this->tokens.push_back(token);
+        this->representationIDs++;
+        return;
+    }
+
+    if (name == "Number")
+        token.type = Number;
+    else if (name == "Bandwidth")
+        token.type = Bandwidth;
+    else if (name == "Time")
+        token.type = Time;
+    else
+    {
+        this->AddLiteral("$", 1);
+        this->AddLiteral(identifier.data(), identifier.size());
+        this->AddLiteral("$", 1);
+        return;
+    }
+
+    /* the format tag is %0[width]d, the width is bounded so that the length of a URL stays reasonable */
+    if (percent != std::string::npos && identifier.compare(percent, 2, "%0") == 0)
+    {
+        unsigned long width = strtoul(identifier.c_str() + percent + 2, NULL, 10);
+
+        token.length = (uint32_t) (width > 255 ? 255 : width);
+    }
+
+    this->tokens.push_back(token);
+    this->fixedLength += token.length > MAXDIGITS ? token.length : MAXDIGITS;
+}
+size_t      CompiledURLTemplate::WriteNumber    (char *buffer, uint64_t value, uint32_t width)
+{
+    static const char pairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                "8081828384858687888990919293949596979899";
+
+    static const uint64_t powers[] = { 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+                                       10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+                                       1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+                                       10000000000000000000ULL };
+
+    size_t count = 1;
+
+    while (count < MAXDIGITS && value >= powers[count - 1])
+        count++;
+
+    size_t  length  = width > count ? width : count;
+    char    *out    = buffer + length;
+
+    /* the digits are written from the back, two at a time */
+    while (value >= 100)
+    {
+        const char *pair = pairs + (value % 100) * 2;
+
+        value   /= 100;
+        *--out  = pair[1];
+        *--out  = pair[0];
+    }
+
+    if (value >= 10)
+    {
+        *--out  = pairs[value * 2 + 1];
+        *--out  = pairs[value * 2];
+    }
+    else
+    {
+        *--out  = (char) ('0' + value);
+    }
+
+    while (out > buffer)
+        *--out = '0';
+
+    return length;
+}
@@ -0,0 +1,92 @@
+/*
+ * CompiledURLTemplate.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef COMPILEDURLTEMPLATE_H_
+#define COMPILEDURLTEMPLATE_H_
+
+#include "config.h"
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace dash
+{
+    namespace mpd
+    {
+        /*
+         *  A template of a SegmentTemplate attribute that has been split into its literal parts and identifiers once,
+         *  so that URLs are rendered without parsing the template again. $$ is stored as a literal dollar sign, the
+         *  width of a %0[width]d format tag is kept with the identifier. Identifiers that are not defined by the
+         *  standard are kept as they are written, including their dollar signs.
+         */
+        class CompiledURLTemplate
+        {
+            public:
+                CompiledURLTemplate             ();
+                virtual ~CompiledURLTemplate    ();
+
+                void        Compile             (const std::string &templ);
+                void        Swap                (CompiledURLTemplate &other);
+
+                bool        HasNumber           ()  const;
+                bool        HasTime             ()  const;
+
+                /*
+                 *  The URL is never longer than this for a representation ID of the given length.
+                 */
+                size_t      GetMaxLength        (size_t representationIDLength)    const;
+
+                /*
+                 *  Writes the URL to the buffer, which has to hold GetMaxLength characters, and returns its length.
+                 *  The URL is not terminated.
+                 */
+                size_t      Render              (char *buffer, const std::string &representationID, uint32_t bandwidth, uint64_t number, uint64_t time)  const;
+                std::string Render              (const std::string &representationID, uint32_t bandwidth, uint64_t number, uint64_t time)  const;
+
+                /*
+                 *  Compiles a copy of the template into bound in which $RepresentationID$ and $Bandwidth$ are replaced by the
+                 *  given values, so that the URLs of a range only render the Segment number and time.
+                 */
+                void        Bind                (const std::string &representationID, uint32_t bandwidth, CompiledURLTemplate &bound)  const;
+
+            private:
+                enum TokenType
+                {
+                    Literal,
+                    RepresentationID,
+                    Number,
+                    Bandwidth,
+                    Time
+                };
+
+                struct Token
+                {
+                    TokenType   type;
+                    uint32_t    offset;     /* of a literal in the literals */
+                    uint32_t    length;     /* of a literal, the minimum number of digits of an identifier */
+                };
+
+                static const uint32_t MAXDIGITS = 20;
+
+                void            AddLiteral      (const char *literal, size_t length);
+                void            AddIdentifier   (const std::string &identifier);
+                static size_t   WriteNumber     (char *buffer, uint64_t value, uint32_t width);
+
+                std::vector<Token>  tokens;
+                std::string         literals;
+                size_t              fixedLength;
+                size_t              representationIDs;
+        };
+    }
+}
+
+#endif /* COMPILEDURLTEMPLATE_H_ */
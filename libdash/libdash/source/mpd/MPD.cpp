@@ -13,6 +13,8 @@
 
 using namespace dash::mpd;
 using namespace dash::metrics;
+using namespace dash::helpers;
+using namespace dash::network;
 
 MPD::MPD    () :
         id(""),
@@ -25,7 +27,12 @@ MPD::MPD    () :
         timeShiftBufferDepth(""),
         suggestedPresentationDelay(""),
         maxSegmentDuration(""),
-        maxSubsegmentDuration("")
+        maxSubsegmentDuration(""),
+        mpdPathBaseUrl(NULL),
+        fetchTime(0),
+        stringPool(NULL),
+        arena(NULL),
+        rawAttributesRetained(true)
 {
 }
 MPD::~MPD   ()
@@ -38,6 +45,18 @@ MPD::~MPD   ()
         delete(this->periods.at(i));
     for(size_t i = 0; i < this->baseUrls.size(); i++)
         delete(this->baseUrls.at(i));
+    for(size_t i = 0; i < this->patchLocations.size(); i++)
+        delete(this->patchLocations.at(i));
+
+    delete(this->mpdPathBaseUrl);
+
+    /* the pool deletes itself once the handles of the base classes have been released */
+    if (this->stringPool)
+        this->stringPool->Release();
+
+    /* the elements have been destructed above, the memory they occupy is freed with the arena */
+    if (this->arena)
+        this->arena->Release();
 }
 
 const std::vector<IProgramInformation *>&   MPD::GetProgramInformations             () const 
@@ -64,6 +83,14 @@ void                                        MPD::AddLocation
 {
     this->locations.push_back(location);
 }
+const std::vector<IPatchLocation *>&        MPD::GetPatchLocations                  () const
+{
+    return (std::vector<IPatchLocation *> &) this->patchLocations;
+}
+void                                        MPD::AddPatchLocation                   (PatchLocation *patchLocation)
+{
+    this->patchLocations.push_back(patchLocation);
+}
 const std::vector<IPeriod*>&                MPD::GetPeriods                         () const 
 {
     return (std::vector<IPeriod*> &) this->periods;
@@ -72,6 +99,19 @@ void                                        MPD::AddPeriod
 {
     this->periods.push_back(period);
 }
+bool                                        MPD::ReplacePeriod                      (Period *period, const std::vector<Period *> &replacements)
+{
+    std::vector<Period *>::iterator it = std::find(this->periods.begin(), this->periods.end(), period);
+
+    if (it == this->periods.end())
+        return false;
+
+    it = this->periods.erase(it);
+    this->periods.insert(it, replacements.begin(), replacements.end());
+
+    delete period;
+    return true;
+}
 const std::vector<IMetrics *>&              MPD::GetMetrics                         () const 
 {
     return (std::vector<IMetrics *> &) this->metrics;
@@ -104,13 +144,31 @@ void                                        MPD::SetType
 {
     this->type = type;
 }
+const std::string&                          MPD::GetPublishTime                     ()  const
+{
+    return this->publishTime;
+}
+void                                        MPD::SetPublishTime                     (const std::string& publishTime)
+{
+    this->publishTime      = publishTime;
+    this->publishTimeValue = String::ToDateTime(publishTime);
+}
+const DateTime&                             MPD::GetPublishTimeValue                ()  const
+{
+    return this->publishTimeValue;
+}
 const std::string&                          MPD::GetAvailabilityStarttime           ()  const
 {
     return this->availabilityStarttime;
 }
 void                                        MPD::SetAvailabilityStarttime           (const std::string& availabilityStarttime)
 {
-    this->availabilityStarttime = availabilityStarttime;
+    this->availabilityStarttime      = availabilityStarttime;
+    this->availabilityStarttimeValue = String::ToDateTime(availabilityStarttime);
+}
+const DateTime&                             MPD::GetAvailabilityStarttimeValue      ()  const
+{
+    return this->availabilityStarttimeValue;
 }
 const std::string&                          MPD::GetAvailabilityEndtime             ()  const
 {
@@ -118,7 +176,12 @@ const std::string&                          MPD::GetAvailabilityEndtime
 }
 void                                        MPD::SetAvailabilityEndtime             (const std::string& availabilityEndtime)
 {
-    this->availabilityEndtime = availabilityEndtime;
+    this->availabilityEndtime      = availabilityEndtime;
+    this->availabilityEndtimeValue = String::ToDateTime(availabilityEndtime);
+}
+const DateTime&                             MPD::GetAvailabilityEndtimeValue        ()  const
+{
+    return this->availabilityEndtimeValue;
 }
 const std::string&                          MPD::GetMediaPresentationDuration       ()  const
 {
@@ -126,7 +189,12 @@ const std::string&                          MPD::GetMediaPresentationDuration
 }
 void                                        MPD::SetMediaPresentationDuration       (const std::string& mediaPresentationDuration)
 {
-    this->mediaPresentationDuration = mediaPresentationDuration;
+    this->mediaPresentationDuration      = mediaPresentationDuration;
+    this->mediaPresentationDurationValue = String::ToDuration(mediaPresentationDuration);
+}
+const Duration&                             MPD::GetMediaPresentationDurationValue  ()  const
+{
+    return this->mediaPresentationDurationValue;
 }
 const std::string&                          MPD::GetMinimumUpdatePeriod             ()  const
 {
@@ -134,7 +202,12 @@ const std::string&                          MPD::GetMinimumUpdatePeriod
 }
 void                                        MPD::SetMinimumUpdatePeriod             (const std::string& minimumUpdatePeriod)
 {
-    this->minimumUpdatePeriod = minimumUpdatePeriod;
+    this->minimumUpdatePeriod      = minimumUpdatePeriod;
+    this->minimumUpdatePeriodValue = String::ToDuration(minimumUpdatePeriod);
+}
+const Duration&                             MPD::GetMinimumUpdatePeriodValue        ()  const
+{
+    return this->minimumUpdatePeriodValue;
 }
 const std::string&                          MPD::GetMinBufferTime                   ()  const
 {
@@ -142,7 +215,12 @@ const std::string&                          MPD::GetMinBufferTime
 }
 void                                        MPD::SetMinBufferTime                   (const std::string& minBufferTime)
 {
-    this->minBufferTime = minBufferTime;
+    this->minBufferTime      = minBufferTime;
+    this->minBufferTimeValue = String::ToDuration(minBufferTime);
+}
+const Duration&                             MPD::GetMinBufferTimeValue              ()  const
+{
+    return this->minBufferTimeValue;
 }
 const std::string&                          MPD::GetTimeShiftBufferDepth            ()  const
 {
@@ -150,7 +228,12 @@ const std::string&                          MPD::GetTimeShiftBufferDepth
 }
 void                                        MPD::SetTimeShiftBufferDepth            (const std::string& timeShiftBufferDepth)
 {
-    this->timeShiftBufferDepth = timeShiftBufferDepth;
+    this->timeShiftBufferDepth      = timeShiftBufferDepth;
+    this->timeShiftBufferDepthValue = String::ToDuration(timeShiftBufferDepth);
+}
+const Duration&                             MPD::GetTimeShiftBufferDepthValue       ()  const
+{
+    return this->timeShiftBufferDepthValue;
 }
 const std::string&                          MPD::GetSuggestedPresentationDelay      ()  const
 {
@@ -158,7 +241,12 @@ const std::string&                          MPD::GetSuggestedPresentationDelay
 }
 void                                        MPD::SetSuggestedPresentationDelay      (const std::string& suggestedPresentationDelay)
 {
-    this->suggestedPresentationDelay = suggestedPresentationDelay;
+    this->suggestedPresentationDelay      = suggestedPresentationDelay;
+    this->suggestedPresentationDelayValue = String::ToDuration(suggestedPresentationDelay);
+}
+const Duration&                             MPD::GetSuggestedPresentationDelayValue ()  const
+{
+    return this->suggestedPresentationDelayValue;
 }
 const std::string&                          MPD::GetMaxSegmentDuration              ()  const
 {
@@ -166,7 +254,12 @@ const std::string&                          MPD::GetMaxSegmentDuration
 }
 void                                        MPD::SetMaxSegmentDuration              (const std::string& maxSegmentDuration)
 {
-    this->maxSegmentDuration = maxSegmentDuration;
+    this->maxSegmentDuration      = maxSegmentDuration;
+    this->maxSegmentDurationValue = String::ToDuration(maxSegmentDuration);
+}
+const Duration&                             MPD::GetMaxSegmentDurationValue         ()  const
+{
+    return this->maxSegmentDurationValue;
 }
 const std::string&                          MPD::GetMaxSubsegmentDuration           ()  const
 {
@@ -174,7 +267,12 @@ const std::string&                          MPD::GetMaxSubsegmentDuration
 }
 void                                        MPD::SetMaxSubsegmentDuration           (const std::string& maxSubsegmentDuration)
 {
-    this->maxSubsegmentDuration = maxSubsegmentDuration;
+    this->maxSubsegmentDuration      = maxSubsegmentDuration;
+    this->maxSubsegmentDurationValue = String::ToDuration(maxSubsegmentDuration);
+}
+const Duration&                             MPD::GetMaxSubsegmentDurationValue      ()  const
+{
+    return this->maxSubsegmentDurationValue;
 }
 IBaseUrl*                                   MPD::GetMPDPathBaseUrl                  ()  const
 {
@@ -192,7 +290,187 @@ void                                        MPD::SetFetchTime
 {
     this->fetchTime = fetchTimeInSec;
 }
+const std::string&                          MPD::GetETag                            ()  const
+{
+    return this->eTag;
+}
+void                                        MPD::SetETag                            (const std::string& eTag)
+{
+    this->eTag = eTag;
+}
+const std::string&                          MPD::GetLastModified                    ()  const
+{
+    return this->lastModified;
+}
+void                                        MPD::SetLastModified                    (const std::string& lastModified)
+{
+    this->lastModified = lastModified;
+}
+ResolvedBaseUrl*                            MPD::ResolveBaseUrl                     (const std::vector<IBaseUrl *>& baseurls)   const
+{
+    std::string url             = "";
+    std::string serviceLocation = "";
+
+    for (size_t i = 0; i < baseurls.size(); i++)
+    {
+        std::string reference = baseurls.at(i)->GetUrl();
+
+        /* the path of the MPD is stored without its trailing slash */
+        if (baseurls.at(i) == this->mpdPathBaseUrl)
+            reference = this->GetMPDDirectory();
+
+        url             = (i == 0) ? reference : ResolvedBaseUrl::ResolveReference(url, reference);
+        serviceLocation = baseurls.at(i)->GetServiceLocation();
+    }
+
+    return new ResolvedBaseUrl(url, serviceLocation);
+}
+ResolvedBaseUrl*                            MPD::ResolveBaseUrl                     (IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation)   const
+{
+    std::vector<IBaseUrl *> baseurls;
+
+    if (this->mpdPathBaseUrl)
+        baseurls.push_back(this->mpdPathBaseUrl);
+    if (this->baseUrls.size() > 0)
+        baseurls.push_back(this->baseUrls.at(0));
+    if (period && period->GetBaseURLs().size() > 0)
+        baseurls.push_back(period->GetBaseURLs().at(0));
+    if (adaptationSet && adaptationSet->GetBaseURLs().size() > 0)
+        baseurls.push_back(adaptationSet->GetBaseURLs().at(0));
+    if (representation && representation->GetBaseURLs().size() > 0)
+        baseurls.push_back(representation->GetBaseURLs().at(0));
+
+    return this->ResolveBaseUrl(baseurls);
+}
+ISegmentEnumerator*                         MPD::CreateSegmentEnumerator            (IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation)   const
+{
+    return new SegmentEnumerator(this->ResolveBaseUrl(period, adaptationSet, representation), period, adaptationSet, representation,
+                                 this->GetPeriodDuration(period));
+}
+ISegmentIndex*                              MPD::LoadSegmentIndex                   (IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation)   const
+{
+    if (representation == NULL)
+        return NULL;
+
+    SegmentEnumerator   enumerator(this->ResolveBaseUrl(period, adaptationSet, representation), period, adaptationSet, representation,
+                                   this->GetPeriodDuration(period));
+    SegmentDescriptor   index;
+    SegmentDescriptor   media;
+    bool                hasIndex = false;
+    bool                hasMedia = false;
+
+    if (enumerator.IsOpenEnded() || enumerator.GetMediaSegmentCount() != 1)
+        return NULL;
+
+    while (!hasMedia && enumerator.Next(media))
+    {
+        if (media.type == IndexSegment)
+        {
+            index       = media;
+            hasIndex    = true;
+        }
 
+        hasMedia = media.type == MediaSegment;
+    }
+
+    /* the sidx boxes are only addressed relative to the Media Segment if they are a byte range of it */
+    if (!hasIndex || !hasMedia || !index.hasByteRange || index.url != media.url)
+        return NULL;
+
+    SegmentIndex *segmentIndex = new SegmentIndex(this->ResolveBaseUrl(period, adaptationSet, representation), media.url,
+                                                  media.presentationTimeOffset, media.timescale);
+
+    ManifestFetcher     fetcher;
+    SegmentIndexLoader  loader(&fetcher);
+
+    if (loader.Load(segmentIndex, index.firstByte, index.lastByte))
+        return segmentIndex;
+
+    delete(segmentIndex);
+
+    return NULL;
+}
+std::string                                 MPD::GetMPDDirectory                    ()  const
+{
+    const std::string &path = this->mpdPathBaseUrl->GetUrl();
+
+    if (path.find('/') == std::string::npos)
+        return "";
+
+    return path + "/";
+}
+Duration                                    MPD::GetPeriodDuration                  (IPeriod *period)   const
+{
+    Duration duration;
+
+    if (period == NULL)
+        return duration;
+
+    if (period->GetDurationValue().isValid)
+        return period->GetDurationValue();
+
+    int64_t start = period->GetStartValue().isValid ? period->GetStartValue().ticks : 0;
+
+    for (size_t i = 0; i < this->periods.size(); i++)
+    {
+        if (this->periods.at(i) != period)
+            continue;
+
+        if (i + 1 < this->periods.size())
+        {
+            duration        = this->periods.at(i + 1)->GetStartValue();
+            duration.ticks -= start;
+        }
+        else
+        {
+            duration        = this->mediaPresentationDurationValue;
+            duration.ticks -= start;
+        }
+
+        break;
+    }
+
+    duration.isValid = duration.isValid && duration.ticks > 0;
+
+    return duration;
+}
+
+StringPool*                                 MPD::GetStringPool                      ()  const
+{
+    return this->stringPool;
+}
+void                                        MPD::SetStringPool                      (StringPool *stringPool)
+{
+    if (stringPool)
+        stringPool->Retain();
+
+    if (this->stringPool)
+        this->stringPool->Release();
+
+    this->stringPool = stringPool;
+}
+Arena*                                      MPD::GetArena                           ()  const
+{
+    return this->arena;
+}
+void                                        MPD::SetArena                           (Arena *arena)
+{
+    if (arena)
+        arena->Retain();
+
+    if (this->arena)
+        this->arena->Release();
+
+    this->arena = arena;
+}
+bool                                        MPD::AreRawAttributesRetained           ()  const
+{
+    return this->rawAttributesRetained;
+}
+void                                        MPD::SetRawAttributesRetained           (bool retained)
+{
+    this->rawAttributesRetained = retained;
+}
 
 const std::vector<ITCPConnection *>&        MPD::GetTCPConnectionList    () const
 {
@@ -210,3 +488,56 @@ void                                        MPD::AddHTTPTransaction      (HTTPTr
 {
     this->httpTransactions.push_back(httpTransAct);
 }
+void                                        MPD::Refresh                            (MPD *update, RefreshReport &report)
+{
+    this->RefreshHeader(update, report);
+
+    RefreshElements(this->periods, update->periods, report);
+}
+void                                        MPD::RefreshHeader                      (MPD *update, RefreshReport &report)
+{
+    /* elements of an update without raw attributes can be swapped in anywhere below */
+    if (!update->rawAttributesRetained)
+        this->rawAttributesRetained = false;
+
+    if (this->GetDigest() != update->GetDigest())
+    {
+        this->SwapElement(*update);
+        std::swap(this->programInformations,              update->programInformations);
+        std::swap(this->baseUrls,                         update->baseUrls);
+        std::swap(this->locations,                        update->locations);
+        std::swap(this->patchLocations,                   update->patchLocations);
+        std::swap(this->metrics,                          update->metrics);
+        std::swap(this->id,                               update->id);
+        std::swap(this->profiles,                         update->profiles);
+        std::swap(this->type,                             update->type);
+        std::swap(this->publishTime,                      update->publishTime);
+        std::swap(this->publishTimeValue,                 update->publishTimeValue);
+        std::swap(this->availabilityStarttime,            update->availabilityStarttime);
+        std::swap(this->availabilityStarttimeValue,       update->availabilityStarttimeValue);
+        std::swap(this->availabilityEndtime,              update->availabilityEndtime);
+        std::swap(this->availabilityEndtimeValue,         update->availabilityEndtimeValue);
+        std::swap(this->mediaPresentationDuration,        update->mediaPresentationDuration);
+        std::swap(this->mediaPresentationDurationValue,   update->mediaPresentationDurationValue);
+        std::swap(this->minimumUpdatePeriod,              update->minimumUpdatePeriod);
+        std::swap(this->minimumUpdatePeriodValue,         update->minimumUpdatePeriodValue);
+        std::swap(this->minBufferTime,                    update->minBufferTime);
+        std::swap(this->minBufferTimeValue,               update->minBufferTimeValue);
+        std::swap(this->timeShiftBufferDepth,             update->timeShiftBufferDepth);
+        std::swap(this->timeShiftBufferDepthValue,        update->timeShiftBufferDepthValue);
+        std::swap(this->suggestedPresentationDelay,       update->suggestedPresentationDelay);
+        std::swap(this->suggestedPresentationDelayValue,  update->suggestedPresentationDelayValue);
+        std::swap(this->maxSegmentDuration,               update->maxSegmentDuration);
+        std::swap(this->maxSegmentDurationValue,          update->maxSegmentDurationValue);
+        std::swap(this->maxSubsegmentDuration,            update->maxSubsegmentDuration);
+        std::swap(this->maxSubsegmentDurationValue,       update->maxSubsegmentDurationValue);
+        report.AddUpdatedElement(this);
+    }
+
+    if (this->mpdPathBaseUrl == NULL || update->mpdPathBaseUrl == NULL || this->mpdPathBaseUrl->GetUrl() != update->mpdPathBaseUrl->GetUrl())
+        std::swap(this->mpdPathBaseUrl,                   update->mpdPathBaseUrl);
+}
+void                                        MPD::SwapPeriods                        (std::vector<Period *> &periods)
+{
+    this->periods.swap(periods);
+}
\ No newline at end of file
@@ -17,11 +17,16 @@
 #include "IMPD.h"
 #include "ProgramInformation.h"
 #include "BaseUrl.h"
+#include "ResolvedBaseUrl.h"
+#include "SegmentEnumerator.h"
+#include "SegmentIndex.h"
+#include "PatchLocation.h"
 #include "Period.h"
 #include "Metrics.h"
 #include "AbstractMPDElement.h"
 #include "../metrics/HTTPTransaction.h"
 #include "../metrics/TCPConnection.h"
+#include "../network/SegmentIndexLoader.h"
 
 namespace dash
 {
@@ -36,11 +41,13 @@ namespace dash
                 const std::vector<IProgramInformation *>&   GetProgramInformations          ()  const;
                 const std::vector<IBaseUrl *>&              GetBaseUrls                     ()  const;
                 const std::vector<std::string>&             GetLocations                    ()  const;
+                const std::vector<IPatchLocation *>&        GetPatchLocations               ()  const;
                 const std::vector<IPeriod *>&               GetPeriods                      ()  const;
                 const std::vector<IMetrics *>&              GetMetrics                      ()  const;
                 const std::string&                          GetId                           ()  const;
                 const std::vector<std::string>&             GetProfiles                     ()  const;
                 const std::string&                          GetType                         ()  const;
+                const std::string&                          GetPublishTime                  ()  const;
                 const std::string&                          GetAvailabilityStarttime        ()  const;
                 const std::string&                          GetAvailabilityEndtime          ()  const;
                 const std::string&                          GetMediaPresentationDuration    ()  const;
@@ -50,8 +57,27 @@ namespace dash
                 const std::string&                          GetSuggestedPresentationDelay   ()  const;
                 const std::string&                          GetMaxSegmentDuration           ()  const;
                 const std::string&                          GetMaxSubsegmentDuration        ()  const;
+                const DateTime&                             GetAvailabilityStarttimeValue      ()  const;
+                const DateTime&                             GetAvailabilityEndtimeValue        ()  const;
+                const DateTime&                             GetPublishTimeValue                ()  const;
+                const Duration&                             GetMediaPresentationDurationValue  ()  const;
+                const Duration&                             GetMinimumUpdatePeriodValue        ()  const;
+                const Duration&                             GetMinBufferTimeValue              ()  const;
+                const Duration&                             GetTimeShiftBufferDepthValue       ()  const;
+                const Duration&                             GetSuggestedPresentationDelayValue ()  const;
+                const Duration&                             GetMaxSegmentDurationValue         ()  const;
+                const Duration&                             GetMaxSubsegmentDurationValue      ()  const;
                 IBaseUrl*                                   GetMPDPathBaseUrl               ()  const;
                 uint32_t                                    GetFetchTime                    ()  const;
+                const std::string&                          GetETag                         ()  const;
+                const std::string&                          GetLastModified                 ()  const;
+                ResolvedBaseUrl*                            ResolveBaseUrl                  (const std::vector<IBaseUrl *>& baseurls)   const;
+                ResolvedBaseUrl*                            ResolveBaseUrl                  (IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                                             IRepresentation *representation)   const;
+                ISegmentEnumerator*                         CreateSegmentEnumerator         (IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                                             IRepresentation *representation)   const;
+                ISegmentIndex*                              LoadSegmentIndex                (IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                                             IRepresentation *representation)   const;
 
                 const std::vector<dash::metrics::ITCPConnection *>&     GetTCPConnectionList    () const;
                 const std::vector<dash::metrics::IHTTPTransaction *>&   GetHTTPTransactionList  () const;
@@ -61,11 +87,18 @@ namespace dash
                 void    AddProgramInformation           (ProgramInformation *programInformation);
                 void    AddBaseUrl                      (BaseUrl *url);
                 void    AddLocation                     (const std::string& location);
+                void    AddPatchLocation                (PatchLocation *patchLocation);
                 void    AddPeriod                       (Period *period);
+                /*
+                 *  Replaces the Period with the given ones, e.g. with those of the remote element its xlink:href refers to.
+                 *  The Period is deleted, false is returned if it is not part of this MPD.
+                 */
+                bool    ReplacePeriod                   (Period *period, const std::vector<Period *> &replacements);
                 void    AddMetrics                      (Metrics *metrics);
                 void    SetId                           (const std::string& id);
                 void    SetProfiles                     (const std::string& profiles);
                 void    SetType                         (const std::string& type);
+                void    SetPublishTime                  (const std::string& publishTime);
                 void    SetAvailabilityStarttime        (const std::string& availabilityStarttime);
                 void    SetAvailabilityEndtime          (const std::string& availabilityEndtime);
                 void    SetMediaPresentationDuration    (const std::string& mediaPresentationDuration);
@@ -77,16 +110,55 @@ namespace dash
                 void    SetMaxSubsegmentDuration        (const std::string& maxSubsegmentDuration);
                 void    SetMPDPathBaseUrl               (BaseUrl *path);
                 void    SetFetchTime                    (uint32_t fetchTimeInSec);
+                void    SetETag                         (const std::string& eTag);
+                void    SetLastModified                 (const std::string& lastModified);
+
+                helpers::StringPool*    GetStringPool   ()  const;
+                void                    SetStringPool   (helpers::StringPool *stringPool);
+                helpers::Arena*         GetArena        ()  const;
+                void                    SetArena        (helpers::Arena *arena);
+
+                /*
+                 *  Whether all elements keep their raw attributes, which SnapshotWriter needs to write the MPD.
+                 */
+                bool                    AreRawAttributesRetained    ()  const;
+                void                    SetRawAttributesRetained    (bool retained);
+
+                /*
+                 *  Merges a newly parsed version of this MPD into the existing objects, see dash::mpd::IRefreshReport.
+                 *  The update is deleted by the caller afterwards.
+                 */
+                void    Refresh                         (MPD *update, RefreshReport &report);
+
+                /*
+                 *  The parts of Refresh for an update whose Periods are left to the caller, e.g. for a patch. RefreshHeader
+                 *  merges everything but the Periods, SwapPeriods exchanges the Periods with the given ones.
+                 */
+                void    RefreshHeader                   (MPD *update, RefreshReport &report);
+                void    SwapPeriods                     (std::vector<Period *> &periods);
 
             private:
+                /*
+                 *  The path of the MPD as the directory that relative base URLs are resolved against.
+                 */
+                std::string GetMPDDirectory             ()  const;
+
+                /*
+                 *  The duration of the Period, derived from the start of the next Period or the end of the presentation if it
+                 *  has no @duration. It is not valid if it cannot be derived.
+                 */
+                Duration    GetPeriodDuration           (IPeriod *period)   const;
+
                 std::vector<ProgramInformation *>   programInformations;
                 std::vector<BaseUrl *>              baseUrls;
                 std::vector<std::string>            locations;
+                std::vector<PatchLocation *>        patchLocations;
                 std::vector<Period *>               periods;
                 std::vector<Metrics *>              metrics;
                 std::string                         id;
                 std::vector<std::string>            profiles;
                 std::string                         type;
+                std::string                         publishTime;
                 std::string                         availabilityStarttime;
                 std::string                         availabilityEndtime;
                 std::string                         mediaPresentationDuration;
@@ -96,8 +168,23 @@ namespace dash
                 std::string                         suggestedPresentationDelay;
                 std::string                         maxSegmentDuration;
                 std::string                         maxSubsegmentDuration;
+                DateTime                            availabilityStarttimeValue;
+                DateTime                            availabilityEndtimeValue;
+                DateTime                            publishTimeValue;
+                Duration                            mediaPresentationDurationValue;
+                Duration                            minimumUpdatePeriodValue;
+                Duration                            minBufferTimeValue;
+                Duration                            timeShiftBufferDepthValue;
+                Duration                            suggestedPresentationDelayValue;
+                Duration                            maxSegmentDurationValue;
+                Duration                            maxSubsegmentDurationValue;
                 BaseUrl                             *mpdPathBaseUrl;
                 uint32_t                            fetchTime;
+                std::string                         eTag;
+                std::string                         lastModified;
+                helpers::StringPool                 *stringPool;
+                helpers::Arena                      *arena;
+                bool                                rawAttributesRetained;
 
                 std::vector<dash::metrics::TCPConnection *>     tcpConnections;
                 std::vector<dash::metrics::HTTPTransaction *>   httpTransactions;
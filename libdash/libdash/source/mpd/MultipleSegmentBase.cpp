@@ -58,3 +58,13 @@ void                        MultipleSegmentBase::SetStartNumber         (uint32_
 {
     this->startNumber = startNumber;
 }
+void                        MultipleSegmentBase::SwapMultipleSegmentBase    (MultipleSegmentBase &other)
+{
+    std::swap(this->bitstreamSwitching, other.bitstreamSwitching);
+    std::swap(this->duration,           other.duration);
+    std::swap(this->startNumber,        other.startNumber);
+}
+void                        MultipleSegmentBase::RefreshSegmentTimeline     (MultipleSegmentBase &update, RefreshReport &report)
+{
+    RefreshElement(this->segmentTimeline, update.segmentTimeline, report);
+}
\ No newline at end of file
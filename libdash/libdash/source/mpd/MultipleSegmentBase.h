@@ -40,6 +40,9 @@ namespace dash
                 void    SetStartNumber          (uint32_t startNumber);
 
             protected:
+                void    SwapMultipleSegmentBase (MultipleSegmentBase &other);
+                void    RefreshSegmentTimeline  (MultipleSegmentBase &update, RefreshReport &report);
+
                 SegmentTimeline                 *segmentTimeline;
                 URLType                         *bitstreamSwitching;
                 uint32_t                        duration;
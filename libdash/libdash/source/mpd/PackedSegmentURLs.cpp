@@ -0,0 +1,266 @@
+/*
+ * PackedSegmentURLs.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "PackedSegmentURLs.h"
+
+#include <cstdio>
+
+using namespace dash::mpd;
+using namespace dash::helpers;
+
+#define PACKED_HAS_FIELD(field)     (1 << (field))
+#define PACKED_RANGE_AS_TEXT(uri)   (1 << (4 + (uri)))
+#define PACKED_OBJECT               (1 << 6)
+
+static const char *fieldNames[] = { "media", "mediaRange", "index", "indexRange" };
+
+/* the keys are sorted like the attributes of a node: index, indexRange, media, mediaRange */
+const int PackedSegmentURLs::SortedFields[FieldCount] = { Index, IndexRange, Media, MediaRange };
+
+PackedSegmentURLs::PackedSegmentURLs    ()
+{
+    this->lastUri[0] = NoString;
+    this->lastUri[1] = NoString;
+
+    InitializeCriticalSection(&this->monitorMutex);
+}
+PackedSegmentURLs::~PackedSegmentURLs   ()
+{
+    for (size_t i = 0; i < this->decoded.size(); i++)
+        delete(this->decoded.at(i));
+
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+bool                                PackedSegmentURLs::Add         (const InternedAttributes &attributes)
+{
+    const InternedString *values[FieldCount] = { NULL, NULL, NULL, NULL };
+
+    Entry entry;
+    entry.flags = 0;
+
+    for (size_t i = 0; i < attributes.size(); i++)
+    {
+        int field = 0;
+
+        while (field < FieldCount && attributes.at(i).first.Get() != fieldNames[field])
+            field++;
+
+        if (field == FieldCount)
+            return false;
+
+        values[field]   = &attributes.at(i).second;
+        entry.flags    |= PACKED_HAS_FIELD(field);
+    }
+
+    for (int field = 0; field < FieldCount; field++)
+    {
+        /* the keys are needed to rebuild the raw attributes of the decoded elements */
+        if (values[field] && this->keys[field].Get().empty())
+        {
+            for (size_t i = 0; i < attributes.size(); i++)
+                if (&attributes.at(i).second == values[field])
+                    this->keys[field] = attributes.at(i).first;
+        }
+    }
+
+    for (int uri = 0; uri < 2; uri++)
+    {
+        int uriField    = uri == 0 ? Media : Index;
+        int rangeField  = uri == 0 ? MediaRange : IndexRange;
+
+        entry.uri[uri]      = NoString;
+        entry.range[uri][0] = 0;
+        entry.range[uri][1] = 0;
+
+        if (values[uriField])
+            entry.uri[uri] = this->AddString(values[uriField]->Get(), uri);
+
+        if (values[rangeField] && !PackedSegmentURLs::ParseRange(values[rangeField]->Get(), entry.range[uri]))
+        {
+            entry.range[uri][0] = this->AddString(values[rangeField]->Get(), -1);
+            entry.flags        |= PACKED_RANGE_AS_TEXT(uri);
+        }
+    }
+
+    this->entries.push_back(entry);
+    this->decoded.push_back(NULL);
+    return true;
+}
+void                                PackedSegmentURLs::Add         (SegmentURL *segmentURL)
+{
+    Entry entry = { { NoString, NoString }, { { 0, 0 }, { 0, 0 } }, PACKED_OBJECT };
+
+    this->entries.push_back(entry);
+    this->decoded.push_back(segmentURL);
+}
+size_t                              PackedSegmentURLs::Count       ()  const
+{
+    return this->entries.size();
+}
+SegmentURL*                         PackedSegmentURLs::Get         (size_t index)  const
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    if (this->decoded.at(index) == NULL)
+        this->decoded.at(index) = this->Decode(index);
+
+    SegmentURL *segmentURL = this->decoded.at(index);
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return segmentURL;
+}
+const std::vector<SegmentURL *>&    PackedSegmentURLs::GetAll      ()  const
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    for (size_t i = 0; i < this->decoded.size(); i++)
+        if (this->decoded.at(i) == NULL)
+            this->decoded.at(i) = this->Decode(i);
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return this->decoded;
+}
+bool                                PackedSegmentURLs::GetAttributes   (size_t index, std::vector<std::pair<std::string, std::string> > &attributes) const
+{
+    const Entry &entry = this->entries.at(index);
+
+    if (entry.flags & PACKED_OBJECT)
+        return false;
+
+    std::string values[FieldCount];
+    this->DecodeValues(entry, values);
+
+    attributes.clear();
+
+    for (int i = 0; i < FieldCount; i++)
+    {
+        int field = PackedSegmentURLs::SortedFields[i];
+
+        if (entry.flags & PACKED_HAS_FIELD(field))
+            attributes.push_back(std::make_pair(std::string(fieldNames[field]), values[field]));
+    }
+
+    return true;
+}
+SegmentURL*                         PackedSegmentURLs::Decode      (size_t index)  const
+{
+    const Entry &entry = this->entries.at(index);
+
+    SegmentURL          *segmentURL = new SegmentURL();
+    std::string         values[FieldCount];
+    InternedAttributes  attributes;
+
+    this->DecodeValues(entry, values);
+
+    segmentURL->SetMediaURI(values[Media]);
+    segmentURL->SetMediaRange(values[MediaRange]);
+    segmentURL->SetIndexURI(values[Index]);
+    segmentURL->SetIndexRange(values[IndexRange]);
+
+    for (int i = 0; i < FieldCount; i++)
+    {
+        int field = PackedSegmentURLs::SortedFields[i];
+
+        if (entry.flags & PACKED_HAS_FIELD(field))
+            attributes.push_back(std::make_pair(this->keys[field], this->keys[field].GetPool()->Intern(values[field])));
+    }
+
+    segmentURL->AddRawAttributes(attributes);
+    return segmentURL;
+}
+void                                PackedSegmentURLs::DecodeValues    (const Entry &entry, std::string values[FieldCount])    const
+{
+    for (int uri = 0; uri < 2; uri++)
+    {
+        int uriField    = uri == 0 ? Media : Index;
+        int rangeField  = uri == 0 ? MediaRange : IndexRange;
+
+        if (entry.flags & PACKED_HAS_FIELD(uriField))
+            values[uriField] = this->GetString(entry.uri[uri]);
+
+        if (entry.flags & PACKED_RANGE_AS_TEXT(uri))
+            values[rangeField] = this->GetString((uint32_t) entry.range[uri][0]);
+        else if (entry.flags & PACKED_HAS_FIELD(rangeField))
+            values[rangeField] = PackedSegmentURLs::FormatRange(entry.range[uri]);
+    }
+}
+void                                PackedSegmentURLs::Swap        (PackedSegmentURLs &other)
+{
+    std::swap(this->entries,    other.entries);
+    std::swap(this->strings,    other.strings);
+    std::swap(this->decoded,    other.decoded);
+    std::swap(this->lastUri[0], other.lastUri[0]);
+    std::swap(this->lastUri[1], other.lastUri[1]);
+
+    for (int field = 0; field < FieldCount; field++)
+        std::swap(this->keys[field], other.keys[field]);
+}
+uint32_t                            PackedSegmentURLs::AddString   (const std::string &value, int uri)
+{
+    /* consecutive elements often share the same media file, e.g. for byte ranges into a single file */
+    if (uri >= 0 && this->lastUri[uri] != NoString && value == &this->strings.at(this->lastUri[uri]))
+        return this->lastUri[uri];
+
+    uint32_t offset = (uint32_t) this->strings.size();
+
+    this->strings.insert(this->strings.end(), value.begin(), value.end());
+    this->strings.push_back('\0');
+
+    if (uri >= 0)
+        this->lastUri[uri] = offset;
+
+    return offset;
+}
+std::string                         PackedSegmentURLs::GetString   (uint32_t offset)   const
+{
+    return std::string(&this->strings.at(offset));
+}
+bool                                PackedSegmentURLs::ParseRange  (const std::string &value, uint64_t range[2])
+{
+    /* only ranges that FormatRange reproduces exactly are packed */
+    size_t  position    = 0;
+
+    for (int part = 0; part < 2; part++)
+    {
+        size_t start = position;
+        range[part] = 0;
+
+        while (position < value.size() && value[position] >= '0' && value[position] <= '9')
+        {
+            range[part] = range[part] * 10 + (value[position] - '0');
+            position++;
+        }
+
+        size_t digits = position - start;
+
+        if (digits == 0 || digits > 18 || (digits > 1 && value[start] == '0'))
+            return false;
+
+        if (part == 0)
+        {
+            if (position >= value.size() || value[position] != '-')
+                return false;
+            position++;
+        }
+    }
+
+    return position == value.size();
+}
+std::string                         PackedSegmentURLs::FormatRange (const uint64_t range[2])
+{
+    char buffer[48];
+    sprintf(buffer, "%llu-%llu", (unsigned long long) range[0], (unsigned long long) range[1]);
+
+    return buffer;
+}
@@ -0,0 +1,87 @@
+/*
+ * PackedSegmentURLs.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef PACKEDSEGMENTURLS_H_
+#define PACKEDSEGMENTURLS_H_
+
+#include "config.h"
+
+#include "SegmentURL.h"
+#include "../helpers/StringPool.h"
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /*
+         *  Stores the SegmentURL elements of a SegmentList in a compact table instead of one object per element.
+         *  URIs are kept in a shared character buffer, byte ranges of the form "first-last" as two integers.
+         *  A SegmentURL object is only created when an element is accessed and kept until the table is deleted.
+         *  Elements with sub nodes or unknown attributes cannot be packed and are stored as objects in the same order.
+         */
+        class PackedSegmentURLs
+        {
+            public:
+                PackedSegmentURLs           ();
+                virtual ~PackedSegmentURLs  ();
+
+                bool                                Add     (const helpers::InternedAttributes &attributes);
+                void                                Add     (SegmentURL *segmentURL);
+                size_t                              Count   ()  const;
+                SegmentURL*                         Get     (size_t index)  const;
+                const std::vector<SegmentURL *>&    GetAll  ()  const;
+                void                                Swap    (PackedSegmentURLs &other);
+
+                /*
+                 *  Returns the attributes of a packed element sorted by their key without creating a SegmentURL object.
+                 *  Returns false for elements that are stored as objects.
+                 */
+                bool                                GetAttributes   (size_t index, std::vector<std::pair<std::string, std::string> > &attributes)   const;
+
+            private:
+                enum Field
+                {
+                    Media       = 0,
+                    MediaRange  = 1,
+                    Index       = 2,
+                    IndexRange  = 3,
+                    FieldCount  = 4
+                };
+
+                struct Entry
+                {
+                    uint32_t    uri[2];         /* offsets of media and index into the strings, NoString if absent */
+                    uint64_t    range[2][2];    /* first and last byte of mediaRange and indexRange */
+                    uint32_t    flags;
+                };
+
+                static const uint32_t NoString = 0xFFFFFFFF;
+                static const int      SortedFields[FieldCount];
+
+                std::vector<Entry>                  entries;
+                std::vector<char>                   strings;
+                mutable std::vector<SegmentURL *>   decoded;
+                helpers::InternedString             keys[FieldCount];
+                uint32_t                            lastUri[2];
+                mutable CRITICAL_SECTION            monitorMutex;
+
+                SegmentURL*         Decode          (size_t index)  const;
+                void                DecodeValues    (const Entry &entry, std::string values[FieldCount])    const;
+                uint32_t            AddString   (const std::string &value, int uri);
+                std::string         GetString   (uint32_t offset)   const;
+                static bool         ParseRange  (const std::string &value, uint64_t range[2]);
+                static std::string  FormatRange (const uint64_t range[2]);
+        };
+    }
+}
+
+#endif /* PACKEDSEGMENTURLS_H_ */
@@ -0,0 +1,40 @@
+/*
+ * PatchLocation.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "PatchLocation.h"
+
+using namespace dash::mpd;
+
+PatchLocation::PatchLocation    () :
+               url              (""),
+               ttl              (0)
+{
+}
+PatchLocation::~PatchLocation   ()
+{
+}
+
+const std::string&  PatchLocation::GetUrl   ()  const
+{
+    return this->url;
+}
+void                PatchLocation::SetUrl   (const std::string& url)
+{
+    this->url = url;
+}
+double              PatchLocation::GetTTL   ()  const
+{
+    return this->ttl;
+}
+void                PatchLocation::SetTTL   (double ttl)
+{
+    this->ttl = ttl;
+}
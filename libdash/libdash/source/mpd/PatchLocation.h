@@ -0,0 +1,43 @@
+/*
+ * PatchLocation.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef PATCHLOCATION_H_
+#define PATCHLOCATION_H_
+
+#include "config.h"
+
+#include "IPatchLocation.h"
+#include "AbstractMPDElement.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class PatchLocation : public IPatchLocation, public AbstractMPDElement
+        {
+            public:
+                PatchLocation           ();
+                virtual ~PatchLocation  ();
+
+                const std::string&  GetUrl  ()  const;
+                double              GetTTL  ()  const;
+
+                void    SetUrl  (const std::string& url);
+                void    SetTTL  (double ttl);
+
+            private:
+                std::string url;
+                double      ttl;
+        };
+    }
+}
+
+#endif /* PATCHLOCATION_H_ */
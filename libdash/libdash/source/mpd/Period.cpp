@@ -12,6 +12,7 @@
 #include "Period.h"
 
 using namespace dash::mpd;
+using namespace dash::helpers;
 
 Period::Period  () :
         segmentBase(NULL),
@@ -79,6 +80,19 @@ void                                Period::AddAdaptationSet        (AdaptationS
     if(adaptationSet != NULL)
         this->adaptationSets.push_back(adaptationSet);
 }
+bool                                Period::ReplaceAdaptationSet    (AdaptationSet *adaptationSet, const std::vector<AdaptationSet *> &replacements)
+{
+    std::vector<AdaptationSet *>::iterator it = std::find(this->adaptationSets.begin(), this->adaptationSets.end(), adaptationSet);
+
+    if (it == this->adaptationSets.end())
+        return false;
+
+    it = this->adaptationSets.erase(it);
+    this->adaptationSets.insert(it, replacements.begin(), replacements.end());
+
+    delete adaptationSet;
+    return true;
+}
 const std::vector<ISubset *>&       Period::GetSubsets              () const
 {
     return (std::vector<ISubset *> &) this->subsets;
@@ -117,7 +131,8 @@ const std::string&                  Period::GetStart                ()  const
 }
 void                                Period::SetStart                (const std::string& start)
 {
-    this->start = start;
+    this->start         = start;
+    this->startValue    = String::ToDuration(start);
 }
 const std::string&                  Period::GetDuration             ()  const
 {
@@ -125,7 +140,16 @@ const std::string&                  Period::GetDuration             ()  const
 }
 void                                Period::SetDuration             (const std::string& duration)
 {
-    this->duration = duration;
+    this->duration      = duration;
+    this->durationValue = String::ToDuration(duration);
+}
+const Duration&                     Period::GetStartValue           ()  const
+{
+    return this->startValue;
+}
+const Duration&                     Period::GetDurationValue        ()  const
+{
+    return this->durationValue;
 }
 bool                                Period::GetBitstreamSwitching   ()  const
 {
@@ -135,3 +159,26 @@ void                                Period::SetBitstreamSwitching   (bool value)
 {
     this->isBitstreamSwitching = value;
 }
+void                                Period::Refresh                 (Period *update, RefreshReport &report)
+{
+    if (this->GetDigest() != update->GetDigest())
+    {
+        this->SwapElement(*update);
+        std::swap(this->baseURLs,              update->baseURLs);
+        std::swap(this->subsets,               update->subsets);
+        std::swap(this->xlinkHref,             update->xlinkHref);
+        std::swap(this->xlinkActuate,          update->xlinkActuate);
+        std::swap(this->id,                    update->id);
+        std::swap(this->start,                 update->start);
+        std::swap(this->duration,              update->duration);
+        std::swap(this->startValue,            update->startValue);
+        std::swap(this->durationValue,         update->durationValue);
+        std::swap(this->isBitstreamSwitching,  update->isBitstreamSwitching);
+        report.AddUpdatedElement(this);
+    }
+
+    RefreshElement(this->segmentBase,       update->segmentBase,        report);
+    RefreshElement(this->segmentList,       update->segmentList,        report);
+    RefreshElement(this->segmentTemplate,   update->segmentTemplate,    report);
+    RefreshElements(this->adaptationSets,   update->adaptationSets,     report);
+}
\ No newline at end of file
@@ -44,6 +44,8 @@ namespace dash
                 const std::string&                      GetId                   ()  const;
                 const std::string&                      GetStart                ()  const;
                 const std::string&                      GetDuration             ()  const;
+                const Duration&                         GetStartValue           ()  const;
+                const Duration&                         GetDurationValue        ()  const;
                 bool                                    GetBitstreamSwitching   ()  const;
 
                 void    AddBaseURL                  (BaseUrl *baseURL);
@@ -51,6 +53,10 @@ namespace dash
                 void    SetSegmentList              (SegmentList *segmentList);
                 void    SetSegmentTemplate          (SegmentTemplate *segmentTemplate);
                 void    AddAdaptationSet            (AdaptationSet *AdaptationSet);
+                /*
+                 *  Replaces the AdaptationSet with the given ones, see MPD::ReplacePeriod.
+                 */
+                bool    ReplaceAdaptationSet        (AdaptationSet *adaptationSet, const std::vector<AdaptationSet *> &replacements);
                 void    AddSubset                   (Subset *subset);
                 void    SetXlinkHref                (const std::string& xlinkHref);
                 void    SetXlinkActuate             (const std::string& xlinkActuate);
@@ -59,6 +65,13 @@ namespace dash
                 void    SetDuration                 (const std::string& duration);
                 void    SetBitstreamSwitching       (bool value);
 
+                /*
+                 *  Takes over the attributes and sub elements of the given Period if they differ, refreshes the
+                 *  segment information in place and matches the AdaptationSets by their id.
+                 *  The update is deleted by the caller afterwards.
+                 */
+                void    Refresh                     (Period *update, RefreshReport &report);
+
             private:
                 std::vector<BaseUrl *>          baseURLs;
                 SegmentBase                     *segmentBase;
@@ -71,6 +84,8 @@ namespace dash
                 std::string                     id;
                 std::string                     start;
                 std::string                     duration;
+                Duration                        startValue;
+                Duration                        durationValue;
                 bool                            isBitstreamSwitching;
         };
     }
@@ -15,12 +15,13 @@
 #include "config.h"
 
 #include "IRange.h"
+#include "../helpers/Arena.h"
 
 namespace dash
 {
     namespace mpd
     {
-        class Range : public IRange
+        class Range : public IRange, public helpers::ArenaAllocated
         {
             public:
                 Range           ();
@@ -0,0 +1,78 @@
+/*
+ * RefreshReport.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "RefreshReport.h"
+
+using namespace dash::mpd;
+
+RefreshReport::RefreshReport            () :
+               removedElements          (0),
+               appendedTimelineEntries  (0),
+               removedTimelineEntries   (0),
+               isNotModified            (false)
+{
+}
+RefreshReport::~RefreshReport           ()
+{
+}
+
+bool                                RefreshReport::HasChanges                   ()  const
+{
+    return this->addedElements.size() || this->updatedElements.size() || this->removedElements;
+}
+const std::vector<IMPDElement *>&   RefreshReport::GetAddedElements             ()  const
+{
+    return this->addedElements;
+}
+const std::vector<IMPDElement *>&   RefreshReport::GetUpdatedElements           ()  const
+{
+    return this->updatedElements;
+}
+uint32_t                            RefreshReport::GetRemovedElements           ()  const
+{
+    return this->removedElements;
+}
+uint32_t                            RefreshReport::GetAppendedTimelineEntries   ()  const
+{
+    return this->appendedTimelineEntries;
+}
+uint32_t                            RefreshReport::GetRemovedTimelineEntries    ()  const
+{
+    return this->removedTimelineEntries;
+}
+bool                                RefreshReport::IsNotModified                ()  const
+{
+    return this->isNotModified;
+}
+void                                RefreshReport::SetNotModified               (bool notModified)
+{
+    this->isNotModified = notModified;
+}
+void                                RefreshReport::AddAddedElement              (IMPDElement *element)
+{
+    this->addedElements.push_back(element);
+}
+void                                RefreshReport::AddUpdatedElement            (IMPDElement *element)
+{
+    this->updatedElements.push_back(element);
+}
+void                                RefreshReport::AddRemovedElement            ()
+{
+    this->removedElements++;
+}
+void                                RefreshReport::AddAppendedTimelineEntries   (uint32_t count)
+{
+    this->appendedTimelineEntries += count;
+}
+void                                RefreshReport::AddRemovedTimelineEntries    (uint32_t count)
+{
+    this->removedTimelineEntries += count;
+}
@@ -0,0 +1,134 @@
+/*
+ * RefreshReport.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef REFRESHREPORT_H_
+#define REFRESHREPORT_H_
+
+#include "config.h"
+
+#include "IRefreshReport.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        class RefreshReport : public IRefreshReport
+        {
+            public:
+                RefreshReport          ();
+                virtual ~RefreshReport ();
+
+                bool                                HasChanges                  ()  const;
+                const std::vector<IMPDElement *>&   GetAddedElements            ()  const;
+                const std::vector<IMPDElement *>&   GetUpdatedElements          ()  const;
+                uint32_t                            GetRemovedElements          ()  const;
+                uint32_t                            GetAppendedTimelineEntries  ()  const;
+                uint32_t                            GetRemovedTimelineEntries   ()  const;
+                bool                                IsNotModified               ()  const;
+
+                void    AddAddedElement             (IMPDElement *element);
+                void    AddUpdatedElement           (IMPDElement *element);
+                void    AddRemovedElement           ();
+                void    AddAppendedTimelineEntries  (uint32_t count);
+                void    AddRemovedTimelineEntries   (uint32_t count);
+                void    SetNotModified              (bool notModified);
+
+            private:
+                std::vector<IMPDElement *>  addedElements;
+                std::vector<IMPDElement *>  updatedElements;
+                uint32_t                    removedElements;
+                uint32_t                    appendedTimelineEntries;
+                uint32_t                    removedTimelineEntries;
+                bool                        isNotModified;
+        };
+
+        /*
+         *  Helpers used by the Refresh methods of the MPD classes. The update objects are consumed:
+         *  elements that are taken over are removed from them, everything left is deleted together
+         *  with the update.
+         */
+        template <class T>
+        void    RefreshElement  (T *&current, T *&update, RefreshReport &report)
+        {
+            if (current && update)
+            {
+                current->Refresh(update, report);
+                return;
+            }
+
+            if (current)
+                report.AddRemovedElement();
+
+            if (update)
+                report.AddAddedElement(update);
+
+            std::swap(current, update);
+        }
+
+        inline std::string RefreshKey (const std::string &id)
+        {
+            return id;
+        }
+        inline std::string RefreshKey (uint32_t id)
+        {
+            std::stringstream ss;
+            ss << id;
+            return ss.str();
+        }
+
+        /*
+         *  Matches the elements by their id. Elements sharing an id (or having none) are matched in document order.
+         */
+        template <class T>
+        void    RefreshElements (std::vector<T *> &current, std::vector<T *> &update, RefreshReport &report)
+        {
+            typedef typename std::multimap<std::string, size_t>::iterator Iterator;
+
+            std::multimap<std::string, size_t>  unmatched;
+            std::vector<T *>                    result;
+
+            for (size_t i = 0; i < current.size(); i++)
+                unmatched.insert(unmatched.end(), std::make_pair(RefreshKey(current.at(i)->GetId()), i));
+
+            for (size_t i = 0; i < update.size(); i++)
+            {
+                Iterator it = unmatched.lower_bound(RefreshKey(update.at(i)->GetId()));
+
+                if (it == unmatched.end() || it->first != RefreshKey(update.at(i)->GetId()))
+                {
+                    report.AddAddedElement(update.at(i));
+                    result.push_back(update.at(i));
+                    update.at(i) = NULL;
+                    continue;
+                }
+
+                T *element = current.at(it->second);
+                element->Refresh(update.at(i), report);
+                result.push_back(element);
+                current.at(it->second) = NULL;
+                unmatched.erase(it);
+            }
+
+            for (size_t i = 0; i < current.size(); i++)
+            {
+                if (current.at(i))
+                {
+                    report.AddRemovedElement();
+                    delete current.at(i);
+                }
+            }
+
+            current.swap(result);
+        }
+    }
+}
+
+#endif /* REFRESHREPORT_H_ */
@@ -114,3 +114,23 @@ void                                        Representation::SetMediaStreamStruct
 {
     dash::helpers::String::Split(mediaStreamStructureId, ' ', this->mediaStreamStructureId);
 }
+void                                        Representation::Refresh                     (Representation *update, RefreshReport &report)
+{
+    if (this->GetDigest() != update->GetDigest())
+    {
+        this->SwapElement(*update);
+        this->SwapRepresentationBase(*update);
+        std::swap(this->baseURLs,               update->baseURLs);
+        std::swap(this->subRepresentations,     update->subRepresentations);
+        std::swap(this->id,                     update->id);
+        std::swap(this->bandwidth,              update->bandwidth);
+        std::swap(this->qualityRanking,         update->qualityRanking);
+        std::swap(this->dependencyId,           update->dependencyId);
+        std::swap(this->mediaStreamStructureId, update->mediaStreamStructureId);
+        report.AddUpdatedElement(this);
+    }
+
+    RefreshElement(this->segmentBase,       update->segmentBase,        report);
+    RefreshElement(this->segmentList,       update->segmentList,        report);
+    RefreshElement(this->segmentTemplate,   update->segmentTemplate,    report);
+}
\ No newline at end of file
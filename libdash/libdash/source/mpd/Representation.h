@@ -55,6 +55,12 @@ namespace dash
                 void    SetDependencyId             (const std::string &dependencyId);
                 void    SetMediaStreamStructureId   (const std::string &mediaStreamStructureId);
 
+                /*
+                 *  Takes over the attributes and sub elements of the given Representation if they differ and refreshes
+                 *  the segment information in place. The update is deleted by the caller afterwards.
+                 */
+                void    Refresh                     (Representation *update, RefreshReport &report);
+
             private:
                 std::vector<BaseUrl *>              baseURLs;
                 std::vector<SubRepresentation *>    subRepresentations;
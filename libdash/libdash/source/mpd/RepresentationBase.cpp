@@ -12,19 +12,15 @@
 #include "RepresentationBase.h"
 
 using namespace dash::mpd;
+using namespace dash::helpers;
 
 RepresentationBase::RepresentationBase  () :
                     width(0),
                     height(0),
-                    sar(""),
-                    frameRate(""),
-                    audioSamplingRate(""),
-                    mimeType(""),
                     maximumSAPPeriod(0.0),
                     startWithSAP(0),
                     maxPlayoutRate(0.0),
-                    codingDependency(false),
-                    scanType("")
+                    codingDependency(false)
 {
 }
 RepresentationBase::~RepresentationBase ()
@@ -85,35 +81,40 @@ void                                RepresentationBase::SetHeight
 {
     this->height = height;
 }
-std::string                         RepresentationBase::GetSar                          () const
+const std::string&                  RepresentationBase::GetSar                          () const
 {
-    return this->sar;
+    return this->sar.Get();
 }
-void                                RepresentationBase::SetSar                          (const std::string& sar)
+void                                RepresentationBase::SetSar                          (const InternedString& sar)
 {
     this->sar = sar;
 }
-std::string                         RepresentationBase::GetFrameRate                    () const
+const std::string&                  RepresentationBase::GetFrameRate                    () const
 {
-    return this->frameRate;
+    return this->frameRate.Get();
 }
-void                                RepresentationBase::SetFrameRate                    (const std::string& frameRate)
+void                                RepresentationBase::SetFrameRate                    (const InternedString& frameRate)
 {
-    this->frameRate = frameRate;
+    this->frameRate         = frameRate;
+    this->frameRateValue    = String::ToFrameRate(frameRate.Get());
 }
-std::string                         RepresentationBase::GetAudioSamplingRate            () const
+const FrameRate&                    RepresentationBase::GetFrameRateValue               () const
 {
-    return this->audioSamplingRate;
+    return this->frameRateValue;
 }
-void                                RepresentationBase::SetAudioSamplingRate            (const std::string& audioSamplingRate)
+const std::string&                  RepresentationBase::GetAudioSamplingRate            () const
+{
+    return this->audioSamplingRate.Get();
+}
+void                                RepresentationBase::SetAudioSamplingRate            (const InternedString& audioSamplingRate)
 {
     this->audioSamplingRate = audioSamplingRate;
 }
-std::string                         RepresentationBase::GetMimeType                     () const
+const std::string&                  RepresentationBase::GetMimeType                     () const
 {
-    return this->mimeType;
+    return this->mimeType.Get();
 }
-void                                RepresentationBase::SetMimeType                     (const std::string& mimeType)
+void                                RepresentationBase::SetMimeType                     (const InternedString& mimeType)
 {
     this->mimeType = mimeType;
 }
@@ -165,11 +166,33 @@ void                                RepresentationBase::SetCodingDependency
 {
     this->codingDependency = codingDependency;
 }
-std::string                         RepresentationBase::GetScanType                     () const
+const std::string&                  RepresentationBase::GetScanType                     () const
 {
-    return this->scanType;
+    return this->scanType.Get();
 }
-void                                RepresentationBase::SetScanType                     (const std::string& scanType)
+void                                RepresentationBase::SetScanType                     (const InternedString& scanType)
 {
     this->scanType = scanType;
 }
+
+void                                RepresentationBase::SwapRepresentationBase          (RepresentationBase &other)
+{
+    std::swap(this->framePacking,               other.framePacking);
+    std::swap(this->audioChannelConfiguration,  other.audioChannelConfiguration);
+    std::swap(this->contentProtection,          other.contentProtection);
+    std::swap(this->profiles,                   other.profiles);
+    std::swap(this->width,                      other.width);
+    std::swap(this->height,                     other.height);
+    std::swap(this->sar,                        other.sar);
+    std::swap(this->frameRate,                  other.frameRate);
+    std::swap(this->frameRateValue,             other.frameRateValue);
+    std::swap(this->audioSamplingRate,          other.audioSamplingRate);
+    std::swap(this->mimeType,                   other.mimeType);
+    std::swap(this->segmentProfiles,            other.segmentProfiles);
+    std::swap(this->codecs,                     other.codecs);
+    std::swap(this->maximumSAPPeriod,           other.maximumSAPPeriod);
+    std::swap(this->startWithSAP,               other.startWithSAP);
+    std::swap(this->maxPlayoutRate,             other.maxPlayoutRate);
+    std::swap(this->codingDependency,           other.codingDependency);
+    std::swap(this->scanType,                   other.scanType);
+}
\ No newline at end of file
@@ -35,17 +35,18 @@ namespace dash
                 const std::vector<std::string>&     GetProfiles                     () const;
                 uint32_t                            GetWidth                        () const;
                 uint32_t                            GetHeight                       () const;
-                std::string                         GetSar                          () const;
-                std::string                         GetFrameRate                    () const;
-                std::string                         GetAudioSamplingRate            () const;
-                std::string                         GetMimeType                     () const;
+                const std::string&                  GetSar                          () const;
+                const std::string&                  GetFrameRate                    () const;
+                const FrameRate&                    GetFrameRateValue               () const;
+                const std::string&                  GetAudioSamplingRate            () const;
+                const std::string&                  GetMimeType                     () const;
                 const std::vector<std::string>&     GetSegmentProfiles              () const;
                 const std::vector<std::string>&     GetCodecs                       () const;
                 double                              GetMaximumSAPPeriod             () const;
                 uint8_t                             GetStartWithSAP                 () const;
                 double                              GetMaxPlayoutRate               () const;
                 bool                                HasCodingDependency             () const;
-                std::string                         GetScanType                     () const;
+                const std::string&                  GetScanType                     () const;
 
                 void    AddFramePacking                 (Descriptor *framePacking);
                 void    AddAudioChannelConfiguration    (Descriptor *audioChannelConfiguration);
@@ -53,36 +54,39 @@ namespace dash
                 void    SetProfiles                     (const std::string& profiles);
                 void    SetWidth                        (uint32_t width);
                 void    SetHeight                       (uint32_t height);
-                void    SetSar                          (const std::string& sar);
-                void    SetFrameRate                    (const std::string& frameRate);
-                void    SetAudioSamplingRate            (const std::string& audioSamplingRate);
-                void    SetMimeType                     (const std::string& mimeType);
+                void    SetSar                          (const helpers::InternedString& sar);
+                void    SetFrameRate                    (const helpers::InternedString& frameRate);
+                void    SetAudioSamplingRate            (const helpers::InternedString& audioSamplingRate);
+                void    SetMimeType                     (const helpers::InternedString& mimeType);
                 void    SetSegmentProfiles              (const std::string& segmentProfiles);
                 void    SetCodecs                       (const std::string& codecs);
                 void    SetMaximumSAPPeriod             (double maximumSAPPeroid);
                 void    SetStartWithSAP                 (uint8_t startWithSAP);
                 void    SetMaxPlayoutRate               (double maxPlayoutRate);
                 void    SetCodingDependency             (bool codingDependency);
-                void    SetScanType                     (const std::string& scanType);
+                void    SetScanType                     (const helpers::InternedString& scanType);
 
             protected:
+                void    SwapRepresentationBase          (RepresentationBase &other);
+
                 std::vector<Descriptor *>   framePacking;
                 std::vector<Descriptor *>   audioChannelConfiguration;
                 std::vector<Descriptor *>   contentProtection;
                 std::vector<std::string>    profiles;
                 uint32_t                    width;
                 uint32_t                    height;
-                std::string                 sar;
-                std::string                 frameRate;
-                std::string                 audioSamplingRate;
-                std::string                 mimeType;
+                helpers::InternedString     sar;
+                helpers::InternedString     frameRate;
+                FrameRate                   frameRateValue;
+                helpers::InternedString     audioSamplingRate;
+                helpers::InternedString     mimeType;
                 std::vector<std::string>    segmentProfiles;
                 std::vector<std::string>    codecs;
                 double                      maximumSAPPeriod;
                 uint8_t                     startWithSAP;
                 double                      maxPlayoutRate;
                 bool                        codingDependency;
-                std::string                 scanType;
+                helpers::InternedString     scanType;
         };
     }
 }
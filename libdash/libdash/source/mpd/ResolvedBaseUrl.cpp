@@ -0,0 +1,353 @@
+/*
+ * ResolvedBaseUrl.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "ResolvedBaseUrl.h"
+
+#include <cctype>
+
+using namespace dash::mpd;
+using namespace dash::metrics;
+
+ResolvedBaseUrl::ResolvedBaseUrl    (const std::string& url, const std::string& serviceLocation) :
+                 url                (url),
+                 serviceLocation    (serviceLocation),
+                 port               (0),
+                 pathOffset         (std::string::npos),
+                 directoryLength    (0)
+{
+    Components components;
+    Split(url, components);
+
+    for (size_t i = 0; i < components.scheme.size(); i++)
+        this->scheme += (char) tolower((unsigned char) components.scheme.at(i));
+
+    std::string hostPort    = components.authority.substr(components.authority.find('@') + 1);
+    size_t      bracket     = hostPort.rfind(']');
+    size_t      colon       = hostPort.rfind(':');
+
+    /* a colon inside the brackets of an IPv6 address does not start the port */
+    if (colon != std::string::npos && (bracket == std::string::npos || colon > bracket))
+    {
+        this->port  = strtoul(hostPort.c_str() + colon + 1, NULL, 10);
+        hostPort    = hostPort.substr(0, colon);
+    }
+
+    for (size_t i = 0; i < hostPort.size(); i++)
+        this->host += (char) tolower((unsigned char) hostPort.at(i));
+
+    if (this->port == 0 && this->scheme == "http")
+        this->port = 80;
+    if (this->port == 0 && this->scheme == "https")
+        this->port = 443;
+
+    this->path = components.path;
+
+    if (components.hasQuery)
+        this->path += "?" + components.query;
+
+    if (components.hasAuthority && this->host.size())
+    {
+        std::stringstream ss;
+        ss << this->scheme << "://" << this->host << ":" << this->port;
+        this->origin = ss.str();
+    }
+
+    size_t pathBegin = components.hasScheme ? components.scheme.size() + 1 : 0;
+
+    if (components.hasAuthority)
+        pathBegin += components.authority.size() + 2;
+
+    if ((this->scheme == "http" || this->scheme == "https") && this->host.size())
+        this->pathOffset = pathBegin;
+
+    /* the merge of RFC 3986 keeps the base path up to its last slash, an empty path below an authority becomes a slash */
+    size_t lastSlash = components.path.rfind('/');
+
+    if (lastSlash != std::string::npos)
+        this->directoryLength = pathBegin + lastSlash + 1;
+}
+ResolvedBaseUrl::~ResolvedBaseUrl   ()
+{
+}
+
+const std::string&  ResolvedBaseUrl::GetUrl             ()  const
+{
+    return this->url;
+}
+const std::string&  ResolvedBaseUrl::GetServiceLocation ()  const
+{
+    return this->serviceLocation;
+}
+const std::string&  ResolvedBaseUrl::GetByteRange       ()  const
+{
+    static const std::string byteRange;
+    return byteRange;
+}
+const std::string&  ResolvedBaseUrl::GetScheme          ()  const
+{
+    return this->scheme;
+}
+const std::string&  ResolvedBaseUrl::GetHost            ()  const
+{
+    return this->host;
+}
+size_t              ResolvedBaseUrl::GetPort            ()  const
+{
+    return this->port;
+}
+const std::string&  ResolvedBaseUrl::GetPath            ()  const
+{
+    return this->path;
+}
+const std::string&  ResolvedBaseUrl::GetOrigin          ()  const
+{
+    return this->origin;
+}
+std::string         ResolvedBaseUrl::Resolve            (const std::string& reference)  const
+{
+    std::string resolved;
+
+    this->Resolve(reference, resolved);
+
+    return resolved;
+}
+void                ResolvedBaseUrl::Resolve            (const std::string& reference, std::string& resolved)   const
+{
+    if (this->directoryLength && IsPlainPath(reference))
+    {
+        resolved.reserve(this->directoryLength + reference.size());
+        resolved.assign(this->url, 0, this->directoryLength);
+        resolved.append(reference);
+
+        return;
+    }
+
+    resolved = ResolveReference(this->url, reference);
+}
+ISegment*           ResolvedBaseUrl::ToSegment          (const std::string& uri, const std::string& range, HTTPTransactionType type)    const
+{
+    Segment *seg = new Segment();
+
+    if (seg->Init(*this, uri, range, type))
+        return seg;
+
+    delete(seg);
+
+    return NULL;
+}
+ISegment*           ResolvedBaseUrl::ToMediaSegment     (const std::vector<IBaseUrl *>& baseurls) const
+{
+    Segment *seg = new Segment();
+
+    if (seg->Init(baseurls, this->url, "", MediaSegment))
+        return seg;
+
+    delete(seg);
+
+    return NULL;
+}
+size_t              ResolvedBaseUrl::GetPathOffset      (const std::string& url)    const
+{
+    if (this->pathOffset == std::string::npos || url.size() <= this->pathOffset || url.at(this->pathOffset) != '/')
+        return std::string::npos;
+
+    if (url.compare(0, this->pathOffset, this->url, 0, this->pathOffset) != 0)
+        return std::string::npos;
+
+    return this->pathOffset;
+}
+std::string         ResolvedBaseUrl::ResolveReference   (const std::string& base, const std::string& reference)
+{
+    Components b;
+    Components r;
+    Components t;
+
+    Split(base, b);
+    Split(reference, r);
+
+    if (r.hasScheme)
+    {
+        t           = r;
+        t.path      = RemoveDotSegments(r.path);
+    }
+    else
+    {
+        if (r.hasAuthority)
+        {
+            t           = r;
+            t.path      = RemoveDotSegments(r.path);
+        }
+        else
+        {
+            if (r.path.empty())
+            {
+                t.path      = b.path;
+                t.query     = r.hasQuery ? r.query : b.query;
+                t.hasQuery  = r.hasQuery || b.hasQuery;
+            }
+            else
+            {
+                t.path      = RemoveDotSegments(r.path.at(0) == '/' ? r.path : Merge(b, r.path));
+                t.query     = r.query;
+                t.hasQuery  = r.hasQuery;
+            }
+
+            t.authority     = b.authority;
+            t.hasAuthority  = b.hasAuthority;
+        }
+
+        t.scheme    = b.scheme;
+        t.hasScheme = b.hasScheme;
+    }
+
+    t.fragment      = r.fragment;
+    t.hasFragment   = r.hasFragment;
+
+    std::string resolved;
+
+    if (t.hasScheme)
+        resolved += t.scheme + ":";
+    if (t.hasAuthority)
+        resolved += "//" + t.authority;
+
+    resolved += t.path;
+
+    if (t.hasQuery)
+        resolved += "?" + t.query;
+    if (t.hasFragment)
+        resolved += "#" + t.fragment;
+
+    return resolved;
+}
+void                ResolvedBaseUrl::Split              (const std::string& url, Components& components)
+{
+    size_t pos = 0;
+    size_t end = url.find_first_of(":/?#");
+
+    components.hasScheme    = false;
+    components.hasAuthority = false;
+    components.hasQuery     = false;
+    components.hasFragment  = false;
+
+    /* the scheme starts with a letter, otherwise the colon belongs to a relative path */
+    if (end != std::string::npos && end > 0 && url.at(end) == ':' && isalpha((unsigned char) url.at(0)))
+    {
+        components.scheme       = url.substr(0, end);
+        components.hasScheme    = true;
+        pos                     = end + 1;
+    }
+
+    if (url.compare(pos, 2, "//") == 0)
+    {
+        end                     = url.find_first_of("/?#", pos + 2);
+        end                     = end == std::string::npos ? url.size() : end;
+        components.authority    = url.substr(pos + 2, end - pos - 2);
+        components.hasAuthority = true;
+        pos                     = end;
+    }
+
+    end             = url.find_first_of("?#", pos);
+    end             = end == std::string::npos ? url.size() : end;
+    components.path = url.substr(pos, end - pos);
+    pos             = end;
+
+    if (pos < url.size() && url.at(pos) == '?')
+    {
+        end                 = url.find('#', pos);
+        end                 = end == std::string::npos ? url.size() : end;
+        components.query    = url.substr(pos + 1, end - pos - 1);
+        components.hasQuery = true;
+        pos                 = end;
+    }
+
+    if (pos < url.size())
+    {
+        components.fragment     = url.substr(pos + 1);
+        components.hasFragment  = true;
+    }
+}
+std::string         ResolvedBaseUrl::Merge              (const Components& base, const std::string& path)
+{
+    if (base.hasAuthority && base.path.empty())
+        return "/" + path;
+
+    size_t lastSlash = base.path.rfind('/');
+
+    if (lastSlash == std::string::npos)
+        return path;
+
+    return base.path.substr(0, lastSlash + 1) + path;
+}
+std::string         ResolvedBaseUrl::RemoveDotSegments  (const std::string& path)
+{
+    std::string input   = path;
+    std::string output;
+
+    while (!input.empty())
+    {
+        if (input.compare(0, 3, "../") == 0)
+            input.erase(0, 3);
+        else if (input.compare(0, 2, "./") == 0)
+            input.erase(0, 2);
+        else if (input.compare(0, 3, "/./") == 0)
+            input.erase(0, 2);
+        else if (input == "/.")
+            input = "/";
+        else if (input.compare(0, 4, "/../") == 0 || input == "/..")
+        {
+            input = input.size() == 3 ? "/" : input.substr(3);
+
+            size_t lastSlash = output.rfind('/');
+            output.erase(lastSlash == std::string::npos ? 0 : lastSlash);
+        }
+        else if (input == "." || input == "..")
+            input.clear();
+        else
+        {
+            size_t end = input.find('/', input.at(0) == '/' ? 1 : 0);
+            end = end == std::string::npos ? input.size() : end;
+
+            output += input.substr(0, end);
+            input.erase(0, end);
+        }
+    }
+
+    return output;
+}
+bool                ResolvedBaseUrl::IsPlainPath        (const std::string& reference)
+{
+    if (reference.empty() || reference.at(0) == '/' || reference.at(0) == '?' || reference.at(0) == '#')
+        return false;
+
+    size_t end = reference.find_first_of("?#");
+    end = end == std::string::npos ? reference.size() : end;
+
+    /* a colon in the first segment starts a scheme */
+    size_t colon = reference.find(':');
+    if (colon < end && colon < reference.find('/'))
+        return false;
+
+    /* dot segments have to be removed */
+    size_t begin = 0;
+
+    while (begin < end)
+    {
+        size_t slash = reference.find('/', begin);
+        slash = slash > end ? end : slash;
+
+        if ((slash - begin == 1 && reference.at(begin) == '.') || (slash - begin == 2 && reference.compare(begin, 2, "..") == 0))
+            return false;
+
+        begin = slash + 1;
+    }
+
+    return true;
+}
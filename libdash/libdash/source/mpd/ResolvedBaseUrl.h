@@ -0,0 +1,96 @@
+/*
+ * ResolvedBaseUrl.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef RESOLVEDBASEURL_H_
+#define RESOLVEDBASEURL_H_
+
+#include "config.h"
+
+#include "IResolvedBaseUrl.h"
+#include "AbstractMPDElement.h"
+#include "Segment.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /*
+         *  An absolute base URL that is split into its components once. The prefix of the URL up to the last slash of its
+         *  path is kept, so that a relative reference without dot segments is resolved by appending it to the prefix.
+         *  All other references take the full resolution of RFC 3986.
+         */
+        class ResolvedBaseUrl : public IResolvedBaseUrl, public AbstractMPDElement
+        {
+            public:
+                ResolvedBaseUrl             (const std::string& url, const std::string& serviceLocation);
+                virtual ~ResolvedBaseUrl    ();
+
+                const std::string&  GetUrl              ()  const;
+                const std::string&  GetServiceLocation  ()  const;
+                const std::string&  GetByteRange        ()  const;
+                const std::string&  GetScheme           ()  const;
+                const std::string&  GetHost             ()  const;
+                size_t              GetPort             ()  const;
+                const std::string&  GetPath             ()  const;
+                const std::string&  GetOrigin           ()  const;
+                std::string         Resolve             (const std::string& reference)  const;
+                ISegment*           ToSegment           (const std::string& uri, const std::string& range, dash::metrics::HTTPTransactionType type)    const;
+                ISegment*           ToMediaSegment      (const std::vector<IBaseUrl *>& baseurls) const;
+
+                /*
+                 *  Resolves the reference into the given string, whose memory is reused.
+                 */
+                void                Resolve             (const std::string& reference, std::string& resolved)   const;
+
+                /*
+                 *  Returns the offset of the path in a URL that has been resolved against this base URL, or std::string::npos if
+                 *  the URL refers to another host or is not an HTTP URL.
+                 */
+                size_t              GetPathOffset       (const std::string& url)    const;
+
+                /*
+                 *  Resolves the reference against the base as specified in RFC 3986, section 5.2.
+                 */
+                static std::string  ResolveReference    (const std::string& base, const std::string& reference);
+
+            private:
+                struct Components
+                {
+                    std::string scheme;
+                    std::string authority;
+                    std::string path;
+                    std::string query;
+                    std::string fragment;
+                    bool        hasScheme;
+                    bool        hasAuthority;
+                    bool        hasQuery;
+                    bool        hasFragment;
+                };
+
+                static void         Split               (const std::string& url, Components& components);
+                static std::string  Merge               (const Components& base, const std::string& path);
+                static std::string  RemoveDotSegments   (const std::string& path);
+                static bool         IsPlainPath         (const std::string& reference);
+
+                std::string url;
+                std::string serviceLocation;
+                std::string scheme;
+                std::string host;
+                size_t      port;
+                std::string path;
+                std::string origin;
+                size_t      pathOffset;         /* npos if the URL is not an HTTP URL */
+                size_t      directoryLength;    /* 0 if relative references take the full resolution */
+        };
+    }
+}
+
+#endif /* RESOLVEDBASEURL_H_ */
@@ -0,0 +1,181 @@
+/*
+ * RunLengthTimeline.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "RunLengthTimeline.h"
+
+using namespace dash::mpd;
+
+const uint64_t RunLengthTimeline::Unbounded;
+
+RunLengthTimeline::RunLengthTimeline    ()
+{
+}
+RunLengthTimeline::~RunLengthTimeline   ()
+{
+}
+
+void        RunLengthTimeline::Add                  (const Timeline *timeline)
+{
+    Run run;
+
+    run.startTime       = timeline->HasStartTime() ? timeline->GetStartTime() : 0;
+    run.duration        = timeline->GetDuration();
+    run.firstSegment    = 0;
+    run.segmentCount    = timeline->GetRepeatCount() < 0 ? Unbounded : (uint64_t) timeline->GetRepeatCount() + 1;
+
+    if (!this->runs.empty())
+    {
+        Run &previous = this->runs.back();
+
+        /* an open run ends where the next S element starts, without @t it can only be taken as a single Segment */
+        if (previous.segmentCount == Unbounded)
+            previous.segmentCount = timeline->HasStartTime() ? CountSegments(previous.startTime, run.startTime, previous.duration) : 1;
+
+        if (!timeline->HasStartTime())
+            run.startTime = previous.startTime + previous.duration * previous.segmentCount;
+
+        run.firstSegment = previous.firstSegment + previous.segmentCount;
+    }
+
+    this->runs.push_back(run);
+}
+void        RunLengthTimeline::Build                (const std::vector<ITimeline *> &timelines)
+{
+    this->runs.clear();
+    this->runs.reserve(timelines.size());
+
+    for (size_t i = 0; i < timelines.size(); i++)
+        this->Add((const Timeline *) timelines.at(i));
+}
+void        RunLengthTimeline::Clear                ()
+{
+    this->runs.clear();
+}
+size_t      RunLengthTimeline::GetRunCount          ()  const
+{
+    return this->runs.size();
+}
+uint64_t    RunLengthTimeline::GetRunStartTime      (size_t run)    const
+{
+    return this->runs.at(run).startTime;
+}
+uint64_t    RunLengthTimeline::GetRunEndTime        (size_t run)    const
+{
+    const Run &entry = this->runs.at(run);
+
+    if (entry.segmentCount == Unbounded)
+        return Unbounded;
+
+    return entry.startTime + entry.duration * entry.segmentCount;
+}
+uint64_t    RunLengthTimeline::GetSegmentCount      (uint64_t endTime)  const
+{
+    if (this->runs.empty())
+        return 0;
+
+    const Run &last = this->runs.back();
+
+    if (last.segmentCount != Unbounded)
+        return last.firstSegment + last.segmentCount;
+
+    return last.firstSegment + CountSegments(last.startTime, endTime, last.duration);
+}
+bool        RunLengthTimeline::GetSegment           (uint64_t index, uint64_t &startTime, uint64_t &duration) const
+{
+    size_t run = this->runs.size();
+
+    return this->GetSegment(index, startTime, duration, run);
+}
+bool        RunLengthTimeline::GetSegment           (uint64_t index, uint64_t &startTime, uint64_t &duration, size_t &run) const
+{
+    /* consecutive Segments lie in the run of the previous lookup or in the one that follows it, any other Segment is searched */
+    if (!this->IsInRun(run, index))
+    {
+        if (run < this->runs.size() && this->IsInRun(run + 1, index))
+        {
+            run++;
+        }
+        else
+        {
+            std::vector<Run>::const_iterator it = std::upper_bound(this->runs.begin(), this->runs.end(), index, CompareFirstSegment);
+
+            if (it == this->runs.begin())
+                return false;
+
+            run = it - 1 - this->runs.begin();
+        }
+    }
+
+    const Run   &entry  = this->runs[run];
+    uint64_t    offset  = index - entry.firstSegment;
+
+    if (offset >= entry.segmentCount)
+        return false;
+
+    /* open runs have no upper bound, the start time must still fit into 64 bits */
+    if (entry.duration > 0 && offset > (Unbounded - entry.startTime) / entry.duration)
+        return false;
+
+    startTime   = entry.startTime + offset * entry.duration;
+    duration    = entry.duration;
+    return true;
+}
+bool        RunLengthTimeline::IsInRun              (size_t run, uint64_t index)    const
+{
+    return run < this->runs.size() && index >= this->runs[run].firstSegment && index - this->runs[run].firstSegment < this->runs[run].segmentCount;
+}
+bool        RunLengthTimeline::GetSegmentIndex      (uint64_t time, uint64_t &index)  const
+{
+    if (this->runs.empty())
+        return false;
+
+    std::vector<Run>::const_iterator it = std::upper_bound(this->runs.begin(), this->runs.end(), time, CompareStartTime);
+
+    /* times before the first Segment map to the first Segment */
+    if (it == this->runs.begin())
+    {
+        index = 0;
+        return true;
+    }
+
+    const Run   &run    = *(it - 1);
+    uint64_t    offset  = run.duration > 0 ? (time - run.startTime) / run.duration : 0;
+
+    if (offset < run.segmentCount)
+    {
+        index = run.firstSegment + offset;
+        return true;
+    }
+
+    /* the time falls into a discontinuity, the next Segment starts after it */
+    if (it != this->runs.end())
+    {
+        index = it->firstSegment;
+        return true;
+    }
+
+    return false;
+}
+bool        RunLengthTimeline::CompareFirstSegment  (uint64_t index, const Run &run)
+{
+    return index < run.firstSegment;
+}
+bool        RunLengthTimeline::CompareStartTime     (uint64_t time, const Run &run)
+{
+    return time < run.startTime;
+}
+uint64_t    RunLengthTimeline::CountSegments        (uint64_t startTime, uint64_t endTime, uint64_t duration)
+{
+    if (endTime <= startTime || duration == 0)
+        return 0;
+
+    return (endTime - startTime) / duration + ((endTime - startTime) % duration ? 1 : 0);
+}
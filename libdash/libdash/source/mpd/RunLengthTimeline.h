@@ -0,0 +1,76 @@
+/*
+ * RunLengthTimeline.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef RUNLENGTHTIMELINE_H_
+#define RUNLENGTHTIMELINE_H_
+
+#include "config.h"
+
+#include "Timeline.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /*
+         *  Index over the S elements of a SegmentTimeline that keeps one run per S element instead of one entry
+         *  per Segment. Every run stores its resolved start time and the number of the first Segment it contains,
+         *  so both time and Segment number lookups are binary searches over the runs.
+         *  An S element with @r = -1 repeats until the @t of the following element, if it is the last element it
+         *  is open ended and bounded by the end time that is passed to GetSegmentCount.
+         */
+        class RunLengthTimeline
+        {
+            public:
+                RunLengthTimeline           ();
+                virtual ~RunLengthTimeline  ();
+
+                void        Add                 (const Timeline *timeline);
+                void        Build               (const std::vector<ITimeline *> &timelines);
+                void        Clear               ();
+
+                size_t      GetRunCount         ()  const;
+                uint64_t    GetRunStartTime     (size_t run)    const;
+                uint64_t    GetRunEndTime       (size_t run)    const;
+
+                uint64_t    GetSegmentCount     (uint64_t endTime)  const;
+                bool        GetSegment          (uint64_t index, uint64_t &startTime, uint64_t &duration) const;
+                bool        GetSegmentIndex     (uint64_t time, uint64_t &index)  const;
+
+                /*
+                 *  Like GetSegment, run holds the run of the previous lookup and receives the one of this lookup, so that
+                 *  consecutive Segments are found without a search.
+                 */
+                bool        GetSegment          (uint64_t index, uint64_t &startTime, uint64_t &duration, size_t &run) const;
+
+                static const uint64_t Unbounded = 0xFFFFFFFFFFFFFFFFULL;
+
+            private:
+                struct Run
+                {
+                    uint64_t    startTime;
+                    uint64_t    duration;
+                    uint64_t    firstSegment;
+                    uint64_t    segmentCount;   /* Unbounded while the run repeats until the end of the Period */
+                };
+
+                bool            IsInRun             (size_t run, uint64_t index)    const;
+
+                static bool     CompareFirstSegment (uint64_t index, const Run &run);
+                static bool     CompareStartTime    (uint64_t time, const Run &run);
+                static uint64_t CountSegments       (uint64_t startTime, uint64_t endTime, uint64_t duration);
+
+                std::vector<Run>    runs;
+        };
+    }
+}
+
+#endif /* RUNLENGTHTIMELINE_H_ */
@@ -10,6 +10,7 @@
  *****************************************************************************/
 
 #include "Segment.h"
+#include "ResolvedBaseUrl.h"
 
 using namespace dash::mpd;
 using namespace dash::helpers;
@@ -36,6 +37,15 @@ bool                Segment::Init               (const std::vector<IBaseUrl *>&
     size_t      startByte   = 0;
     size_t      endByte     = 0;
 
+    /* a resolved base URL only resolves the relative part of the uri */
+    if (baseurls.size() == 1 && uri != "")
+    {
+        const ResolvedBaseUrl *resolved = dynamic_cast<const ResolvedBaseUrl *>(baseurls.at(0));
+
+        if (resolved)
+            return this->Init(*resolved, uri, range, type);
+    }
+
     this->absoluteuri = "";
 
     for(size_t i = 0; i < baseurls.size(); i++)
@@ -64,6 +74,47 @@ bool                Segment::Init               (const std::vector<IBaseUrl *>&
 
     return false;
 }
+bool                Segment::Init               (const ResolvedBaseUrl& baseurl, const std::string &uri, const std::string &range, HTTPTransactionType type)
+{
+    size_t startByte    = 0;
+    size_t endByte      = 0;
+
+    this->absoluteuri = baseurl.Resolve(uri);
+
+    size_t pathOffset = baseurl.GetPathOffset(this->absoluteuri);
+
+    if (pathOffset != std::string::npos)
+    {
+        this->host = baseurl.GetHost();
+        this->port = baseurl.GetPort();
+        this->path = this->absoluteuri.substr(pathOffset);
+    }
+    else
+    {
+        std::string host    = "";
+        size_t      port    = this->absoluteuri.compare(0, 8, "https://") == 0 ? 443 : 80;
+        std::string path    = "";
+
+        if (!dash::helpers::Path::GetHostPortAndPath(this->absoluteuri, host, port, path))
+            return false;
+
+        this->host = host;
+        this->port = port;
+        this->path = path;
+    }
+
+    if (range != "" && dash::helpers::Path::GetStartAndEndBytes(range, startByte, endByte))
+    {
+        this->range         = range;
+        this->hasByteRange  = true;
+        this->startByte     = startByte;
+        this->endByte       = endByte;
+    }
+
+    this->type = type;
+
+    return true;
+}
 std::string&        Segment::AbsoluteURI        ()
 {
     return this->absoluteuri;
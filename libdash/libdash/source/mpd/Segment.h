@@ -24,6 +24,8 @@ namespace dash
 {
     namespace mpd
     {
+        class ResolvedBaseUrl;
+
         class Segment : public network::AbstractChunk, public virtual ISegment
         {
             public:
@@ -32,6 +34,8 @@ namespace dash
 
                 bool                                Init            (const std::vector<IBaseUrl *>& baseurls, const std::string &uri,
                                                                      const std::string &range, dash::metrics::HTTPTransactionType type);
+                bool                                Init            (const ResolvedBaseUrl& baseurl, const std::string &uri,
+                                                                     const std::string &range, dash::metrics::HTTPTransactionType type);
                 std::string&                        AbsoluteURI     ();
                 std::string&                        Host            ();
                 size_t                              Port            ();
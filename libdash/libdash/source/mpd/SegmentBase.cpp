@@ -76,3 +76,21 @@ void                SegmentBase::SetIndexRangeExact         (bool indexRangeExac
 {
     this->indexRangeExact = indexRangeExact;
 }
+void                SegmentBase::Refresh                    (SegmentBase *update, RefreshReport &report)
+{
+    if (this->GetDigest() == update->GetDigest())
+        return;
+
+    this->SwapElement(*update);
+    this->SwapSegmentBase(*update);
+    report.AddUpdatedElement(this);
+}
+void                SegmentBase::SwapSegmentBase            (SegmentBase &other)
+{
+    std::swap(this->initialization,         other.initialization);
+    std::swap(this->representationIndex,    other.representationIndex);
+    std::swap(this->timescale,              other.timescale);
+    std::swap(this->presentationTimeOffset, other.presentationTimeOffset);
+    std::swap(this->indexRange,             other.indexRange);
+    std::swap(this->indexRangeExact,        other.indexRangeExact);
+}
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "ISegmentBase.h"
 #include "URLType.h"
 #include "AbstractMPDElement.h"
+#include "RefreshReport.h"
 
 namespace dash
 {
@@ -42,7 +43,14 @@ namespace dash
                 void    SetIndexRange               (const std::string& indexRange);
                 void    SetIndexRangeExact          (bool indexRangeExact);
 
+                /*
+                 *  Takes over the attributes of the given SegmentBase, which is deleted by the caller afterwards.
+                 */
+                void    Refresh                     (SegmentBase *update, RefreshReport &report);
+
             protected:
+                void    SwapSegmentBase             (SegmentBase &other);
+
                 URLType     *initialization;
                 URLType     *representationIndex;
                 uint32_t    timescale;
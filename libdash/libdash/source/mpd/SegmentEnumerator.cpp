@@ -0,0 +1,348 @@
+/*
+ * SegmentEnumerator.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "SegmentEnumerator.h"
+
+using namespace dash::mpd;
+using namespace dash::helpers;
+using namespace dash::metrics;
+
+SegmentEnumerator::SegmentEnumerator                (ResolvedBaseUrl *baseUrl, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation,
+                                                     const Duration& periodDuration) :
+                   baseUrl                          (baseUrl),
+                   segmentBase                      (NULL),
+                   segmentList                      (NULL),
+                   segmentTemplate                  (NULL),
+                   segmentTimeline                  (NULL),
+                   runTimeline                      (NULL),
+                   hasSegments                      (true),
+                   openEnded                        (false),
+                   timescale                        (1),
+                   presentationTimeOffset           (0),
+                   duration                         (0),
+                   startNumber                      (1),
+                   periodLength                     (0),
+                   count                            (0),
+                   hasInitialization                (false),
+                   hasBitstreamSwitching            (false),
+                   stage                            (StageInitialization),
+                   current                          (0),
+                   run                              (0)
+{
+    /* the segment information of the lowest level that has one is used */
+    if (representation->GetSegmentList())
+        this->segmentList = representation->GetSegmentList();
+    else if (representation->GetSegmentTemplate())
+        this->segmentTemplate = representation->GetSegmentTemplate();
+    else if (representation->GetSegmentBase())
+        this->segmentBase = representation->GetSegmentBase();
+    else if (adaptationSet && adaptationSet->GetSegmentList())
+        this->segmentList = adaptationSet->GetSegmentList();
+    else if (adaptationSet && adaptationSet->GetSegmentTemplate())
+        this->segmentTemplate = adaptationSet->GetSegmentTemplate();
+    else if (adaptationSet && adaptationSet->GetSegmentBase())
+        this->segmentBase = adaptationSet->GetSegmentBase();
+    else if (period && period->GetSegmentList())
+        this->segmentList = period->GetSegmentList();
+    else if (period && period->GetSegmentTemplate())
+        this->segmentTemplate = period->GetSegmentTemplate();
+    else if (period && period->GetSegmentBase())
+        this->segmentBase = period->GetSegmentBase();
+
+    const IMultipleSegmentBase  *multiple   = this->segmentList ? (const IMultipleSegmentBase *) this->segmentList : this->segmentTemplate;
+    const ISegmentBase          *base       = multiple ? (const ISegmentBase *) multiple : this->segmentBase;
+
+    if (base)
+    {
+        this->timescale                 = base->GetTimescale() ? base->GetTimescale() : 1;
+        this->presentationTimeOffset    = base->GetPresentationTimeOffset();
+
+        if (base->GetInitialization())
+        {
+            this->initialization        = base->GetInitialization()->GetSourceURL();
+            this->initializationRange   = base->GetInitialization()->GetRange();
+            this->hasInitialization     = true;
+        }
+    }
+
+    if (periodDuration.isValid && periodDuration.ticks > 0)
+        this->periodLength = (uint64_t) (periodDuration.ticks / TicksPerSecond) * this->timescale +
+                             (uint64_t) (periodDuration.ticks % TicksPerSecond) * this->timescale / TicksPerSecond;
+
+    if (multiple)
+    {
+        this->duration          = multiple->GetDuration();
+        this->startNumber       = multiple->GetStartNumber();
+        this->segmentTimeline   = multiple->GetSegmentTimeline();
+        this->runTimeline       = dynamic_cast<const SegmentTimeline *>(this->segmentTimeline);
+
+        if (multiple->GetBitstreamSwitching())
+        {
+            this->bitstreamSwitching        = multiple->GetBitstreamSwitching()->GetSourceURL();
+            this->bitstreamSwitchingRange   = multiple->GetBitstreamSwitching()->GetRange();
+            this->hasBitstreamSwitching     = true;
+        }
+    }
+
+    if (this->segmentTemplate)
+    {
+        CompiledURLTemplate compiled;
+
+        compiled.Compile(this->segmentTemplate->Getmedia());
+        compiled.Bind(representation->GetId(), representation->GetBandwidth(), this->mediaTemplate);
+
+        compiled.Compile(this->segmentTemplate->Getindex());
+        compiled.Bind(representation->GetId(), representation->GetBandwidth(), this->indexTemplate);
+
+        if (!this->hasInitialization && this->segmentTemplate->Getinitialization() != "")
+        {
+            compiled.Compile(this->segmentTemplate->Getinitialization());
+            this->initialization    = compiled.Render(representation->GetId(), representation->GetBandwidth(), 0, 0);
+            this->hasInitialization = true;
+        }
+
+        if (!this->hasBitstreamSwitching && this->segmentTemplate->GetbitstreamSwitching() != "")
+        {
+            compiled.Compile(this->segmentTemplate->GetbitstreamSwitching());
+            this->bitstreamSwitching    = compiled.Render(representation->GetId(), representation->GetBandwidth(), 0, 0);
+            this->hasBitstreamSwitching = true;
+        }
+
+        this->buffer.resize(std::max(this->mediaTemplate.GetMaxLength(0), this->indexTemplate.GetMaxLength(0)) + 1);
+
+        /* without @duration and SegmentTimeline the Representation consists of a single Media Segment */
+        if (this->segmentTimeline)
+            this->count = this->segmentTimeline->GetSegmentCount(this->periodLength ? this->presentationTimeOffset + this->periodLength : 0);
+        else if (this->duration == 0)
+            this->count = 1;
+        else if (this->periodLength)
+            this->count = (this->periodLength + this->duration - 1) / this->duration;
+        else
+            this->openEnded = true;
+    }
+    else if (this->segmentList)
+    {
+        this->count = this->segmentList->GetSegmentURLCount();
+    }
+    else
+    {
+        /* a Representation without segment information is a single Media Segment at its BaseURL */
+        this->hasSegments   = this->segmentBase || representation->GetBaseURLs().size() > 0;
+        this->count         = this->hasSegments ? 1 : 0;
+    }
+}
+SegmentEnumerator::~SegmentEnumerator               ()
+{
+    delete(this->baseUrl);
+}
+
+bool        SegmentEnumerator::Next                 (SegmentDescriptor& descriptor)
+{
+    uint64_t number     = 0;
+    uint64_t startTime  = 0;
+    uint64_t duration   = 0;
+
+    while (true)
+    {
+        switch (this->stage)
+        {
+            case StageInitialization:
+                this->stage = StageBitstreamSwitching;
+
+                if (this->hasInitialization)
+                {
+                    this->Describe(descriptor, this->initialization, this->initializationRange, InitializationSegment, 0, this->presentationTimeOffset, 0);
+                    return true;
+                }
+                break;
+
+            case StageBitstreamSwitching:
+                this->stage = StageIndex;
+
+                if (this->hasBitstreamSwitching)
+                {
+                    this->Describe(descriptor, this->bitstreamSwitching, this->bitstreamSwitchingRange, BitstreamSwitchingSegment, 0, this->presentationTimeOffset, 0);
+                    return true;
+                }
+                break;
+
+            case StageIndex:
+                if (!this->hasSegments || (!this->openEnded && this->current >= this->count) || !this->GetTimes(this->current, number, startTime, duration))
+                {
+                    this->stage = StageDone;
+                    break;
+                }
+
+                this->stage = StageMedia;
+
+                if (this->DescribeIndex(descriptor, number, startTime, duration))
+                    return true;
+                break;
+
+            case StageMedia:
+                this->GetTimes(this->current, number, startTime, duration);
+                this->DescribeMedia(descriptor, number, startTime, duration);
+
+                this->current++;
+                this->stage = StageIndex;
+                return true;
+
+            case StageDone:
+                return false;
+        }
+    }
+}
+void        SegmentEnumerator::Reset                ()
+{
+    this->stage     = StageInitialization;
+    this->current   = 0;
+    this->run       = 0;
+}
+uint64_t    SegmentEnumerator::GetMediaSegmentCount ()  const
+{
+    return this->count;
+}
+bool        SegmentEnumerator::IsOpenEnded          ()  const
+{
+    return this->openEnded;
+}
+ISegment*   SegmentEnumerator::ToSegment            (const SegmentDescriptor& descriptor)   const
+{
+    std::string range = "";
+
+    if (descriptor.hasByteRange)
+    {
+        std::stringstream ss;
+        ss << descriptor.firstByte << "-" << descriptor.lastByte;
+        range = ss.str();
+    }
+
+    Segment *seg = new Segment();
+
+    if (seg->Init(*this->baseUrl, descriptor.url, range, descriptor.type))
+        return seg;
+
+    delete(seg);
+
+    return NULL;
+}
+bool        SegmentEnumerator::GetTimes             (uint64_t index, uint64_t& number, uint64_t& startTime, uint64_t& duration)
+{
+    number = this->startNumber + index;
+
+    if (this->segmentTimeline)
+    {
+        bool found = this->runTimeline ? this->runTimeline->GetSegment(index, startTime, duration, this->run)
+                                       : this->segmentTimeline->GetSegment(index, startTime, duration);
+
+        /* a SegmentList may have more SegmentURLs than its timeline describes */
+        if (found || this->segmentTemplate)
+            return found;
+    }
+
+    uint64_t offset = index * this->duration;
+
+    startTime   = this->presentationTimeOffset + offset;
+    duration    = this->duration;
+
+    /* the last Segment ends with the Period */
+    if (this->duration == 0 || (this->periodLength && offset + this->duration > this->periodLength))
+        duration = this->periodLength > offset ? this->periodLength - offset : 0;
+
+    return true;
+}
+bool        SegmentEnumerator::DescribeIndex        (SegmentDescriptor& descriptor, uint64_t number, uint64_t startTime, uint64_t duration)
+{
+    if (this->segmentTemplate)
+    {
+        /* an empty @index compiles to a template without parts */
+        if (this->indexTemplate.GetMaxLength(0) == 0)
+            return false;
+
+        this->Render(this->indexTemplate, number, startTime);
+        this->Describe(descriptor, this->reference, "", IndexSegment, number, startTime, duration);
+        return true;
+    }
+
+    if (this->segmentList)
+    {
+        const ISegmentURL *segmentURL = this->segmentList->GetSegmentURL((size_t) this->current);
+
+        if (segmentURL->GetIndexURI() == "" && segmentURL->GetIndexRange() == "")
+            return false;
+
+        /* without @index the index is a byte range of the Media Segment */
+        const std::string &uri = segmentURL->GetIndexURI() != "" ? segmentURL->GetIndexURI() : segmentURL->GetMediaURI();
+
+        this->Describe(descriptor, uri, segmentURL->GetIndexRange(), IndexSegment, number, startTime, duration);
+        return true;
+    }
+
+    if (this->segmentBase)
+    {
+        if (this->segmentBase->GetRepresentationIndex())
+            this->Describe(descriptor, this->segmentBase->GetRepresentationIndex()->GetSourceURL(), this->segmentBase->GetRepresentationIndex()->GetRange(),
+                           IndexSegment, number, startTime, duration);
+        else if (this->segmentBase->GetIndexRange() != "")
+            this->Describe(descriptor, "", this->segmentBase->GetIndexRange(), IndexSegment, number, startTime, duration);
+        else
+            return false;
+
+        return true;
+    }
+
+    return false;
+}
+void        SegmentEnumerator::DescribeMedia        (SegmentDescriptor& descriptor, uint64_t number, uint64_t startTime, uint64_t duration)
+{
+    if (this->segmentTemplate)
+    {
+        this->Render(this->mediaTemplate, number, startTime);
+        this->Describe(descriptor, this->reference, "", MediaSegment, number, startTime, duration);
+        return;
+    }
+
+    if (this->segmentList)
+    {
+        const ISegmentURL *segmentURL = this->segmentList->GetSegmentURL((size_t) this->current);
+
+        this->Describe(descriptor, segmentURL->GetMediaURI(), segmentURL->GetMediaRange(), MediaSegment, number, startTime, duration);
+        return;
+    }
+
+    /* the Media Segment of a SegmentBase is the resource of the BaseURL */
+    this->Describe(descriptor, "", "", MediaSegment, number, startTime, duration);
+}
+void        SegmentEnumerator::Describe             (SegmentDescriptor& descriptor, const std::string& reference, const std::string& range,
+                                                     HTTPTransactionType type, uint64_t number, uint64_t startTime, uint64_t duration)
+{
+    size_t firstByte    = 0;
+    size_t lastByte     = 0;
+
+    this->baseUrl->Resolve(reference, descriptor.url);
+
+    descriptor.hasByteRange             = range != "" && Path::GetStartAndEndBytes(range, firstByte, lastByte);
+    descriptor.firstByte                = descriptor.hasByteRange ? firstByte : 0;
+    descriptor.lastByte                 = descriptor.hasByteRange ? lastByte : 0;
+    descriptor.type                     = type;
+    descriptor.number                   = number;
+    descriptor.startTime                = startTime;
+    descriptor.duration                 = duration;
+    descriptor.timescale                = this->timescale;
+    descriptor.presentationTimeOffset   = this->presentationTimeOffset;
+}
+void        SegmentEnumerator::Render               (const CompiledURLTemplate& compiled, uint64_t number, uint64_t time)
+{
+    /* the template is bound, so the representation ID and the bandwidth are already part of its literals */
+    size_t length = compiled.Render(&this->buffer[0], std::string(), 0, number, time);
+
+    this->reference.assign(&this->buffer[0], length);
+}
@@ -0,0 +1,101 @@
+/*
+ * SegmentEnumerator.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SEGMENTENUMERATOR_H_
+#define SEGMENTENUMERATOR_H_
+
+#include "config.h"
+
+#include "ISegmentEnumerator.h"
+#include "IPeriod.h"
+#include "MPDValues.h"
+#include "ResolvedBaseUrl.h"
+#include "CompiledURLTemplate.h"
+#include "SegmentTimeline.h"
+#include "Segment.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /*
+         *  Walks the Segments of a Representation. The base URL is resolved and the templates are bound to the Representation
+         *  when the enumerator is created, so describing a Segment renders and resolves its URL into the strings of the
+         *  descriptor without creating any other object.
+         */
+        class SegmentEnumerator : public ISegmentEnumerator
+        {
+            public:
+                /*
+                 *  Takes over the base URL. The duration of the Period is not valid if it is not known.
+                 */
+                SegmentEnumerator           (ResolvedBaseUrl *baseUrl, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation,
+                                             const Duration& periodDuration);
+                virtual ~SegmentEnumerator  ();
+
+                bool        Next                    (SegmentDescriptor& descriptor);
+                void        Reset                   ();
+                uint64_t    GetMediaSegmentCount    ()  const;
+                bool        IsOpenEnded             ()  const;
+                ISegment*   ToSegment               (const SegmentDescriptor& descriptor)   const;
+
+            private:
+                enum Stage
+                {
+                    StageInitialization,
+                    StageBitstreamSwitching,
+                    StageIndex,
+                    StageMedia,
+                    StageDone
+                };
+
+                bool        GetTimes        (uint64_t index, uint64_t& number, uint64_t& startTime, uint64_t& duration);
+                bool        DescribeIndex   (SegmentDescriptor& descriptor, uint64_t number, uint64_t startTime, uint64_t duration);
+                void        DescribeMedia   (SegmentDescriptor& descriptor, uint64_t number, uint64_t startTime, uint64_t duration);
+                void        Describe        (SegmentDescriptor& descriptor, const std::string& reference, const std::string& range,
+                                             dash::metrics::HTTPTransactionType type, uint64_t number, uint64_t startTime, uint64_t duration);
+                void        Render          (const CompiledURLTemplate& compiled, uint64_t number, uint64_t time);
+
+                ResolvedBaseUrl             *baseUrl;
+                const ISegmentBase          *segmentBase;
+                const ISegmentList          *segmentList;
+                const ISegmentTemplate      *segmentTemplate;
+                const ISegmentTimeline      *segmentTimeline;
+                const SegmentTimeline       *runTimeline;       /* the timeline with lookup hints, if it is one of ours */
+                bool                        hasSegments;
+                bool                        openEnded;
+                uint32_t                    timescale;
+                uint64_t                    presentationTimeOffset;
+                uint32_t                    duration;
+                uint32_t                    startNumber;
+                uint64_t                    periodLength;       /* in units of the timescale, 0 if it is not known */
+                uint64_t                    count;
+
+                /* the templates of a SegmentTemplate, bound to the Representation */
+                CompiledURLTemplate         mediaTemplate;
+                CompiledURLTemplate         indexTemplate;
+                std::string                 initialization;
+                std::string                 initializationRange;
+                bool                        hasInitialization;
+                std::string                 bitstreamSwitching;
+                std::string                 bitstreamSwitchingRange;
+                bool                        hasBitstreamSwitching;
+
+                Stage                       stage;
+                uint64_t                    current;
+                size_t                      run;
+                std::vector<char>           buffer;
+                std::string                 reference;
+        };
+    }
+}
+
+#endif /* SEGMENTENUMERATOR_H_ */
@@ -0,0 +1,319 @@
+/*
+ * SegmentIndex.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "SegmentIndex.h"
+
+using namespace dash::mpd;
+using namespace dash::metrics;
+
+/* limits the nesting of sidx boxes within one piece of data, a reference to an enclosing box would recurse forever */
+const size_t SegmentIndex::MAXDEPTH = 16;
+
+SegmentIndex::SegmentIndex                  (ResolvedBaseUrl *baseUrl, const std::string& url, uint64_t presentationTimeOffset, uint32_t timescale) :
+              baseUrl                       (baseUrl),
+              url                           (url),
+              presentationTimeOffset        (presentationTimeOffset),
+              presentationTimeOffsetTimescale (timescale ? timescale : 1),
+              timescale                     (0),
+              pending                       (0)
+{
+}
+SegmentIndex::~SegmentIndex                 ()
+{
+    delete(this->baseUrl);
+}
+
+uint32_t            SegmentIndex::GetTimescale                  ()  const
+{
+    return this->timescale ? this->timescale : 1;
+}
+uint64_t            SegmentIndex::GetEarliestPresentationTime   ()  const
+{
+    return this->references.size() ? this->references.at(0).startTime : 0;
+}
+size_t              SegmentIndex::GetSubsegmentCount            ()  const
+{
+    return this->references.size();
+}
+bool                SegmentIndex::GetSubsegment                 (size_t index, SegmentDescriptor& descriptor)   const
+{
+    if (index >= this->references.size() || this->references.at(index).isIndex)
+        return false;
+
+    const Reference &reference = this->references.at(index);
+
+    descriptor.url                      = this->url;
+    descriptor.firstByte                = reference.offset;
+    descriptor.lastByte                 = reference.offset + reference.size - 1;
+    descriptor.hasByteRange             = true;
+    descriptor.type                     = MediaSegment;
+    descriptor.number                   = index;
+    descriptor.startTime                = reference.startTime;
+    descriptor.duration                 = reference.duration;
+    descriptor.timescale                = this->GetTimescale();
+    descriptor.presentationTimeOffset   = this->Rescale(this->presentationTimeOffset, this->presentationTimeOffsetTimescale);
+
+    return true;
+}
+bool                SegmentIndex::FindSubsegment                (uint64_t time, size_t& index)  const
+{
+    if (this->references.empty() || this->pending)
+        return false;
+
+    /* the last Subsegment that starts at or before the time */
+    size_t first = 0;
+    size_t last  = this->references.size();
+
+    while (last - first > 1)
+    {
+        size_t middle = first + (last - first) / 2;
+
+        if (this->references.at(middle).startTime <= time)
+            first = middle;
+        else
+            last = middle;
+    }
+
+    const Reference &reference = this->references.at(first);
+
+    if (first + 1 == this->references.size() && time >= reference.startTime + reference.duration)
+        return false;
+
+    index = first;
+    return true;
+}
+ISegment*           SegmentIndex::ToSegment                     (size_t index)  const
+{
+    if (index >= this->references.size() || this->references.at(index).isIndex)
+        return NULL;
+
+    const Reference &reference = this->references.at(index);
+
+    std::stringstream ss;
+    ss << reference.offset << "-" << (reference.offset + reference.size - 1);
+
+    Segment *seg = new Segment();
+
+    if (seg->Init(*this->baseUrl, this->url, ss.str(), MediaSegment))
+        return seg;
+
+    delete(seg);
+
+    return NULL;
+}
+const std::string&  SegmentIndex::GetUrl                        ()  const
+{
+    return this->url;
+}
+bool                SegmentIndex::Parse                         (const uint8_t *data, size_t length, uint64_t offset)
+{
+    size_t      position    = 0;
+    uint64_t    size        = 0;
+
+    if (!FindBox(data, length, "sidx", position, size) || size > length - position)
+        return false;
+
+    std::vector<Reference> parsed;
+
+    if (!this->ParseBox(data, length, position, offset, 0, parsed))
+        return false;
+
+    this->references.swap(parsed);
+    this->pending = 0;
+
+    for (size_t i = 0; i < this->references.size(); i++)
+        if (this->references.at(i).isIndex)
+            this->pending++;
+
+    return true;
+}
+bool                SegmentIndex::HasPendingReference           ()  const
+{
+    return this->pending > 0;
+}
+void                SegmentIndex::GetPendingReference           (uint64_t& firstByte, uint64_t& lastByte)   const
+{
+    for (size_t i = 0; i < this->references.size(); i++)
+    {
+        if (this->references.at(i).isIndex)
+        {
+            firstByte   = this->references.at(i).offset;
+            lastByte    = this->references.at(i).offset + this->references.at(i).size - 1;
+            return;
+        }
+    }
+}
+bool                SegmentIndex::ParsePending                  (const uint8_t *data, size_t length)
+{
+    size_t i = 0;
+
+    while (i < this->references.size() && !this->references.at(i).isIndex)
+        i++;
+
+    if (i == this->references.size())
+        return false;
+
+    std::vector<Reference> parsed;
+
+    if (!this->ParseBox(data, length, 0, this->references.at(i).offset, 0, parsed))
+        return false;
+
+    this->references.erase(this->references.begin() + i);
+    this->references.insert(this->references.begin() + i, parsed.begin(), parsed.end());
+    this->pending--;
+
+    for (size_t j = 0; j < parsed.size(); j++)
+        if (parsed.at(j).isIndex)
+            this->pending++;
+
+    return true;
+}
+bool                SegmentIndex::FindBox                       (const uint8_t *data, size_t length, const char *type, size_t& position, uint64_t& size)
+{
+    uint32_t    wanted      = ReadUInt32((const uint8_t *) type);
+    uint32_t    boxType     = 0;
+    size_t      headerSize  = 0;
+
+    position = 0;
+
+    while (ReadBoxHeader(data, length, position, size, headerSize, boxType))
+    {
+        if (boxType == wanted)
+            return true;
+
+        if (size >= length - position)
+            return false;
+
+        position += (size_t) size;
+    }
+
+    return false;
+}
+bool                SegmentIndex::ParseBox                      (const uint8_t *data, size_t length, size_t position, uint64_t offset, size_t depth,
+                                                                 std::vector<Reference>& references)
+{
+    uint64_t    size        = 0;
+    size_t      headerSize  = 0;
+    uint32_t    type        = 0;
+
+    if (depth > MAXDEPTH || !ReadBoxHeader(data, length, position, size, headerSize, type) || type != ReadUInt32((const uint8_t *) "sidx") ||
+        size > length - position)
+        return false;
+
+    /* version and flags, reference_ID and timescale are followed by the times, whose size depends on the version */
+    const uint8_t   *box        = data + position + headerSize;
+    size_t          boxLength   = (size_t) size - headerSize;
+    bool            isVersion1  = boxLength > 0 && box[0] == 1;
+    size_t          fixedLength = isVersion1 ? 32 : 24;
+
+    if (boxLength < fixedLength)
+        return false;
+
+    uint32_t    timescale           = ReadUInt32(box + 8);
+    uint64_t    earliestTime        = isVersion1 ? ReadUInt64(box + 12) : ReadUInt32(box + 12);
+    uint64_t    firstOffset         = isVersion1 ? ReadUInt64(box + 20) : ReadUInt32(box + 16);
+    uint16_t    referenceCount      = (uint16_t) ((box[fixedLength - 2] << 8) | box[fixedLength - 1]);
+
+    if (timescale == 0 || boxLength < fixedLength + 12 * (size_t) referenceCount)
+        return false;
+
+    if (this->timescale == 0)
+        this->timescale = timescale;
+
+    /* the first referenced byte follows the sidx box */
+    uint64_t anchor = offset + position + size + firstOffset;
+    uint64_t time   = earliestTime;
+
+    for (uint16_t i = 0; i < referenceCount; i++)
+    {
+        const uint8_t *entry = box + fixedLength + 12 * (size_t) i;
+
+        Reference reference;
+        reference.offset    = anchor;
+        reference.size      = ReadUInt32(entry) & 0x7FFFFFFF;
+        reference.startTime = this->Rescale(time, timescale);
+        reference.duration  = this->Rescale(time + ReadUInt32(entry + 4), timescale) - reference.startTime;
+        reference.isIndex   = (entry[0] & 0x80) != 0;
+
+        if (reference.size == 0)
+            return false;
+
+        /* a hierarchical or daisy-chained index. The reference spans the sidx box and the Subsegments it indexes, which are
+           not part of the data, the referenced box has its own earliest presentation time */
+        if (reference.isIndex && IsBoxComplete(data, length, anchor, offset))
+        {
+            if (!this->ParseBox(data, length, (size_t) (anchor - offset), offset, depth + 1, references))
+                return false;
+        }
+        else
+        {
+            references.push_back(reference);
+        }
+
+        anchor += reference.size;
+        time   += ReadUInt32(entry + 4);
+    }
+
+    return true;
+}
+uint64_t            SegmentIndex::Rescale                       (uint64_t time, uint32_t timescale) const
+{
+    uint64_t target = this->GetTimescale();
+
+    if (timescale == target)
+        return time;
+
+    return (time / timescale) * target + (time % timescale) * target / timescale;
+}
+bool                SegmentIndex::IsBoxComplete                 (const uint8_t *data, size_t length, uint64_t position, uint64_t offset)
+{
+    uint64_t    size        = 0;
+    size_t      headerSize  = 0;
+    uint32_t    type        = 0;
+
+    if (position < offset || position - offset >= length)
+        return false;
+
+    return ReadBoxHeader(data, length, (size_t) (position - offset), size, headerSize, type) && size <= length - (size_t) (position - offset);
+}
+bool                SegmentIndex::ReadBoxHeader                 (const uint8_t *data, size_t length, size_t position, uint64_t& size, size_t& headerSize, uint32_t& type)
+{
+    if (position > length || length - position < 8)
+        return false;
+
+    size        = ReadUInt32(data + position);
+    type        = ReadUInt32(data + position + 4);
+    headerSize  = 8;
+
+    if (size == 1)
+    {
+        if (length - position < 16)
+            return false;
+
+        size        = ReadUInt64(data + position + 8);
+        headerSize  = 16;
+    }
+    else if (size == 0)
+    {
+        /* the box extends to the end of the file */
+        size = length - position;
+    }
+
+    return size >= headerSize;
+}
+uint32_t            SegmentIndex::ReadUInt32                    (const uint8_t *data)
+{
+    return ((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) | ((uint32_t) data[2] << 8) | (uint32_t) data[3];
+}
+uint64_t            SegmentIndex::ReadUInt64                    (const uint8_t *data)
+{
+    return ((uint64_t) ReadUInt32(data) << 32) | ReadUInt32(data + 4);
+}
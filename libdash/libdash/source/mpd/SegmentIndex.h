@@ -0,0 +1,103 @@
+/*
+ * SegmentIndex.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SEGMENTINDEX_H_
+#define SEGMENTINDEX_H_
+
+#include "config.h"
+
+#include "ISegmentIndex.h"
+#include "ResolvedBaseUrl.h"
+#include "Segment.h"
+
+namespace dash
+{
+    namespace mpd
+    {
+        /*
+         *  The references of the sidx boxes of a Media Segment in presentation order. A reference to a sidx box that has not been
+         *  parsed yet is kept as a pending reference until its bytes are passed to ParsePending, so the index is complete once
+         *  HasPendingReference returns false. Byte offsets are counted from the start of the Media Segment.
+         */
+        class SegmentIndex : public ISegmentIndex
+        {
+            public:
+                /*
+                 *  Takes over the base URL, the presentation time offset is given in units of its own timescale.
+                 */
+                SegmentIndex            (ResolvedBaseUrl *baseUrl, const std::string& url, uint64_t presentationTimeOffset, uint32_t timescale);
+                virtual ~SegmentIndex   ();
+
+                uint32_t    GetTimescale                    ()  const;
+                uint64_t    GetEarliestPresentationTime     ()  const;
+                size_t      GetSubsegmentCount              ()  const;
+                bool        GetSubsegment                   (size_t index, SegmentDescriptor& descriptor)   const;
+                bool        FindSubsegment                  (uint64_t time, size_t& index)  const;
+                ISegment*   ToSegment                       (size_t index)  const;
+
+                const std::string&  GetUrl              ()  const;
+
+                /*
+                 *  Parses the first sidx box of the data, which starts at the given offset of the Media Segment. References to sidx
+                 *  boxes that lie within the data are followed at once. Returns false if there is no complete sidx box.
+                 */
+                bool        Parse                   (const uint8_t *data, size_t length, uint64_t offset);
+
+                /*
+                 *  The range of a pending reference covers the sidx box and the Subsegments that it indexes.
+                 */
+                bool        HasPendingReference     ()  const;
+                void        GetPendingReference     (uint64_t& firstByte, uint64_t& lastByte)   const;
+
+                /*
+                 *  Replaces the first pending reference by the references of the sidx box at the start of the data.
+                 */
+                bool        ParsePending            (const uint8_t *data, size_t length);
+
+                /*
+                 *  Finds the first box of the given type among the boxes at the top level of the data. The size of the box may
+                 *  exceed the data if the box is truncated.
+                 */
+                static bool FindBox                 (const uint8_t *data, size_t length, const char *type, size_t& position, uint64_t& size);
+
+            private:
+                struct Reference
+                {
+                    uint64_t    offset;
+                    uint64_t    size;
+                    uint64_t    startTime;
+                    uint64_t    duration;
+                    bool        isIndex;    /* a sidx box that has not been parsed yet */
+                };
+
+                bool        ParseBox            (const uint8_t *data, size_t length, size_t position, uint64_t offset, size_t depth,
+                                                 std::vector<Reference>& references);
+                uint64_t    Rescale             (uint64_t time, uint32_t timescale) const;
+
+                static bool IsBoxComplete       (const uint8_t *data, size_t length, uint64_t position, uint64_t offset);
+                static bool ReadBoxHeader       (const uint8_t *data, size_t length, size_t position, uint64_t& size, size_t& headerSize, uint32_t& type);
+                static uint32_t ReadUInt32      (const uint8_t *data);
+                static uint64_t ReadUInt64      (const uint8_t *data);
+
+                static const size_t MAXDEPTH;
+
+                ResolvedBaseUrl         *baseUrl;
+                std::string             url;
+                uint64_t                presentationTimeOffset;
+                uint32_t                presentationTimeOffsetTimescale;
+                uint32_t                timescale;      /* 0 until the first sidx box has been parsed */
+                std::vector<Reference>  references;
+                size_t                  pending;        /* the number of pending references */
+        };
+    }
+}
+
+#endif /* SEGMENTINDEX_H_ */
@@ -20,17 +20,30 @@ SegmentList::SegmentList    () :
 }
 SegmentList::~SegmentList   ()
 {
-    for (size_t i = 0; i < segmentURLs.size(); i++)
-        delete(this->segmentURLs.at(i));
 }
 
 const std::vector<ISegmentURL*>& SegmentList::GetSegmentURLs    ()  const
 {
-    return (std::vector<ISegmentURL*> &) this->segmentURLs;
+    return (std::vector<ISegmentURL*> &) this->segmentURLs.GetAll();
+}
+size_t                          SegmentList::GetSegmentURLCount ()  const
+{
+    return this->segmentURLs.Count();
+}
+ISegmentURL*                    SegmentList::GetSegmentURL      (size_t index)  const
+{
+    if (index >= this->segmentURLs.Count())
+        return NULL;
+
+    return this->segmentURLs.Get(index);
 }
 void                            SegmentList::AddSegmentURL      (SegmentURL *segmentURL)
 {
-    this->segmentURLs.push_back(segmentURL);
+    this->segmentURLs.Add(segmentURL);
+}
+bool                            SegmentList::AddSegmentURL      (const dash::helpers::InternedAttributes &attributes)
+{
+    return this->segmentURLs.Add(attributes);
 }
 const std::string&              SegmentList::GetXlinkHref       ()  const
 {
@@ -48,3 +61,22 @@ void                            SegmentList::SetXlinkActuate    (const std::stri
 {
     this->xlinkActuate = xlinkActuate;
 }
+const PackedSegmentURLs&        SegmentList::GetPackedSegmentURLs   ()  const
+{
+    return this->segmentURLs;
+}
+void                            SegmentList::Refresh            (SegmentList *update, RefreshReport &report)
+{
+    if (this->GetDigest() != update->GetDigest())
+    {
+        this->SwapElement(*update);
+        this->SwapSegmentBase(*update);
+        this->SwapMultipleSegmentBase(*update);
+        this->segmentURLs.Swap(update->segmentURLs);
+        std::swap(this->xlinkHref,      update->xlinkHref);
+        std::swap(this->xlinkActuate,   update->xlinkActuate);
+        report.AddUpdatedElement(this);
+    }
+
+    this->RefreshSegmentTimeline(*update, report);
+}
\ No newline at end of file
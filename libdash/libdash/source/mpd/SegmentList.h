@@ -17,6 +17,7 @@
 #include "ISegmentList.h"
 #include "MultipleSegmentBase.h"
 #include "SegmentURL.h"
+#include "PackedSegmentURLs.h"
 
 namespace dash
 {
@@ -28,16 +29,32 @@ namespace dash
                 SegmentList             ();
                 virtual ~SegmentList    ();
 
-                const std::vector<ISegmentURL *>&   GetSegmentURLs  ()  const;
+                const std::vector<ISegmentURL *>&   GetSegmentURLs      ()  const;
+                size_t                              GetSegmentURLCount  ()  const;
+                ISegmentURL*                        GetSegmentURL       (size_t index)  const;
                 const std::string&                  GetXlinkHref    ()  const;
                 const std::string&                  GetXlinkActuate ()  const;
 
                 void    AddSegmentURL   (SegmentURL *segmetURL);
+
+                /*
+                 *  Packs a SegmentURL element without sub nodes from its attributes. Returns false if it has attributes
+                 *  besides media, mediaRange, index and indexRange, the caller then adds a SegmentURL object instead.
+                 */
+                bool    AddSegmentURL   (const helpers::InternedAttributes &attributes);
                 void    SetXlinkHref    (const std::string& xlinkHref);
                 void    SetXlinkActuate (const std::string& xlinkActuate);
 
+                /*
+                 *  Takes over the attributes and SegmentURLs of the given SegmentList if they differ and merges
+                 *  the SegmentTimeline. The update is deleted by the caller afterwards.
+                 */
+                void    Refresh         (SegmentList *update, RefreshReport &report);
+
+                const PackedSegmentURLs&    GetPackedSegmentURLs    ()  const;
+
             private:
-                std::vector<SegmentURL *> segmentURLs;
+                PackedSegmentURLs segmentURLs;
                 std::string xlinkHref;
                 std::string xlinkActuate;
         };
@@ -32,6 +32,7 @@ const std::string&  SegmentTemplate::Getmedia                       ()  const
 void                SegmentTemplate::SetMedia                       (const std::string& media)
 {
     this->media = media;
+    this->mediaTemplate.Compile(media);
 }
 const std::string&  SegmentTemplate::Getindex                       ()  const
 {
@@ -40,6 +41,7 @@ const std::string&  SegmentTemplate::Getindex                       ()  const
 void                SegmentTemplate::SetIndex                       (const std::string& index)
 {
     this->index = index;
+    this->indexTemplate.Compile(index);
 }
 const std::string&  SegmentTemplate::Getinitialization              ()  const
 {
@@ -48,6 +50,7 @@ const std::string&  SegmentTemplate::Getinitialization              ()  const
 void                SegmentTemplate::SetInitialization              (const std::string& initialization)
 {
     this->initialization = initialization;
+    this->initializationTemplate.Compile(initialization);
 }
 const std::string&  SegmentTemplate::GetbitstreamSwitching          ()  const
 {
@@ -56,97 +59,181 @@ const std::string&  SegmentTemplate::GetbitstreamSwitching          ()  const
 void                SegmentTemplate::SetBitstreamSwitching          (const std::string& bitstreamSwitching)
 {
     this->bitstreamSwitching = bitstreamSwitching;
+    this->bitstreamSwitchingTemplate.Compile(bitstreamSwitching);
 }
 ISegment*           SegmentTemplate::ToInitializationSegment        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const
 {
-    return ToSegment(this->initialization, baseurls, representationID, bandwidth, dash::metrics::InitializationSegment);
+    return ToSegment(this->initializationTemplate, baseurls, representationID, bandwidth, dash::metrics::InitializationSegment);
 }
 ISegment*           SegmentTemplate::ToBitstreamSwitchingSegment    (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const
 {
-    return ToSegment(this->bitstreamSwitching, baseurls, representationID, bandwidth, dash::metrics::BitstreamSwitchingSegment);
+    return ToSegment(this->bitstreamSwitchingTemplate, baseurls, representationID, bandwidth, dash::metrics::BitstreamSwitchingSegment);
 }
 ISegment*           SegmentTemplate::GetMediaSegmentFromNumber      (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const
 {
-    return ToSegment(this->media, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, number);
+    return ToSegment(this->mediaTemplate, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, number);
 }
 ISegment*           SegmentTemplate::GetIndexSegmentFromNumber      (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const
 {
-    return ToSegment(this->index, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, number);
+    return ToSegment(this->indexTemplate, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, number);
 }
-ISegment*           SegmentTemplate::GetMediaSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const
+ISegment*           SegmentTemplate::GetMediaSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const
 {
-    return ToSegment(this->media, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, 0, time);
+    return ToSegment(this->mediaTemplate, baseurls, representationID, bandwidth, dash::metrics::MediaSegment, 0, time);
 }
-ISegment*           SegmentTemplate::GetIndexSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const
+ISegment*           SegmentTemplate::GetIndexSegmentFromTime        (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const
 {
-    return ToSegment(this->index, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, 0, time);
+    return ToSegment(this->indexTemplate, baseurls, representationID, bandwidth, dash::metrics::IndexSegment, 0, time);
 }
-std::string         SegmentTemplate::ReplaceParameters              (const std::string& uri, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint32_t time) const
+size_t              SegmentTemplate::FormatMediaUrl                 (char *buffer, size_t size, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint64_t time) const
 {
-    std::vector<std::string> chunks;
-    std::string replacedUri = "";
+    if (size > this->mediaTemplate.GetMaxLength(representationID.size()))
+    {
+        size_t length = this->mediaTemplate.Render(buffer, representationID, bandwidth, number, time);
+
+        buffer[length] = '\0';
+        return length;
+    }
+
+    /* the buffer may still be large enough, the maximum length assumes the widest numbers */
+    std::string uri = this->mediaTemplate.Render(representationID, bandwidth, number, time);
+
+    if (size > 0)
+    {
+        size_t length = uri.size() < size ? uri.size() : size - 1;
+
+        memcpy(buffer, uri.data(), length);
+        buffer[length] = '\0';
+    }
+
+    return uri.size();
+}
+size_t              SegmentTemplate::FormatMediaUrlsFromNumber      (const std::string& representationID, uint32_t bandwidth, uint32_t firstNumber, uint32_t count,
+                                                                     std::string& urls, std::vector<size_t>& offsets) const
+{
+    CompiledURLTemplate bound;
+    this->mediaTemplate.Bind(representationID, bandwidth, bound);
+
+    size_t      maxLength   = bound.GetMaxLength(0) + 1;
+    size_t      end         = urls.size();
+    uint32_t    rendered    = 0;
+    uint64_t    time        = 0;
+    size_t      run         = 0;
+
+    offsets.reserve(offsets.size() + count);
+
+    for (; rendered < count && this->GetSegmentTime((uint64_t) firstNumber + rendered, time, run); rendered++)
+        AppendUrl(bound, representationID, urls, end, maxLength, offsets, (uint64_t) firstNumber + rendered, time);
+
+    urls.resize(end);
+
+    return rendered;
+}
+size_t              SegmentTemplate::FormatMediaUrlsFromTime        (const std::string& representationID, uint32_t bandwidth, uint64_t startTime, uint64_t endTime,
+                                                                     std::string& urls, std::vector<size_t>& offsets) const
+{
+    CompiledURLTemplate bound;
+    this->mediaTemplate.Bind(representationID, bandwidth, bound);
+
+    size_t      maxLength   = bound.GetMaxLength(0) + 1;
+    size_t      end         = urls.size();
+    size_t      rendered    = 0;
+    uint64_t    index       = 0;
+    uint64_t    time        = 0;
+    uint64_t    duration    = 0;
+    size_t      run         = 0;
+
+    if (this->segmentTimeline)
+    {
+        if (!this->segmentTimeline->GetSegmentIndex(startTime, index))
+            return 0;
+    }
+    else
+    {
+        if (this->duration == 0)
+            return 0;
 
-    dash::helpers::String::Split(uri, '$', chunks);
+        index = startTime / this->duration;
+    }
 
-    if (chunks.size() > 1) 
+    for (; ; index++, rendered++)
     {
-        for(size_t i = 0; i < chunks.size(); i++) 
+        if (this->segmentTimeline)
         {
-            if ( chunks.at(i) == "RepresentationID") {
-                chunks.at(i) = representationID;
-                continue;
-            }
-
-            if (chunks.at(i).find("Bandwidth") == 0)
-            {
-                FormatChunk(chunks.at(i), bandwidth);
-                continue;
-            }
-
-            if (chunks.at(i).find("Number") == 0)
-            {
-                FormatChunk(chunks.at(i), number);
-                continue;
-            }
-
-            if (chunks.at(i).find("Time") == 0)
-            {
-                FormatChunk(chunks.at(i), time);
-                continue;
-            }
+            if (!this->segmentTimeline->GetSegment(index, time, duration, run))
+                break;
+        }
+        else
+        {
+            if (index > 0xFFFFFFFFFFFFFFFFULL / this->duration)
+                break;
+
+            time = index * this->duration;
         }
 
-        for(size_t i = 0; i < chunks.size(); i++) 
-            replacedUri += chunks.at(i);
+        if (time >= endTime)
+            break;
 
-        return replacedUri;
+        AppendUrl(bound, representationID, urls, end, maxLength, offsets, this->startNumber + index, time);
     }
-    else
+
+    urls.resize(end);
+
+    return rendered;
+}
+bool                SegmentTemplate::GetSegmentTime                 (uint64_t number, uint64_t& time, size_t& run) const
+{
+    uint64_t index = number > this->startNumber ? number - this->startNumber : 0;
+
+    if (this->segmentTimeline)
     {
-        replacedUri = uri;
-        return replacedUri;
+        uint64_t duration = 0;
+        return this->segmentTimeline->GetSegment(index, time, duration, run);
     }
+
+    time = index * this->duration;
+    return true;
 }
-void                SegmentTemplate::FormatChunk                    (std::string& uri, uint32_t number) const
+void                SegmentTemplate::AppendUrl                      (const CompiledURLTemplate& bound, const std::string& representationID, std::string& urls, size_t& end, size_t maxLength,
+                                                                     std::vector<size_t>& offsets, uint64_t number, uint64_t time)
 {
-    char formattedNumber [50];
-    size_t pos = 0;
-    std::string formatTag = "%01d";
+    /* the URLs are rendered in place, the caller shrinks the string to the written URLs afterwards */
+    if (urls.size() < end + maxLength)
+        urls.resize(std::max(urls.size() * 2, end + maxLength));
 
-    if ( (pos = uri.find("%0")) != std::string::npos)
-        formatTag = uri.substr(pos).append("d");
+    offsets.push_back(end);
 
-    sprintf(formattedNumber, formatTag.c_str(), number);
-    uri = formattedNumber;
+    end += bound.Render(&urls[end], representationID, 0, number, time);
+    urls[end++] = '\0';
 }
-ISegment*           SegmentTemplate::ToSegment                      (const std::string& uri, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, HTTPTransactionType type, uint32_t number, uint32_t time) const
+ISegment*           SegmentTemplate::ToSegment                      (const CompiledURLTemplate& uri, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, HTTPTransactionType type, uint64_t number, uint64_t time) const
 {
     Segment *seg = new Segment();
 
-    if(seg->Init(baseurls, ReplaceParameters(uri, representationID, bandwidth, number, time), "", type))
+    if(seg->Init(baseurls, uri.Render(representationID, bandwidth, number, time), "", type))
         return seg;
 
     delete(seg);
 
     return NULL;
+}
+void                SegmentTemplate::Refresh                        (SegmentTemplate *update, RefreshReport &report)
+{
+    if (this->GetDigest() != update->GetDigest())
+    {
+        this->SwapElement(*update);
+        this->SwapSegmentBase(*update);
+        this->SwapMultipleSegmentBase(*update);
+        std::swap(this->media,              update->media);
+        std::swap(this->index,              update->index);
+        std::swap(this->initialization,     update->initialization);
+        std::swap(this->bitstreamSwitching, update->bitstreamSwitching);
+        this->mediaTemplate.Swap(update->mediaTemplate);
+        this->indexTemplate.Swap(update->indexTemplate);
+        this->initializationTemplate.Swap(update->initializationTemplate);
+        this->bitstreamSwitchingTemplate.Swap(update->bitstreamSwitchingTemplate);
+        report.AddUpdatedElement(this);
+    }
+
+    this->RefreshSegmentTimeline(*update, report);
 }
\ No newline at end of file
@@ -16,7 +16,7 @@
 
 #include "ISegmentTemplate.h"
 #include "MultipleSegmentBase.h"
-#include "../helpers/String.h"
+#include "CompiledURLTemplate.h"
 
 namespace dash
 {
@@ -36,24 +36,49 @@ namespace dash
                 ISegment*           ToBitstreamSwitchingSegment (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth) const;
                 ISegment*           GetMediaSegmentFromNumber   (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const;
                 ISegment*           GetIndexSegmentFromNumber   (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t number) const;
-                ISegment*           GetMediaSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const;
-                ISegment*           GetIndexSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint32_t time) const;
+                ISegment*           GetMediaSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const;
+                ISegment*           GetIndexSegmentFromTime     (const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, uint64_t time) const;
+                size_t              FormatMediaUrl              (char *buffer, size_t size, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint64_t time) const;
+                size_t              FormatMediaUrlsFromNumber   (const std::string& representationID, uint32_t bandwidth, uint32_t firstNumber, uint32_t count,
+                                                                 std::string& urls, std::vector<size_t>& offsets) const;
+                size_t              FormatMediaUrlsFromTime     (const std::string& representationID, uint32_t bandwidth, uint64_t startTime, uint64_t endTime,
+                                                                 std::string& urls, std::vector<size_t>& offsets) const;
 
                 void    SetMedia                (const std::string& media);
                 void    SetIndex                (const std::string& index);
                 void    SetInitialization       (const std::string& initialization);
                 void    SetBitstreamSwitching   (const std::string& bitstreamSwichting);
 
+                /*
+                 *  Takes over the attributes of the given SegmentTemplate if they differ and merges the SegmentTimeline.
+                 *  The update is deleted by the caller afterwards.
+                 */
+                void    Refresh                 (SegmentTemplate *update, RefreshReport &report);
+
             private:
-                std::string ReplaceParameters   (const std::string& uri, const std::string& representationID, uint32_t bandwidth, uint32_t number, uint32_t time) const;
-                void        FormatChunk         (std::string& uri, uint32_t number) const;
-                ISegment*   ToSegment           (const std::string& uri, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, 
-                                                 dash::metrics::HTTPTransactionType type, uint32_t number = 0, uint32_t time = 0) const;
+                ISegment*   ToSegment           (const CompiledURLTemplate& uri, const std::vector<IBaseUrl *>& baseurls, const std::string& representationID, uint32_t bandwidth, 
+                                                 dash::metrics::HTTPTransactionType type, uint64_t number = 0, uint64_t time = 0) const;
+
+                /*
+                 *  Returns the time of the Segment with the given number, taken from the SegmentTimeline if there is one and
+                 *  derived from @duration otherwise. run is the lookup hint of the SegmentTimeline for consecutive numbers.
+                 *  False is returned if the number lies beyond the SegmentTimeline.
+                 */
+                bool        GetSegmentTime      (uint64_t number, uint64_t& time, size_t& run) const;
+
+                static void AppendUrl           (const CompiledURLTemplate& bound, const std::string& representationID, std::string& urls, size_t& end, size_t maxLength,
+                                                 std::vector<size_t>& offsets, uint64_t number, uint64_t time);
 
                 std::string media;
                 std::string index;
                 std::string initialization;
                 std::string bitstreamSwitching;
+
+                /* the templates above, compiled whenever they are set */
+                CompiledURLTemplate mediaTemplate;
+                CompiledURLTemplate indexTemplate;
+                CompiledURLTemplate initializationTemplate;
+                CompiledURLTemplate bitstreamSwitchingTemplate;
         };
     }
 }
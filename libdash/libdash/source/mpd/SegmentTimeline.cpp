@@ -22,11 +22,137 @@ SegmentTimeline::~SegmentTimeline   ()
         delete(this->timelines.at(i));
 }
 
-std::vector<ITimeline *>&   SegmentTimeline::GetTimelines   ()  const
+std::vector<ITimeline *>&   SegmentTimeline::GetTimelines       ()  const
 {
     return (std::vector<ITimeline*> &) this->timelines;
 }
-void                        SegmentTimeline::AddTimeline    (Timeline *timeline)
+uint64_t                    SegmentTimeline::GetSegmentCount    (uint64_t endTime)  const
+{
+    return this->runs.GetSegmentCount(endTime);
+}
+bool                        SegmentTimeline::GetSegment         (uint64_t index, uint64_t &startTime, uint64_t &duration) const
+{
+    return this->runs.GetSegment(index, startTime, duration);
+}
+bool                        SegmentTimeline::GetSegment         (uint64_t index, uint64_t &startTime, uint64_t &duration, size_t &run) const
+{
+    return this->runs.GetSegment(index, startTime, duration, run);
+}
+bool                        SegmentTimeline::GetSegmentIndex    (uint64_t time, uint64_t &index)  const
+{
+    return this->runs.GetSegmentIndex(time, index);
+}
+void                        SegmentTimeline::AddTimeline        (Timeline *timeline)
 {
     this->timelines.push_back(timeline);
-}
\ No newline at end of file
+    this->runs.Add(timeline);
+}
+void                        SegmentTimeline::Refresh            (SegmentTimeline *update, RefreshReport &report)
+{
+    std::vector<ITimeline *>    &current        = this->timelines;
+    std::vector<ITimeline *>    &updated        = update->timelines;
+    const RunLengthTimeline     &currentRuns    = this->runs;
+    const RunLengthTimeline     &updatedRuns    = update->runs;
+
+    /* skip the entries that have been removed from the front of the timeline */
+    size_t first = 0;
+
+    if (updated.size())
+    {
+        while (first < current.size() && currentRuns.GetRunEndTime(first) <= updatedRuns.GetRunStartTime(0))
+            first++;
+    }
+
+    /* a sliding window usually starts within a run. The segments of the run before the start of the update have
+       been removed, the rest of the run is compared with the first entry of the update */
+    uint64_t removedTime = 0;
+
+    if (updated.size() && first < current.size() && currentRuns.GetRunStartTime(first) < updatedRuns.GetRunStartTime(0))
+    {
+        uint64_t duration = current.at(first)->GetDuration();
+
+        removedTime = updatedRuns.GetRunStartTime(0) - currentRuns.GetRunStartTime(first);
+
+        if (duration == 0 || removedTime % duration != 0)
+            removedTime = 0;
+    }
+
+    size_t  overlap     = current.size() - first;
+    bool    isAppending = updated.size() > 0 && overlap <= updated.size();
+
+    for (size_t i = 0; isAppending && i < overlap; i++)
+    {
+        uint64_t startTime = currentRuns.GetRunStartTime(first + i) + (i == 0 ? removedTime : 0);
+
+        if (startTime != updatedRuns.GetRunStartTime(i) || current.at(first + i)->GetDuration() != updated.at(i)->GetDuration())
+            isAppending = false;
+        else if (i + 1 < overlap && currentRuns.GetRunEndTime(first + i) != updatedRuns.GetRunEndTime(i))
+            isAppending = false;
+    }
+
+    if (!isAppending)
+    {
+        if (current.size() == 0 && updated.size() == 0)
+            return;
+
+        report.AddRemovedTimelineEntries(current.size());
+        report.AddAppendedTimelineEntries(updated.size());
+        report.AddUpdatedElement(this);
+        std::swap(current, updated);
+        this->runs.Build(current);
+        return;
+    }
+
+    std::vector<ITimeline *>    result;
+    bool                        hasChanged  = first > 0 || overlap < updated.size();
+
+    for (size_t i = 0; i < first; i++)
+        delete(current.at(i));
+
+    for (size_t i = 0; i < overlap; i++)
+    {
+        Timeline *currentEntry = (Timeline *) current.at(first + i);
+        Timeline *updatedEntry = (Timeline *) updated.at(i);
+
+        if (currentEntry->GetStartTime()   == updatedEntry->GetStartTime() &&
+            currentEntry->GetRepeatCount() == updatedEntry->GetRepeatCount() &&
+            currentEntry->HasStartTime()   == updatedEntry->HasStartTime())
+        {
+            result.push_back(currentEntry);
+            continue;
+        }
+
+        /* the entry changed in place, e.g. its repeat count grew or it has been split, the old one is deleted with the update */
+        result.push_back(updatedEntry);
+        updated.at(i)   = currentEntry;
+        hasChanged      = true;
+    }
+
+    for (size_t i = overlap; i < updated.size(); i++)
+    {
+        result.push_back(updated.at(i));
+        updated.at(i) = NULL;
+    }
+
+    report.AddRemovedTimelineEntries(first);
+    report.AddAppendedTimelineEntries(updated.size() - overlap);
+
+    if (hasChanged)
+        report.AddUpdatedElement(this);
+
+    current.swap(result);
+    this->runs.Build(current);
+}
+void                        SegmentTimeline::Append             (SegmentTimeline *update, RefreshReport &report)
+{
+    if (update->timelines.empty())
+        return;
+
+    for (size_t i = 0; i < update->timelines.size(); i++)
+        this->AddTimeline((Timeline *) update->timelines.at(i));
+
+    report.AddAppendedTimelineEntries(update->timelines.size());
+    report.AddUpdatedElement(this);
+
+    update->timelines.clear();
+}
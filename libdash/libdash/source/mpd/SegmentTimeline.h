@@ -17,6 +17,8 @@
 #include "ISegmentTimeline.h"
 #include "AbstractMPDElement.h"
 #include "Timeline.h"
+#include "RunLengthTimeline.h"
+#include "RefreshReport.h"
 
 namespace dash
 {
@@ -29,10 +31,29 @@ namespace dash
                 virtual ~SegmentTimeline    ();
 
                 std::vector<ITimeline *>&   GetTimelines    ()  const;
+                uint64_t                    GetSegmentCount (uint64_t endTime)  const;
+                bool                        GetSegment      (uint64_t index, uint64_t &startTime, uint64_t &duration) const;
+                bool                        GetSegmentIndex (uint64_t time, uint64_t &index)  const;
+                bool                        GetSegment      (uint64_t index, uint64_t &startTime, uint64_t &duration, size_t &run) const;
                 void                        AddTimeline     (Timeline *timeline);
 
+                /*
+                 *  Merges the S elements of the given SegmentTimeline: entries that have left the timeline are
+                 *  removed, unchanged entries are kept and new entries are moved over. An entry whose first segments
+                 *  have left the timeline is split at the start of the update. If the timelines do not overlap
+                 *  consistently all entries are replaced. The update is deleted by the caller afterwards.
+                 */
+                void                        Refresh         (SegmentTimeline *update, RefreshReport &report);
+
+                /*
+                 *  Moves the S elements of the given SegmentTimeline behind the entries of this one, as a patch appends
+                 *  them. The update is deleted by the caller afterwards.
+                 */
+                void                        Append          (SegmentTimeline *update, RefreshReport &report);
+
             private:
                 std::vector<ITimeline *>    timelines;
+                RunLengthTimeline           runs;
         };
     }
 }
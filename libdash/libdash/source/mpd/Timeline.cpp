@@ -16,34 +16,40 @@ using namespace dash::mpd;
 Timeline::Timeline    ()  :
                 startTime(0),
                 duration(0),
-                repeatCount(0)
+                repeatCount(0),
+                hasStartTime(false)
 {
 }
 Timeline::~Timeline   ()
 {
 }
 
-uint32_t    Timeline::GetStartTime     ()  const
+uint64_t    Timeline::GetStartTime     ()  const
 {
     return this->startTime;
 }
-void        Timeline::SetStartTime     (uint32_t startTime) 
+void        Timeline::SetStartTime     (uint64_t startTime) 
 {
-    this->startTime = startTime;
+    this->startTime     = startTime;
+    this->hasStartTime  = true;
 }
-uint32_t    Timeline::GetDuration      ()  const
+bool        Timeline::HasStartTime     ()  const
+{
+    return this->hasStartTime;
+}
+uint64_t    Timeline::GetDuration      ()  const
 {
     return this->duration;
 }
-void        Timeline::SetDuration      (uint32_t duration) 
+void        Timeline::SetDuration      (uint64_t duration) 
 {
     this->duration = duration;
 }
-uint32_t    Timeline::GetRepeatCount   ()  const
+int64_t     Timeline::GetRepeatCount   ()  const
 {
     return this->repeatCount;
 }
-void        Timeline::SetRepeatCount   (uint32_t repeatCount)
+void        Timeline::SetRepeatCount   (int64_t repeatCount)
 {
     this->repeatCount = repeatCount;
 }
\ No newline at end of file
@@ -40,7 +40,7 @@ bool    AbstractChunk::StartDownload                ()
     if(this->stateManager.State() != NOT_STARTED)
         return false;
 
-    curl_global_init(CURL_GLOBAL_ALL);
+    GlobalState::Initialize();
 
     this->curl = curl_easy_init();
     curl_easy_setopt(this->curl, CURLOPT_URL, this->AbsoluteURI().c_str());
@@ -58,7 +58,10 @@ bool    AbstractChunk::StartDownload                ()
     this->dlThread = CreateThreadPortable (DownloadInternalConnection, this);
 
     if(this->dlThread == NULL)
+    {
+        curl_easy_cleanup(this->curl);
         return false;
+    }
 
     this->stateManager.State(IN_PROGRESS);
 
@@ -150,7 +153,6 @@ void*   AbstractChunk::DownloadInternalConnection   (void *abstractchunk)
     chunk->response = curl_easy_perform(chunk->curl);
 
     curl_easy_cleanup(chunk->curl);
-    curl_global_cleanup();
 
     if(chunk->stateManager.State() == REQUEST_ABORT)
         chunk->stateManager.State(ABORTED);
@@ -23,6 +23,7 @@
 #include "../metrics/TCPConnection.h"
 #include "../metrics/ThroughputMeasurement.h"
 #include "../helpers/Time.h"
+#include "../helpers/GlobalState.h"
 
 namespace dash
 {
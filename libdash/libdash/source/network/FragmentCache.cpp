@@ -0,0 +1,101 @@
+/*
+ * FragmentCache.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "FragmentCache.h"
+
+using namespace dash::network;
+using namespace dash::helpers;
+
+const size_t FragmentCache::MAXENTRIES = 256;
+
+FragmentCache::FragmentCache    () :
+               timeToLive       (60)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+}
+FragmentCache::~FragmentCache   ()
+{
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+bool    FragmentCache::Get              (const std::string &url, std::string &document)
+{
+    bool found = false;
+
+    EnterCriticalSection(&this->monitorMutex);
+
+    std::map<std::string, Entry>::iterator it = this->entries.find(url);
+
+    if (it != this->entries.end() && it->second.expiry > Time::GetCurrentUTCTimeInSec())
+    {
+        document    = it->second.document;
+        found       = true;
+    }
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return found;
+}
+void    FragmentCache::Put              (const std::string &url, const std::string &document)
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    if (this->timeToLive)
+    {
+        uint32_t now = Time::GetCurrentUTCTimeInSec();
+
+        this->entries.erase(url);
+
+        if (this->entries.size() >= MAXENTRIES)
+            this->RemoveExpired(now);
+
+        /* all entries are still valid, the one that expires first makes room */
+        if (this->entries.size() >= MAXENTRIES)
+        {
+            std::map<std::string, Entry>::iterator first = this->entries.begin();
+
+            for (std::map<std::string, Entry>::iterator it = this->entries.begin(); it != this->entries.end(); ++it)
+                if (it->second.expiry < first->second.expiry)
+                    first = it;
+
+            this->entries.erase(first);
+        }
+
+        Entry &entry    = this->entries[url];
+        entry.document  = document;
+        entry.expiry    = now + this->timeToLive;
+    }
+
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void    FragmentCache::SetTimeToLive    (uint32_t seconds)
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    this->timeToLive = seconds;
+
+    if (seconds == 0)
+        this->entries.clear();
+
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void    FragmentCache::RemoveExpired    (uint32_t now)
+{
+    std::map<std::string, Entry>::iterator it = this->entries.begin();
+
+    while (it != this->entries.end())
+    {
+        if (it->second.expiry <= now)
+            this->entries.erase(it++);
+        else
+            ++it;
+    }
+}
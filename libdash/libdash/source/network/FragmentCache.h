@@ -0,0 +1,61 @@
+/*
+ * FragmentCache.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef FRAGMENTCACHE_H_
+#define FRAGMENTCACHE_H_
+
+#include "config.h"
+
+#include "../helpers/Time.h"
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace network
+    {
+        /*
+         *  Keeps the documents the xlink:href attributes of an MPD refer to for a limited time, keyed by their URL. Ad pods are
+         *  referenced by many manifests and by every refresh of a live manifest, so most of them are only fetched once.
+         *  The cache may be used from several threads at once.
+         */
+        class FragmentCache
+        {
+            public:
+                FragmentCache           ();
+                virtual ~FragmentCache  ();
+
+                bool    Get             (const std::string &url, std::string &document);
+                void    Put             (const std::string &url, const std::string &document);
+
+                /*
+                 *  Sets how long a document is kept, 0 disables the cache.
+                 */
+                void    SetTimeToLive   (uint32_t seconds);
+
+            private:
+                struct Entry
+                {
+                    std::string document;
+                    uint32_t    expiry;
+                };
+
+                void    RemoveExpired   (uint32_t now);
+
+                static const size_t MAXENTRIES;
+
+                std::map<std::string, Entry>    entries;
+                uint32_t                        timeToLive;
+                CRITICAL_SECTION                monitorMutex;
+        };
+    }
+}
+
+#endif /* FRAGMENTCACHE_H_ */
@@ -0,0 +1,256 @@
+/*
+ * ManifestFetcher.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "ManifestFetcher.h"
+
+using namespace dash::network;
+using namespace dash::helpers;
+
+const uint32_t ManifestFetcher::CONNECT_TIMEOUT = 10000;
+
+ManifestFetcher::ManifestFetcher    () :
+                 timeout            (30000)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+
+    GlobalState::Initialize();
+}
+ManifestFetcher::~ManifestFetcher   ()
+{
+    for (size_t i = 0; i < this->idleHandles.size(); i++)
+        curl_easy_cleanup(this->idleHandles.at(i));
+
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+bool        ManifestFetcher::Fetch              (ManifestTransfer &transfer)
+{
+    CURL *curl = this->AcquireHandle();
+
+    if (curl == NULL)
+        return false;
+
+    struct curl_slist *headers = this->Prepare(curl, transfer);
+
+    this->Complete(curl, transfer, curl_easy_perform(curl), headers);
+
+    return transfer.HasSucceeded();
+}
+void        ManifestFetcher::FetchAll           (const std::vector<ManifestTransfer *> &transfers, size_t parallelism)
+{
+    CURLM *multi = curl_multi_init();
+
+    if (multi == NULL)
+        return;
+
+    std::map<CURL *, std::pair<ManifestTransfer *, struct curl_slist *> > running;
+    size_t next = 0;
+
+    while (next < transfers.size() || running.size())
+    {
+        while (next < transfers.size() && running.size() < parallelism)
+        {
+            CURL *curl = this->AcquireHandle();
+
+            /* the transfers that cannot be started are left unsucceeded */
+            if (curl == NULL && running.empty())
+                next = transfers.size();
+
+            if (curl == NULL)
+                break;
+
+            ManifestTransfer *transfer = transfers.at(next++);
+
+            running[curl] = std::make_pair(transfer, this->Prepare(curl, *transfer));
+            curl_multi_add_handle(multi, curl);
+        }
+
+        /* the handles of the multi handle share its connections, so fragments from the same host reuse them */
+        int         active  = 0;
+        int         queued  = 0;
+        CURLMsg     *message = NULL;
+
+        curl_multi_perform(multi, &active);
+
+        while ((message = curl_multi_info_read(multi, &queued)) != NULL)
+        {
+            if (message->msg != CURLMSG_DONE)
+                continue;
+
+            CURL        *curl   = message->easy_handle;
+            CURLcode    result  = message->data.result;
+
+            curl_multi_remove_handle(multi, curl);
+            this->Complete(curl, *running[curl].first, result, running[curl].second);
+            running.erase(curl);
+        }
+
+        if (running.size())
+            curl_multi_wait(multi, NULL, 0, 100, NULL);
+    }
+
+    curl_multi_cleanup(multi);
+}
+void        ManifestFetcher::SetTimeout         (uint32_t milliseconds)
+{
+    this->timeout = milliseconds;
+}
+struct curl_slist*  ManifestFetcher::Prepare     (CURL *curl, ManifestTransfer &transfer)
+{
+    struct curl_slist *headers = NULL;
+
+    if (!transfer.GetIfNoneMatch().empty())
+        headers = curl_slist_append(headers, ("If-None-Match: " + transfer.GetIfNoneMatch()).c_str());
+
+    if (!transfer.GetIfModifiedSince().empty())
+        headers = curl_slist_append(headers, ("If-Modified-Since: " + transfer.GetIfModifiedSince()).c_str());
+
+    uint32_t connectTimeout = (this->timeout && this->timeout < CONNECT_TIMEOUT) ? this->timeout : CONNECT_TIMEOUT;
+
+    curl_easy_setopt(curl, CURLOPT_URL, transfer.GetUrl().c_str());
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    /* an empty string offers every encoding curl has been built with, the body is decoded on the fly. A range refers to the
+       encoded body, so ranges are requested without encoding. The handle may come from the pool, so both are always set */
+    curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, transfer.GetByteRange().empty() ? "" : NULL);
+    curl_easy_setopt(curl, CURLOPT_RANGE, transfer.GetByteRange().empty() ? NULL : transfer.GetByteRange().c_str());
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_MAXREDIRS, 10L);
+    curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, (long) connectTimeout);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, (long) this->timeout);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *) &transfer);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, (void *) &transfer);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+#if LIBCURL_VERSION_NUM >= 0x072000
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, ProgressCallback);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, (void *) &transfer);
+#else
+    curl_easy_setopt(curl, CURLOPT_PROGRESSFUNCTION, ProgressCallback);
+    curl_easy_setopt(curl, CURLOPT_PROGRESSDATA, (void *) &transfer);
+#endif
+
+    return headers;
+}
+void                ManifestFetcher::Complete    (CURL *curl, ManifestTransfer &transfer, CURLcode result, struct curl_slist *headers)
+{
+    long    responseCode    = 0;
+    char    *effectiveUrl   = NULL;
+
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+    curl_easy_getinfo(curl, CURLINFO_EFFECTIVE_URL, &effectiveUrl);
+
+    transfer.SetResponseCode(responseCode);
+    transfer.SetEffectiveUrl(effectiveUrl ? effectiveUrl : transfer.GetUrl());
+
+    /* a write error is the abort of a response that has delivered all requested bytes */
+    bool isComplete = result == CURLE_OK || (result == CURLE_WRITE_ERROR && transfer.IsRangeComplete());
+
+    transfer.SetSucceeded(isComplete && ((responseCode >= 200 && responseCode < 300) || transfer.IsNotModified()));
+
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, NULL);
+    curl_slist_free_all(headers);
+
+    this->ReleaseHandle(curl);
+}
+bool        ManifestFetcher::IsRemoteUrl        (const std::string &url)
+{
+    return url.substr(0,7) == "http://" || url.substr(0,8) == "https://";
+}
+CURL*       ManifestFetcher::AcquireHandle      ()
+{
+    CURL *curl = NULL;
+
+    EnterCriticalSection(&this->monitorMutex);
+
+    if (this->idleHandles.size())
+    {
+        curl = this->idleHandles.back();
+        this->idleHandles.pop_back();
+    }
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    /* a reset handle keeps its open connections and its DNS cache */
+    if (curl)
+        curl_easy_reset(curl);
+    else
+        curl = curl_easy_init();
+
+    return curl;
+}
+void        ManifestFetcher::ReleaseHandle      (CURL *curl)
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->idleHandles.push_back(curl);
+    LeaveCriticalSection(&this->monitorMutex);
+}
+size_t      ManifestFetcher::WriteCallback      (char *data, size_t size, size_t nmemb, void *userdata)
+{
+    ManifestTransfer *transfer = (ManifestTransfer *) userdata;
+
+    /* returning less than was passed aborts the transfer */
+    if (!transfer->AppendData(data, size * nmemb))
+        return 0;
+
+    return size * nmemb;
+}
+size_t      ManifestFetcher::HeaderCallback     (char *data, size_t size, size_t nmemb, void *userdata)
+{
+    ManifestTransfer    *transfer   = (ManifestTransfer *) userdata;
+    std::string         line        (data, size * nmemb);
+
+    /* every response of a redirect chain starts with a status line, only the headers of the last one count */
+    if (line.substr(0,5) == "HTTP/")
+    {
+        size_t space = line.find(' ');
+
+        transfer->BeginResponse(space == std::string::npos ? 0 : strtol(line.c_str() + space + 1, NULL, 10));
+        return size * nmemb;
+    }
+
+    size_t colon = line.find(':');
+
+    if (colon == std::string::npos)
+        return size * nmemb;
+
+    std::string name = line.substr(0, colon);
+
+    for (size_t i = 0; i < name.size(); i++)
+        name[i] = tolower(name[i]);
+
+    size_t first    = line.find_first_not_of(" \t", colon + 1);
+    size_t last     = line.find_last_not_of(" \t\r\n");
+    std::string value = (first == std::string::npos || last < first) ? "" : line.substr(first, last - first + 1);
+
+    if (name == "etag")
+        transfer->SetETag(value);
+    else if (name == "last-modified")
+        transfer->SetLastModified(value);
+    else if (name == "content-range")
+        transfer->SetContentRange(value);
+
+    return size * nmemb;
+}
+#if LIBCURL_VERSION_NUM >= 0x072000
+int         ManifestFetcher::ProgressCallback   (void *userdata, curl_off_t, curl_off_t, curl_off_t, curl_off_t)
+#else
+int         ManifestFetcher::ProgressCallback   (void *userdata, double, double, double, double)
+#endif
+{
+    ManifestTransfer *transfer = (ManifestTransfer *) userdata;
+
+    /* a non-zero value aborts the transfer */
+    return transfer->IsCanceled() ? 1 : 0;
+}
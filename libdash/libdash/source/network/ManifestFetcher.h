@@ -0,0 +1,80 @@
+/*
+ * ManifestFetcher.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MANIFESTFETCHER_H_
+#define MANIFESTFETCHER_H_
+
+#include "config.h"
+
+#include <curl/curl.h>
+#include "ManifestTransfer.h"
+#include "../helpers/GlobalState.h"
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace network
+    {
+        /*
+         *  Fetches MPDs over HTTP with curl instead of the HTTP client of libxml2. The transfer may be compressed, redirects
+         *  are followed and the request is made conditional if the transfer carries validators. Idle curl handles are kept
+         *  in a pool, so the connection and the DNS cache of a handle are reused by the next fetch of the same host,
+         *  e.g. by the periodic refreshes of a live MPD. Fetch may be called from several threads at once.
+         */
+        class ManifestFetcher
+        {
+            public:
+                ManifestFetcher             ();
+                virtual ~ManifestFetcher    ();
+
+                /*
+                 *  Returns true if the response has been received completely, either with a body or with 304 Not Modified.
+                 */
+                bool        Fetch       (ManifestTransfer &transfer);
+
+                /*
+                 *  Performs the transfers concurrently, at most the given number at once. The result of each transfer is
+                 *  reported by ManifestTransfer::HasSucceeded.
+                 */
+                void        FetchAll    (const std::vector<ManifestTransfer *> &transfers, size_t parallelism);
+
+                /*
+                 *  Limits the whole transfer including the connection setup, 0 waits forever.
+                 */
+                void        SetTimeout  (uint32_t milliseconds);
+
+                static bool IsRemoteUrl (const std::string &url);
+
+            private:
+                CURL*       AcquireHandle   ();
+                void        ReleaseHandle   (CURL *curl);
+
+                struct curl_slist*  Prepare     (CURL *curl, ManifestTransfer &transfer);
+                void                Complete    (CURL *curl, ManifestTransfer &transfer, CURLcode result, struct curl_slist *headers);
+
+                static size_t   WriteCallback       (char *data, size_t size, size_t nmemb, void *userdata);
+                static size_t   HeaderCallback      (char *data, size_t size, size_t nmemb, void *userdata);
+#if LIBCURL_VERSION_NUM >= 0x072000
+                static int      ProgressCallback    (void *userdata, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow);
+#else
+                static int      ProgressCallback    (void *userdata, double dltotal, double dlnow, double ultotal, double ulnow);
+#endif
+
+                static const uint32_t   CONNECT_TIMEOUT;
+
+                std::vector<CURL *>     idleHandles;
+                uint32_t                timeout;
+                CRITICAL_SECTION        monitorMutex;
+        };
+    }
+}
+
+#endif /* MANIFESTFETCHER_H_ */
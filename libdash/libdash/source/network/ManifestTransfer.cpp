@@ -0,0 +1,185 @@
+/*
+ * ManifestTransfer.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "ManifestTransfer.h"
+
+using namespace dash::network;
+
+ManifestTransfer::ManifestTransfer  (const std::string &url) :
+                  url               (url),
+                  firstByte         (0),
+                  lastByte          (0),
+                  receivedBytes     (0),
+                  isRangeComplete   (false),
+                  responseCode      (0),
+                  isCanceled        (false),
+                  hasSucceeded      (false)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+}
+ManifestTransfer::~ManifestTransfer ()
+{
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+const std::string&  ManifestTransfer::GetUrl                ()  const
+{
+    return this->url;
+}
+void                ManifestTransfer::SetValidators         (const std::string &eTag, const std::string &lastModified)
+{
+    this->ifNoneMatch       = eTag;
+    this->ifModifiedSince   = lastModified;
+}
+const std::string&  ManifestTransfer::GetIfNoneMatch        ()  const
+{
+    return this->ifNoneMatch;
+}
+const std::string&  ManifestTransfer::GetIfModifiedSince    ()  const
+{
+    return this->ifModifiedSince;
+}
+void                ManifestTransfer::SetByteRange          (uint64_t firstByte, uint64_t lastByte)
+{
+    std::stringstream ss;
+    ss << firstByte << "-" << lastByte;
+
+    this->byteRange = ss.str();
+    this->firstByte = firstByte;
+    this->lastByte  = lastByte;
+}
+const std::string&  ManifestTransfer::GetByteRange          ()  const
+{
+    return this->byteRange;
+}
+bool                ManifestTransfer::IsRangeComplete       ()  const
+{
+    return this->isRangeComplete;
+}
+bool                ManifestTransfer::GetContentRange       (uint64_t &firstByte, uint64_t &lastByte)  const
+{
+    std::stringstream   ss(this->contentRange);
+    std::string         unit;
+    char                dash    = 0;
+    char                slash   = 0;
+
+    ss >> unit >> firstByte >> dash >> lastByte >> slash;
+
+    return !ss.fail() && unit == "bytes" && dash == '-' && slash == '/' && firstByte <= lastByte;
+}
+void                ManifestTransfer::Cancel                ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->isCanceled = true;
+    LeaveCriticalSection(&this->monitorMutex);
+}
+bool                ManifestTransfer::IsCanceled            ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    bool canceled = this->isCanceled;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return canceled;
+}
+const std::string&  ManifestTransfer::GetData               ()  const
+{
+    return this->data;
+}
+const std::string&  ManifestTransfer::GetEffectiveUrl       ()  const
+{
+    return this->effectiveUrl;
+}
+const std::string&  ManifestTransfer::GetETag               ()  const
+{
+    return this->eTag;
+}
+const std::string&  ManifestTransfer::GetLastModified       ()  const
+{
+    return this->lastModified;
+}
+long                ManifestTransfer::GetResponseCode       ()  const
+{
+    return this->responseCode;
+}
+bool                ManifestTransfer::IsNotModified         ()  const
+{
+    return this->responseCode == 304;
+}
+bool                ManifestTransfer::HasSucceeded          ()  const
+{
+    return this->hasSucceeded;
+}
+void                ManifestTransfer::BeginResponse         (long responseCode)
+{
+    this->responseCode      = responseCode;
+    this->receivedBytes     = 0;
+    this->isRangeComplete   = false;
+
+    this->data.clear();
+    this->eTag.clear();
+    this->lastModified.clear();
+    this->contentRange.clear();
+}
+bool                ManifestTransfer::AppendData            (const char *data, size_t length)
+{
+    if (this->byteRange.empty())
+    {
+        this->data.append(data, length);
+        return true;
+    }
+
+    /* a partial response starts at the first requested byte, any other response at the start of the resource */
+    uint64_t position   = (this->responseCode == 206 ? this->firstByte : 0) + this->receivedBytes;
+    uint64_t end        = position + length;
+
+    this->receivedBytes += length;
+
+    if (end > this->firstByte && position <= this->lastByte)
+    {
+        uint64_t first  = std::max(position, this->firstByte);
+        uint64_t last   = std::min(end - 1, this->lastByte);
+
+        this->data.append(data + (first - position), (size_t) (last - first + 1));
+    }
+
+    /* the rest of a resource that is sent as a whole is not needed, neither are bytes beyond the requested range */
+    if (end > this->lastByte + 1 || (end > this->lastByte && this->responseCode != 206))
+    {
+        this->isRangeComplete = true;
+        return false;
+    }
+
+    return true;
+}
+void                ManifestTransfer::SetContentRange       (const std::string &contentRange)
+{
+    this->contentRange = contentRange;
+}
+void                ManifestTransfer::SetEffectiveUrl       (const std::string &url)
+{
+    this->effectiveUrl = url;
+}
+void                ManifestTransfer::SetETag               (const std::string &eTag)
+{
+    this->eTag = eTag;
+}
+void                ManifestTransfer::SetLastModified       (const std::string &lastModified)
+{
+    this->lastModified = lastModified;
+}
+void                ManifestTransfer::SetResponseCode       (long responseCode)
+{
+    this->responseCode = responseCode;
+}
+void                ManifestTransfer::SetSucceeded          (bool succeeded)
+{
+    this->hasSucceeded = succeeded;
+}
@@ -0,0 +1,108 @@
+/*
+ * ManifestTransfer.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MANIFESTTRANSFER_H_
+#define MANIFESTTRANSFER_H_
+
+#include "config.h"
+
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace network
+    {
+        /*
+         *  A single fetch of an MPD by the ManifestFetcher. It holds the validators that are sent with the request and
+         *  the body and headers of the response. Cancel may be called from any thread while the transfer is performed.
+         */
+        class ManifestTransfer
+        {
+            public:
+                ManifestTransfer            (const std::string &url);
+                virtual ~ManifestTransfer   ();
+
+                const std::string&  GetUrl              ()  const;
+
+                /*
+                 *  Makes the request conditional, the server answers with 304 if the MPD still matches one of the validators.
+                 */
+                void                SetValidators       (const std::string &eTag, const std::string &lastModified);
+                const std::string&  GetIfNoneMatch      ()  const;
+                const std::string&  GetIfModifiedSince  ()  const;
+
+                /*
+                 *  Requests only the given bytes of the resource. A server that ignores the range answers with the whole
+                 *  resource, only the requested bytes of it are kept then and the transfer is aborted as soon as the last
+                 *  of them has arrived, which still counts as success.
+                 */
+                void                SetByteRange        (uint64_t firstByte, uint64_t lastByte);
+                const std::string&  GetByteRange        ()  const;
+                bool                IsRangeComplete     ()  const;
+
+                /*
+                 *  Returns false if the response has no Content-Range header of the form "bytes first-last/length".
+                 */
+                bool                GetContentRange     (uint64_t &firstByte, uint64_t &lastByte)  const;
+
+                void                Cancel              ();
+                bool                IsCanceled          ();
+
+                /*
+                 *  The decoded body, the URL after all redirects and the validators of the response.
+                 */
+                const std::string&  GetData             ()  const;
+                const std::string&  GetEffectiveUrl     ()  const;
+                const std::string&  GetETag             ()  const;
+                const std::string&  GetLastModified     ()  const;
+                long                GetResponseCode     ()  const;
+                bool                IsNotModified       ()  const;
+                bool                HasSucceeded        ()  const;
+
+                /*
+                 *  Starts the response with the status code of its status line, a redirect is answered with several responses.
+                 */
+                void                BeginResponse       (long responseCode);
+
+                /*
+                 *  Returns false if the transfer has to be aborted because all requested bytes have been received.
+                 */
+                bool                AppendData          (const char *data, size_t length);
+                void                SetContentRange     (const std::string &contentRange);
+                void                SetEffectiveUrl     (const std::string &url);
+                void                SetETag             (const std::string &eTag);
+                void                SetLastModified     (const std::string &lastModified);
+                void                SetResponseCode     (long responseCode);
+                void                SetSucceeded        (bool succeeded);
+
+            private:
+                std::string         url;
+                std::string         ifNoneMatch;
+                std::string         ifModifiedSince;
+                std::string         byteRange;
+                uint64_t            firstByte;
+                uint64_t            lastByte;
+                uint64_t            receivedBytes;
+                bool                isRangeComplete;
+                std::string         contentRange;
+                std::string         data;
+                std::string         effectiveUrl;
+                std::string         eTag;
+                std::string         lastModified;
+                long                responseCode;
+                bool                isCanceled;
+                bool                hasSucceeded;
+                CRITICAL_SECTION    monitorMutex;
+        };
+    }
+}
+
+#endif /* MANIFESTTRANSFER_H_ */
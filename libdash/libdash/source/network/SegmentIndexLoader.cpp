@@ -0,0 +1,118 @@
+/*
+ * SegmentIndexLoader.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "SegmentIndexLoader.h"
+
+using namespace dash::network;
+using namespace dash::mpd;
+
+/* limits the sidx boxes that are fetched for a single index, a box takes one or two requests */
+const size_t   SegmentIndexLoader::MAXREQUESTS  = 1024;
+const uint64_t SegmentIndexLoader::BOXREQUEST   = 4096;
+
+SegmentIndexLoader::SegmentIndexLoader  (ManifestFetcher *fetcher) :
+                    fetcher             (fetcher)
+{
+}
+SegmentIndexLoader::~SegmentIndexLoader ()
+{
+}
+
+bool    SegmentIndexLoader::Load    (SegmentIndex *index, uint64_t firstByte, uint64_t lastByte)
+{
+    std::string data;
+    size_t      position    = 0;
+    uint64_t    size        = 0;
+
+    if (lastByte < firstByte || !this->Fetch(index->GetUrl(), firstByte, lastByte, data))
+        return false;
+
+    if (!SegmentIndex::FindBox((const uint8_t *) data.data(), data.size(), "sidx", position, size))
+        return false;
+
+    /* the index range does not cover the whole sidx box */
+    if (size > data.size() - position)
+    {
+        firstByte += position;
+
+        if (!this->Fetch(index->GetUrl(), firstByte, firstByte + size - 1, data) || data.size() < size)
+            return false;
+    }
+
+    if (!index->Parse((const uint8_t *) data.data(), data.size(), firstByte))
+        return false;
+
+    for (size_t requests = 0; index->HasPendingReference(); requests++)
+    {
+        if (requests == MAXREQUESTS)
+            return false;
+
+        index->GetPendingReference(firstByte, lastByte);
+
+        if (!this->FetchBox(index->GetUrl(), firstByte, lastByte, data) || !index->ParsePending((const uint8_t *) data.data(), data.size()))
+            return false;
+    }
+
+    return true;
+}
+bool    SegmentIndexLoader::Fetch   (const std::string &url, uint64_t firstByte, uint64_t lastByte, std::string &data)
+{
+    uint64_t length = lastByte - firstByte + 1;
+
+    if (!ManifestFetcher::IsRemoteUrl(url))
+    {
+        std::ifstream file(url.c_str(), std::ios::in | std::ios::binary);
+
+        if (!file || !file.seekg((std::streamoff) firstByte))
+            return false;
+
+        data.resize((size_t) length);
+        file.read(&data[0], (std::streamsize) length);
+        data.resize((size_t) file.gcount());
+
+        return data.size() > 0;
+    }
+
+    ManifestTransfer transfer(url);
+    transfer.SetByteRange(firstByte, lastByte);
+
+    /* a server that does not support ranges sends the whole resource, the transfer keeps only the requested bytes of it */
+    if (!this->fetcher->Fetch(transfer) || transfer.GetData().empty())
+        return false;
+
+    uint64_t first  = 0;
+    uint64_t last   = 0;
+
+    /* the bytes of a partial response are only taken if they start where they were asked for */
+    if (transfer.GetResponseCode() == 206 && (!transfer.GetContentRange(first, last) || first != firstByte || last > lastByte ||
+        last - first + 1 != transfer.GetData().size()))
+        return false;
+
+    data = transfer.GetData();
+
+    return true;
+}
+bool    SegmentIndexLoader::FetchBox    (const std::string &url, uint64_t firstByte, uint64_t lastByte, std::string &data)
+{
+    size_t      position    = 0;
+    uint64_t    size        = 0;
+
+    if (!this->Fetch(url, firstByte, std::min(lastByte, firstByte + BOXREQUEST - 1), data))
+        return false;
+
+    if (!SegmentIndex::FindBox((const uint8_t *) data.data(), data.size(), "sidx", position, size) || position != 0 || size > lastByte - firstByte + 1)
+        return false;
+
+    if (size <= data.size())
+        return true;
+
+    return this->Fetch(url, firstByte, firstByte + size - 1, data) && data.size() >= size;
+}
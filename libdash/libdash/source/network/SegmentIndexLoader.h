@@ -0,0 +1,56 @@
+/*
+ * SegmentIndexLoader.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SEGMENTINDEXLOADER_H_
+#define SEGMENTINDEXLOADER_H_
+
+#include "config.h"
+
+#include <fstream>
+#include "ManifestFetcher.h"
+#include "ManifestTransfer.h"
+#include "../mpd/SegmentIndex.h"
+
+namespace dash
+{
+    namespace network
+    {
+        /*
+         *  Fills a SegmentIndex with the sidx boxes of its Media Segment. The index range is requested first. If the sidx box
+         *  at its start is larger than the range, the whole box is requested again, and every sidx box outside of the data
+         *  received so far is requested on its own, starting with a few kilobytes that usually cover the box. Media Segments
+         *  that are local files are read from the file.
+         */
+        class SegmentIndexLoader
+        {
+            public:
+                SegmentIndexLoader          (ManifestFetcher *fetcher);
+                virtual ~SegmentIndexLoader ();
+
+                bool    Load    (dash::mpd::SegmentIndex *index, uint64_t firstByte, uint64_t lastByte);
+
+            private:
+                bool    Fetch       (const std::string &url, uint64_t firstByte, uint64_t lastByte, std::string &data);
+
+                /*
+                 *  Fetches the sidx box at the start of a pending reference, without the Subsegments the reference spans as well.
+                 */
+                bool    FetchBox    (const std::string &url, uint64_t firstByte, uint64_t lastByte, std::string &data);
+
+                static const size_t     MAXREQUESTS;
+                static const uint64_t   BOXREQUEST;
+
+                ManifestFetcher *fetcher;
+        };
+    }
+}
+
+#endif /* SEGMENTINDEXLOADER_H_ */
@@ -0,0 +1,78 @@
+#include "MemoryMapping.h"
+
+bool    MapFilePortable     (const char *path, mapped_file_t *file)
+{
+    file->data = NULL;
+    file->size = 0;
+
+    #if defined _WIN32 || defined _WIN64
+        file->mapping   = NULL;
+        file->file      = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+        if (file->file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file->file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file->file);
+            return false;
+        }
+
+        file->mapping = CreateFileMapping(file->file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (file->mapping == NULL)
+        {
+            CloseHandle(file->file);
+            return false;
+        }
+
+        file->data = (const char *) MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0);
+        if (file->data == NULL)
+        {
+            CloseHandle(file->mapping);
+            CloseHandle(file->file);
+            return false;
+        }
+
+        file->size = (size_t) size.QuadPart;
+        return true;
+    #else
+        int fd = open(path, O_RDONLY);
+
+        if (fd < 0)
+            return false;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        void *data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (data == MAP_FAILED)
+            return false;
+
+        file->data = (const char *) data;
+        file->size = (size_t) info.st_size;
+        return true;
+    #endif
+}
+void    UnmapFilePortable   (mapped_file_t *file)
+{
+    if (file->data == NULL)
+        return;
+
+    #if defined _WIN32 || defined _WIN64
+        UnmapViewOfFile(file->data);
+        CloseHandle(file->mapping);
+        CloseHandle(file->file);
+    #else
+        munmap((void *) file->data, file->size);
+    #endif
+
+    file->data = NULL;
+    file->size = 0;
+}
@@ -0,0 +1,37 @@
+#ifndef PORTABLE_MEMORYMAPPING_H_
+#define PORTABLE_MEMORYMAPPING_H_
+
+#include <stddef.h>
+
+#if defined _WIN32 || defined _WIN64
+
+    #define _WINSOCKAPI_
+    #include <Windows.h>
+
+    struct mapped_file_t
+    {
+        const char  *data;
+        size_t      size;
+        HANDLE      file;
+        HANDLE      mapping;
+    };
+
+#else
+
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+
+    struct mapped_file_t
+    {
+        const char  *data;
+        size_t      size;
+    };
+
+#endif
+
+bool    MapFilePortable     (const char *path, mapped_file_t *file);
+void    UnmapFilePortable   (mapped_file_t *file);
+
+#endif  // PORTABLE_MEMORYMAPPING_H_
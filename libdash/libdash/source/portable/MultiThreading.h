@@ -7,6 +7,8 @@
     #include <Windows.h>
     #define DeleteConditionVariable(cond_p) {}
 
+    #define JoinThread(handle)              WaitForSingleObject(handle, INFINITE)
+
     typedef HANDLE THREAD_HANDLE;
 
     #if defined WINXPOROLDER
@@ -59,6 +61,7 @@
     #define SleepConditionVariableCS(cond_p, mutex_p, infinite) pthread_cond_wait(cond_p, mutex_p) // INFINITE should be handled mor properly
     #define WakeConditionVariable(cond_p)                       pthread_cond_signal(cond_p)
     #define WakeAllConditionVariable(cond_p)                    pthread_cond_broadcast(cond_p)
+    #define JoinThread(handle)                                  pthread_join(*(handle), NULL)
 
     typedef pthread_t* THREAD_HANDLE;
 
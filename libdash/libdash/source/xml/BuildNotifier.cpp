@@ -0,0 +1,71 @@
+/*
+ * BuildNotifier.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "BuildNotifier.h"
+#include "DOMParser.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+
+BuildNotifier::BuildNotifier    () :
+               resolveXLinks    (false)
+{
+    InitializeCriticalSection(&this->observerMutex);
+}
+BuildNotifier::~BuildNotifier   ()
+{
+    DeleteCriticalSection(&this->observerMutex);
+}
+
+void    BuildNotifier::SetObservers         (const std::vector<IMPDBuildObserver *> &observers)
+{
+    this->observers = observers;
+}
+void    BuildNotifier::SetXLinkResolution   (bool enable)
+{
+    this->resolveXLinks = enable;
+}
+bool    BuildNotifier::HasObservers         ()  const
+{
+    return !this->observers.empty();
+}
+void    BuildNotifier::Lock                 ()
+{
+    EnterCriticalSection(&this->observerMutex);
+}
+void    BuildNotifier::Unlock               ()
+{
+    LeaveCriticalSection(&this->observerMutex);
+}
+void    BuildNotifier::OnAdaptationSetBuilt (IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet)
+{
+    if (this->resolveXLinks && DOMParser::IsResolvedOnLoad(adaptationSet->GetXlinkHref(), adaptationSet->GetXlinkActuate()))
+        return;
+
+    EnterCriticalSection(&this->observerMutex);
+
+    for (size_t i = 0; i < this->observers.size(); i++)
+        this->observers.at(i)->OnAdaptationSetBuilt(mpd, period, adaptationSet);
+
+    LeaveCriticalSection(&this->observerMutex);
+}
+void    BuildNotifier::OnPeriodBuilt        (IMPD *mpd, IPeriod *period)
+{
+    if (this->resolveXLinks && DOMParser::IsResolvedOnLoad(period->GetXlinkHref(), period->GetXlinkActuate()))
+        return;
+
+    EnterCriticalSection(&this->observerMutex);
+
+    for (size_t i = 0; i < this->observers.size(); i++)
+        this->observers.at(i)->OnPeriodBuilt(mpd, period);
+
+    LeaveCriticalSection(&this->observerMutex);
+}
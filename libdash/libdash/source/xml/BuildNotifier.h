@@ -0,0 +1,53 @@
+/*
+ * BuildNotifier.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef BUILDNOTIFIER_H_
+#define BUILDNOTIFIER_H_
+
+#include "config.h"
+
+#include "IMPDBuildObserver.h"
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Forwards the build events to the observers of the parser. The events of the Period workers and of the parser are
+         *  serialized by the observer lock, which the parser also holds while it changes the MPD the observers may read.
+         *  Elements that are resolved after the build are not reported if XLink resolution is enabled.
+         */
+        class BuildNotifier : public IMPDBuildObserver
+        {
+            public:
+                BuildNotifier           ();
+                virtual ~BuildNotifier  ();
+
+                void    SetObservers        (const std::vector<IMPDBuildObserver *> &observers);
+                void    SetXLinkResolution  (bool enable);
+                bool    HasObservers        ()  const;
+
+                void    Lock                ();
+                void    Unlock              ();
+
+                void    OnAdaptationSetBuilt    (mpd::IMPD *mpd, mpd::IPeriod *period, mpd::IAdaptationSet *adaptationSet);
+                void    OnPeriodBuilt           (mpd::IMPD *mpd, mpd::IPeriod *period);
+
+            private:
+                std::vector<IMPDBuildObserver *>    observers;
+                bool                                resolveXLinks;
+                CRITICAL_SECTION                    observerMutex;
+        };
+    }
+}
+
+#endif /* BUILDNOTIFIER_H_ */
@@ -15,103 +15,506 @@ using namespace dash::xml;
 using namespace dash::helpers;
 
 DOMParser::DOMParser    (std::string url) :
+           reader       (NULL),
+           root         (NULL),
            url          (url),
+           buffer       (NULL),
+           length       (0),
+           periodThreads(0),
+           isAhead      (false)
+{
+    this->Init();
+}
+DOMParser::DOMParser    (const char *buffer, size_t length, std::string url) :
            reader       (NULL),
-           root         (NULL)
+           root         (NULL),
+           url          (url),
+           buffer       (buffer),
+           length       (length),
+           periodThreads(0),
+           isAhead      (false)
 {
     this->Init();
 }
 DOMParser::~DOMParser   ()
 {
-    xmlCleanupParser();
+    this->CloseReader();
     delete(this->root);
+
+    this->stringPool->Release();
+
+    if (this->arena)
+        this->arena->Release();
 }
 
-Node*   DOMParser::GetRootNode              () const
+Node*           DOMParser::GetRootNode              () const
 {
     return this->root;
 }
-bool    DOMParser::Parse                    ()
+bool            DOMParser::Parse                    ()
 {
-    this->reader = xmlReaderForFile(this->url.c_str(), NULL, 0);
-
-    if(this->reader == NULL)
+    if (!this->OpenReader())
         return false;
 
-    if(xmlTextReaderRead(this->reader)) 
+    if (this->ReadRootNode())
         this->root = this->ProcessNode();
 
+    this->CloseReader();
+
     if(this->root == NULL)
         return false;
 
-    xmlFreeTextReader(this->reader);
-
     return true;
 }
-Node*   DOMParser::ProcessNode              ()
+dash::mpd::MPD* DOMParser::BuildMPD                 ()
 {
-    int type = xmlTextReaderNodeType(this->reader);
+    if (!this->OpenReader())
+        return NULL;
 
-    if(type != WhiteSpace && type != Text)
+    if (!this->ReadRootNode())
     {
-        while (type == Comment || type == WhiteSpace)
+        this->CloseReader();
+        return NULL;
+    }
+
+    int     depth   = xmlTextReaderDepth(this->reader);
+    Node    *header = this->ProcessElementHeader();
+
+    dash::mpd::MPD *mpd = header->ToMPD();
+    mpd->SetStringPool(this->stringPool);
+    delete header;
+
+    IMPDBuildObserver   *observer   = this->notifier.HasObservers() ? &this->notifier : NULL;
+    PeriodConverter     *converter  = this->periodThreads > 1 ? new PeriodConverter(this->periodThreads, observer, mpd) : NULL;
+    size_t              periodIndex = 0;
+
+    if (!xmlTextReaderIsEmptyElement(this->reader))
+    {
+        while (this->ReadSubNode(depth))
         {
-            xmlTextReaderRead(this->reader);
-            type = xmlTextReaderNodeType(this->reader);
+            if (this->IsElement("Period"))
+            {
+                if (converter)
+                {
+                    Node *node = this->ReadPeriodNode(periodIndex++);
+
+                    if (node)
+                        converter->Add(node);
+
+                    this->AddConvertedPeriods(mpd, converter);
+                    continue;
+                }
+
+                dash::mpd::Period *period = this->BuildPeriod(mpd, periodIndex++);
+
+                if (period)
+                {
+                    mpd->AddPeriod(period);
+                    this->notifier.OnPeriodBuilt(mpd, period);
+                }
+                continue;
+            }
+
+            Node *node = this->ProcessNode();
+
+            if (node == NULL)
+                continue;
+
+            /* the workers may report AdaptationSets meanwhile */
+            this->notifier.Lock();
+            mpd->SetDigest(Node::CombineDigest(mpd->GetDigest(), node));
+
+            if (node->AppendToMPD(mpd))
+                delete node;
+            else
+                mpd->AddAdditionalSubNode(node);
+
+            this->notifier.Unlock();
         }
+    }
 
-        Node *node = new Node();
-        node->SetType(type);
-        node->SetMPDPath(Path::GetDirectoryPath(url));
+    if (converter)
+    {
+        converter->Finish();
+        this->AddConvertedPeriods(mpd, converter);
+
+        delete converter;
+    }
+
+    this->CloseReader();
+    return mpd;
+}
+bool            DOMParser::BuildPeriods             (size_t index, std::vector<dash::mpd::Period *> &periods)
+{
+    if (!this->OpenReader())
+        return false;
+
+    if (!this->ReadRootNode())
+    {
+        this->CloseReader();
+        return false;
+    }
+
+    int depth = xmlTextReaderDepth(this->reader);
 
-        if(xmlTextReaderConstName(this->reader) == NULL)
+    if (!xmlTextReaderIsEmptyElement(this->reader))
+    {
+        while (this->ReadSubNode(depth))
         {
-            delete node;
-            return NULL;
+            if (!this->IsElement("Period"))
+            {
+                if (xmlTextReaderNodeType(this->reader) == Start)
+                    this->SkipElement();
+                continue;
+            }
+
+            dash::mpd::Period *period = this->BuildPeriod(NULL, index);
+
+            if (period)
+                periods.push_back(period);
         }
+    }
 
-        std::string name    = (const char *) xmlTextReaderConstName(this->reader);
-        int         isEmpty = xmlTextReaderIsEmptyElement(this->reader);
+    this->CloseReader();
+    return true;
+}
+bool            DOMParser::BuildAdaptationSets      (const dash::mpd::IPeriod *period, std::vector<dash::mpd::AdaptationSet *> &adaptationSets)
+{
+    if (!this->OpenReader())
+        return false;
+
+    if (!this->ReadRootNode())
+    {
+        this->CloseReader();
+        return false;
+    }
+
+    int depth = xmlTextReaderDepth(this->reader);
+
+    if (!xmlTextReaderIsEmptyElement(this->reader))
+    {
+        while (this->ReadSubNode(depth))
+        {
+            if (!this->IsElement("AdaptationSet"))
+            {
+                if (xmlTextReaderNodeType(this->reader) == Start)
+                    this->SkipElement();
+                continue;
+            }
 
-        node->SetName(name);
+            dash::mpd::AdaptationSet *adaptationSet = this->BuildAdaptationSet(period);
 
-        this->AddAttributesToNode(node);
+            if (adaptationSet)
+                adaptationSets.push_back(adaptationSet);
+        }
+    }
 
-        if(isEmpty)
-            return node;
+    this->CloseReader();
+    return true;
+}
+dash::mpd::Period*          DOMParser::BuildPeriod          (dash::mpd::MPD *mpd, size_t index)
+{
+    int     depth   = xmlTextReaderDepth(this->reader);
+    Node    *header = this->ProcessElementHeader();
 
-        Node    *subnode    = NULL;
-        int     ret         = xmlTextReaderRead(this->reader);
+    dash::mpd::Period *period = header->ToPeriod();
+    delete header;
 
-        while(ret == 1)
+    if (this->options.filter && !this->options.filter->AcceptPeriod(period, index))
+    {
+        delete period;
+        this->SkipElement();
+        return NULL;
+    }
+
+    if (xmlTextReaderIsEmptyElement(this->reader))
+        return period;
+
+    while (this->ReadSubNode(depth))
+    {
+        if (this->IsElement("AdaptationSet"))
         {
-            if(!strcmp(name.c_str(), (const char *) xmlTextReaderConstName(this->reader)))
+            dash::mpd::AdaptationSet *adaptationSet = this->BuildAdaptationSet(period);
+
+            if (adaptationSet)
             {
-                return node;
+                period->AddAdaptationSet(adaptationSet);
+                this->notifier.OnAdaptationSetBuilt(mpd, period, adaptationSet);
             }
+            continue;
+        }
 
-            subnode = this->ProcessNode();
+        Node *node = this->ProcessNode();
 
-            if(subnode != NULL)
-                node->AddSubNode(subnode);
+        if (node == NULL)
+            continue;
+
+        period->SetDigest(Node::CombineDigest(period->GetDigest(), node));
+
+        if (node->AppendToPeriod(period))
+            delete node;
+        else
+            period->AddAdditionalSubNode(node);
+    }
+
+    return period;
+}
+dash::mpd::AdaptationSet*   DOMParser::BuildAdaptationSet   (const dash::mpd::IPeriod *period)
+{
+    int     depth   = xmlTextReaderDepth(this->reader);
+    Node    *header = this->ProcessElementHeader();
+
+    dash::mpd::AdaptationSet *adaptationSet = header->ToAdaptationSet();
+    delete header;
+
+    if (!this->AcceptAdaptationSet(period, adaptationSet))
+    {
+        delete adaptationSet;
+        this->SkipElement();
+        return NULL;
+    }
+
+    if (xmlTextReaderIsEmptyElement(this->reader))
+        return adaptationSet;
+
+    while (this->ReadSubNode(depth))
+    {
+        Node *node = this->ProcessNode();
+
+        if (node == NULL)
+            continue;
+
+        adaptationSet->SetDigest(Node::CombineDigest(adaptationSet->GetDigest(), node));
+
+        if (node->AppendToAdaptationSet(adaptationSet))
+            delete node;
+        else
+            adaptationSet->AddAdditionalSubNode(node);
+    }
+
+    return adaptationSet;
+}
+bool                        DOMParser::AcceptAdaptationSet  (const dash::mpd::IPeriod *period, const dash::mpd::IAdaptationSet *adaptationSet)
+{
+    return AcceptAdaptationSet(this->options, period, adaptationSet);
+}
+bool                        DOMParser::AcceptAdaptationSet  (const ParseOptions &options, const dash::mpd::IPeriod *period, const dash::mpd::IAdaptationSet *adaptationSet)
+{
+    if (options.filter == NULL)
+        return true;
+
+    std::string contentType = adaptationSet->GetContentType();
+
+    if (contentType.empty())
+        contentType = adaptationSet->GetMimeType().substr(0, adaptationSet->GetMimeType().find('/'));
 
-            ret = xmlTextReaderRead(this->reader);
+    if (!contentType.empty() && !options.filter->AcceptContentType(contentType))
+        return false;
+
+    return options.filter->AcceptAdaptationSet(period, adaptationSet);
+}
+void                        DOMParser::AddConvertedPeriods  (dash::mpd::MPD *mpd, PeriodConverter *converter)
+{
+    std::vector<dash::mpd::Period *> periods;
+    converter->TakeConverted(periods);
+
+    for (size_t i = 0; i < periods.size(); i++)
+    {
+        /* the AdaptationSets have been reported by the workers */
+        this->notifier.Lock();
+        mpd->AddPeriod(periods.at(i));
+        this->notifier.Unlock();
+
+        this->notifier.OnPeriodBuilt(mpd, periods.at(i));
+    }
+}
+Node*                       DOMParser::ReadPeriodNode       (size_t index)
+{
+    int     depth   = xmlTextReaderDepth(this->reader);
+    Node    *node   = this->ProcessElementHeader();
+
+    if (this->options.filter == NULL)
+    {
+        this->ProcessSubNodes(node, depth);
+        return node;
+    }
+
+    /*
+     *  The filter needs the Period as an object while the node is converted on a worker thread later on. The temporary
+     *  object is built from the header on the heap, so it does not take up space in the arena of the MPD.
+     */
+    node->SetArena(NULL);
+    dash::mpd::Period *period = node->ToPeriod();
+    node->SetArena(this->arena);
+
+    if (!this->options.filter->AcceptPeriod(period, index))
+    {
+        delete period;
+        delete node;
+        this->SkipElement();
+        return NULL;
+    }
+
+    if (!xmlTextReaderIsEmptyElement(this->reader))
+    {
+        while (this->ReadSubNode(depth))
+        {
+            Node *subnode = this->IsElement("AdaptationSet") ? this->ReadAdaptationSetNode(period) : this->ProcessNode();
+
+            if (subnode != NULL)
+                node->AddSubNode(subnode);
         }
+    }
+
+    delete period;
+    return node;
+}
+Node*                       DOMParser::ReadAdaptationSetNode(const dash::mpd::IPeriod *period)
+{
+    int     depth   = xmlTextReaderDepth(this->reader);
+    Node    *node   = this->ProcessElementHeader();
+
+    node->SetArena(NULL);
+    dash::mpd::AdaptationSet *adaptationSet = node->ToAdaptationSet();
+    node->SetArena(this->arena);
+
+    bool isAccepted = this->AcceptAdaptationSet(period, adaptationSet);
+    delete adaptationSet;
+
+    if (!isAccepted)
+    {
+        delete node;
+        this->SkipElement();
+        return NULL;
+    }
+
+    this->ProcessSubNodes(node, depth);
+    return node;
+}
+bool    DOMParser::OpenReader               ()
+{
+    this->CloseReader();
+
+    /* compressed MPDs are inflated while they are read, not into a copy of the whole document */
+    if (this->buffer && InflatingInput::IsCompressed(this->buffer, this->length))
+        this->reader = InflatingInput::CreateReader(this->buffer, this->length, this->url);
+    else if (this->buffer)
+        this->reader = xmlReaderForMemory(this->buffer, (int) this->length, this->url.c_str(), NULL, 0);
+    else
+        this->reader = InflatingInput::CreateReader(this->url);
+
+    /* files that are not compressed and URLs are read by libxml2 itself */
+    if (this->reader == NULL && this->buffer == NULL)
+        this->reader = xmlReaderForFile(this->url.c_str(), NULL, 0);
+
+    return this->reader != NULL;
+}
+void    DOMParser::CloseReader              ()
+{
+    if (this->reader)
+        xmlFreeTextReader(this->reader);
+
+    this->reader    = NULL;
+    this->isAhead   = false;
+}
+bool    DOMParser::ReadRootNode             ()
+{
+    while (xmlTextReaderRead(this->reader) == 1)
+    {
+        if (xmlTextReaderNodeType(this->reader) == Start)
+            return true;
+    }
+    return false;
+}
+bool    DOMParser::ReadSubNode              (int depth)
+{
+    /* after SkipElement the reader already stands on the node that follows the skipped element */
+    while (this->isAhead || xmlTextReaderRead(this->reader) == 1)
+    {
+        this->isAhead = false;
+
+        int type = xmlTextReaderNodeType(this->reader);
+
+        if (type == End && xmlTextReaderDepth(this->reader) <= depth)
+            return false;
+
+        if (type == Start || type == Text)
+            return true;
+    }
+    return false;
+}
+bool    DOMParser::IsElement                (const char *name)
+{
+    const char *current = (const char *) xmlTextReaderConstName(this->reader);
+
+    return current != NULL && !strcmp(current, name);
+}
+bool    DOMParser::IsKnownElement           ()
+{
+    return this->stringPool->Intern((const char *) xmlTextReaderConstName(this->reader)).GetTag() != UnknownName;
+}
+void    DOMParser::SkipElement              ()
+{
+    /* xmlTextReaderNext moves past the sub tree of the current element without expanding it */
+    this->isAhead = xmlTextReaderNext(this->reader) == 1;
+}
+Node*   DOMParser::ProcessElementHeader     ()
+{
+    Node *node = new Node();
+    node->SetType(Start);
+    node->SetMPDPath(this->mpdPath);
+    node->SetArena(this->arena);
+    node->SetRawAttributesRetained(this->options.keepRawAttributes);
+    node->SetName(this->stringPool->Intern((const char *) xmlTextReaderConstName(this->reader)));
+
+    this->AddAttributesToNode(node);
+
+    return node;
+}
+Node*   DOMParser::ProcessNode              ()
+{
+    int type = xmlTextReaderNodeType(this->reader);
+
+    if (type == Text)
+    {
+        const char *text = (const char *) xmlTextReaderConstValue(this->reader);
+
+        if (text == NULL)
+            return NULL;
 
+        Node *node = new Node();
+        node->SetType(type);
+        node->SetText(this->stringPool->Intern(text));
         return node;
-    } else if (type == Text)
+    }
+
+    if (type != Start || xmlTextReaderConstName(this->reader) == NULL)
+        return NULL;
+
+    if (!this->options.keepAdditionalSubNodes && !this->IsKnownElement())
+    {
+        this->SkipElement();
+        return NULL;
+    }
+
+    int     depth   = xmlTextReaderDepth(this->reader);
+    Node    *node   = this->ProcessElementHeader();
+
+    this->ProcessSubNodes(node, depth);
+    return node;
+}
+void    DOMParser::ProcessSubNodes          (Node *node, int depth)
+{
+    if (xmlTextReaderIsEmptyElement(this->reader))
+        return;
+
+    while (this->ReadSubNode(depth))
     {
-       const char* text = (const char *) xmlTextReaderReadString(this->reader);
+        Node *subnode = this->ProcessNode();
 
-       if(text != NULL)
-       {
-           Node *node = new Node();
-           node->SetType(type);
-           node->SetText(text);
-           return node;
-       }
+        if (subnode != NULL)
+            node->AddSubNode(subnode);
     }
-    return NULL;
 }
 void    DOMParser::AddAttributesToNode      (Node *node)
 {
@@ -119,10 +522,10 @@ void    DOMParser::AddAttributesToNode      (Node *node)
     {
         while(xmlTextReaderMoveToNextAttribute(this->reader))
         {
-            std::string key      = (const char *) xmlTextReaderConstName(this->reader);
-            std::string value    = (const char *) xmlTextReaderConstValue(this->reader);
-            node->AddAttribute(key, value);
+            node->AddAttribute(this->stringPool->Intern((const char *) xmlTextReaderConstName(this->reader)),
+                               this->stringPool->Intern((const char *) xmlTextReaderConstValue(this->reader)));
         }
+        xmlTextReaderMoveToElement(this->reader);
     }
 }
 void    DOMParser::Print                    (Node *node, int offset)
@@ -132,25 +535,68 @@ void    DOMParser::Print                    (Node *node, int offset)
         ss << " ";
     ss << node->GetName();
 
-    std::vector<std::string> keys = node->GetAttributeKeys();
-
     ss.clear();
-    for(unsigned int i = 0; i < keys.size(); i++)
+    for(size_t i = 0; i < node->GetAttributeCount(); i++)
     {
-        ss << " " << keys.at(i) << "=" << node->GetAttributeValue(keys.at(i));
+        ss << " " << node->GetAttributeKey(i) << "=" << node->GetAttributeValue(i);
     }
 
     offset++;
 
     for(unsigned int i = 0; i < node->GetSubNodes().size(); i++)
     {
-        this->Print(node->GetSubNodes().at(i), offset);
+        if (node->GetSubNodes().at(i))
+            this->Print(node->GetSubNodes().at(i), offset);
     }
 }
 void    DOMParser::Init                     ()
 {
-    this->root      = NULL;
-    this->reader    = NULL;
+    GlobalState::Initialize();
+
+    this->root          = NULL;
+    this->reader        = NULL;
+    this->arena         = NULL;
+    this->stringPool    = new StringPool(Schema::GetName);
+    this->mpdPath       = this->stringPool->Intern(Path::GetDirectoryPath(this->url));
+}
+void    DOMParser::SetStringPool            (StringPool *stringPool)
+{
+    stringPool->Retain();
+    this->stringPool->Release();
+
+    this->stringPool    = stringPool;
+    this->mpdPath       = this->stringPool->Intern(Path::GetDirectoryPath(this->url));
+}
+void    DOMParser::SetArena                 (Arena *arena)
+{
+    if (arena)
+        arena->Retain();
+
+    if (this->arena)
+        this->arena->Release();
+
+    this->arena = arena;
+}
+void    DOMParser::SetPeriodThreads         (size_t threads)
+{
+    this->periodThreads = threads;
+}
+void    DOMParser::SetParseOptions          (const ParseOptions &options)
+{
+    this->options = options;
+}
+void    DOMParser::SetBuildObservers        (const std::vector<IMPDBuildObserver *> &observers)
+{
+    this->notifier.SetObservers(observers);
+}
+void    DOMParser::SetXLinkResolution       (bool enable)
+{
+    this->notifier.SetXLinkResolution(enable);
+}
+bool    DOMParser::IsResolvedOnLoad         (const std::string &xlinkHref, const std::string &xlinkActuate)
+{
+    /* onRequest is the default of xlink:actuate */
+    return !xlinkHref.empty() && xlinkActuate == "onLoad";
 }
 void    DOMParser::Print                    ()
 {
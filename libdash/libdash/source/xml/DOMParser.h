@@ -15,8 +15,16 @@
 #include "config.h"
 
 #include "Node.h"
+#include "PeriodConverter.h"
+#include "BuildNotifier.h"
+#include "InflatingInput.h"
+#include "ParseOptions.h"
+#include "IMPDBuildObserver.h"
 #include <libxml/xmlreader.h>
 #include "../helpers/Path.h"
+#include "../helpers/StringPool.h"
+#include "../helpers/Arena.h"
+#include "../helpers/GlobalState.h"
 
 namespace dash
 {
@@ -35,21 +43,109 @@ namespace dash
         {
             public:
                 DOMParser           (std::string url);
+                /*
+                 *  Reads the MPD from the given buffer, which must stay valid while the parser is used.
+                 *  The url is only used to resolve relative BaseURLs.
+                 */
+                DOMParser           (const char *buffer, size_t length, std::string url);
                 virtual ~DOMParser  ();
 
-                bool    Parse       ();
-                Node*   GetRootNode () const;
-                void    Print       ();
+                bool            Parse       ();
+                Node*           GetRootNode () const;
+                void            Print       ();
+
+                /*
+                 *  Builds the MPD directly from the reader events without keeping the complete node tree.
+                 *  Only the elements below an AdaptationSet, e.g. a Representation, are collected into a
+                 *  temporary node tree, which is converted and released as soon as the element has been read.
+                 */
+                dash::mpd::MPD* BuildMPD    ();
+
+                /*
+                 *  Interns names and values into the given pool instead of a new one, e.g. the pool of the MPD that is refreshed.
+                 */
+                void            SetStringPool   (helpers::StringPool *stringPool);
+
+                /*
+                 *  Places the MPD elements into the given arena instead of allocating each of them on the heap.
+                 *  The resulting MPD keeps a reference to the arena. Passing NULL switches back to heap allocation.
+                 */
+                void            SetArena        (helpers::Arena *arena);
+
+                /*
+                 *  Converts the Periods on the given number of threads in BuildMPD. Each Period is read into a node tree
+                 *  first and converted while the following Periods are read. 0 or 1 builds them on the calling thread.
+                 */
+                void            SetPeriodThreads    (size_t threads);
+
+                /*
+                 *  Selects the elements BuildMPD converts. Rejected Periods and AdaptationSets as well as unknown elements, if they
+                 *  are not kept, are skipped with xmlTextReaderNext, so none of their sub nodes are read into nodes.
+                 */
+                void            SetParseOptions     (const ParseOptions &options);
+
+                /*
+                 *  Informs the observers about every Period and AdaptationSet BuildMPD adds to the MPD. With worker threads the
+                 *  AdaptationSets are reported by the worker that converts their Period, and a Period is added as soon as it and
+                 *  all previous ones are converted, which is checked whenever a Period has been read.
+                 */
+                void            SetBuildObservers   (const std::vector<IMPDBuildObserver *> &observers);
+
+                /*
+                 *  Builds the Periods or the AdaptationSets of a remote element entity, i.e. of a document whose root element
+                 *  holds the elements that replace one with an xlink:href. Other elements below the root are skipped, the index
+                 *  and the Period are those of the replaced element and only passed to the filter of the parse options.
+                 */
+                bool            BuildPeriods        (size_t index, std::vector<dash::mpd::Period *> &periods);
+                bool            BuildAdaptationSets (const dash::mpd::IPeriod *period, std::vector<dash::mpd::AdaptationSet *> &adaptationSets);
+
+                /*
+                 *  Elements whose xlink:href is resolved after BuildMPD are not reported to the build observers, the resolver
+                 *  reports the elements that replace them instead.
+                 */
+                void            SetXLinkResolution  (bool enable);
+
+                static bool     IsResolvedOnLoad    (const std::string &xlinkHref, const std::string &xlinkActuate);
+
+                /*
+                 *  Whether the filter of the options accepts the AdaptationSet, by its content type and by itself.
+                 */
+                static bool     AcceptAdaptationSet (const ParseOptions &options, const dash::mpd::IPeriod *period,
+                                                     const dash::mpd::IAdaptationSet *adaptationSet);
 
             private:
                 xmlTextReaderPtr    reader;
                 Node                *root;
                 std::string         url;
+                helpers::StringPool     *stringPool;
+                helpers::InternedString mpdPath;
+                helpers::Arena          *arena;
+                const char          *buffer;
+                size_t              length;
+                size_t              periodThreads;
+                ParseOptions        options;
+                bool                isAhead;
+                BuildNotifier       notifier;
 
-                void    Init                    ();
-                Node*   ProcessNode             ();
-                void    AddAttributesToNode     (Node *node);
-                void    Print                   (Node *node, int offset);
+                void                        Init                    ();
+                bool                        OpenReader              ();
+                void                        CloseReader             ();
+                bool                        ReadRootNode            ();
+                bool                        ReadSubNode             (int depth);
+                bool                        IsElement               (const char *name);
+                bool                        IsKnownElement          ();
+                void                        SkipElement             ();
+                Node*                       ProcessNode             ();
+                Node*                       ProcessElementHeader    ();
+                void                        ProcessSubNodes         (Node *node, int depth);
+                Node*                       ReadPeriodNode          (size_t index);
+                Node*                       ReadAdaptationSetNode   (const dash::mpd::IPeriod *period);
+                dash::mpd::Period*          BuildPeriod             (dash::mpd::MPD *mpd, size_t index);
+                dash::mpd::AdaptationSet*   BuildAdaptationSet      (const dash::mpd::IPeriod *period);
+                bool                        AcceptAdaptationSet     (const dash::mpd::IPeriod *period, const dash::mpd::IAdaptationSet *adaptationSet);
+                void                        AddConvertedPeriods     (dash::mpd::MPD *mpd, PeriodConverter *converter);
+                void                        AddAttributesToNode     (Node *node);
+                void                        Print                   (Node *node, int offset);
         };
     }
 }
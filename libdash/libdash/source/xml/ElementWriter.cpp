@@ -0,0 +1,289 @@
+/*
+ * ElementWriter.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "ElementWriter.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+
+ElementWriter::ElementWriter    ()
+{
+}
+ElementWriter::~ElementWriter   ()
+{
+}
+
+void        ElementWriter::WriteMPD                 (const IMPD *mpd)
+{
+    this->BeginElement("MPD", mpd);
+    this->WriteDigest(mpd);
+
+    for (size_t i = 0; i < mpd->GetProgramInformations().size(); i++)
+        this->WriteProgramInformation(mpd->GetProgramInformations().at(i));
+
+    this->WriteBaseUrls(mpd->GetBaseUrls());
+
+    for (size_t i = 0; i < mpd->GetLocations().size(); i++)
+        this->WriteTextElement("Location", mpd->GetLocations().at(i));
+
+    for (size_t i = 0; i < mpd->GetPatchLocations().size(); i++)
+    {
+        this->BeginElement("PatchLocation", mpd->GetPatchLocations().at(i));
+        this->WriteText(mpd->GetPatchLocations().at(i)->GetUrl());
+        this->EndElement(mpd->GetPatchLocations().at(i));
+    }
+
+    for (size_t i = 0; i < mpd->GetPeriods().size(); i++)
+        this->WritePeriod(mpd->GetPeriods().at(i));
+
+    for (size_t i = 0; i < mpd->GetMetrics().size(); i++)
+        this->WriteMetrics(mpd->GetMetrics().at(i));
+
+    this->EndElement(mpd);
+}
+void        ElementWriter::WriteProgramInformation  (const IProgramInformation *programInformation)
+{
+    this->BeginElement("ProgramInformation", programInformation);
+
+    if (!programInformation->GetTitle().empty())
+        this->WriteTextElement("Title", programInformation->GetTitle());
+
+    if (!programInformation->GetSource().empty())
+        this->WriteTextElement("Source", programInformation->GetSource());
+
+    if (!programInformation->GetCopyright().empty())
+        this->WriteTextElement("Copyright", programInformation->GetCopyright());
+
+    this->EndElement(programInformation);
+}
+void        ElementWriter::WriteBaseUrls            (const std::vector<IBaseUrl *> &baseUrls)
+{
+    for (size_t i = 0; i < baseUrls.size(); i++)
+    {
+        /* "./" has already been replaced by the path of the MPD, which is the same when the snapshot is loaded */
+        this->BeginElement("BaseURL", baseUrls.at(i));
+
+        if (!baseUrls.at(i)->GetUrl().empty())
+            this->WriteText(baseUrls.at(i)->GetUrl());
+
+        this->EndElement(baseUrls.at(i));
+    }
+}
+void        ElementWriter::WritePeriod              (const IPeriod *period)
+{
+    this->BeginElement("Period", period);
+    this->WriteDigest(period);
+
+    this->WriteBaseUrls(period->GetBaseURLs());
+    this->WriteSegmentInformation(period->GetSegmentBase(), period->GetSegmentList(), period->GetSegmentTemplate());
+
+    for (size_t i = 0; i < period->GetAdaptationSets().size(); i++)
+        this->WriteAdaptationSet(period->GetAdaptationSets().at(i));
+
+    for (size_t i = 0; i < period->GetSubsets().size(); i++)
+        this->WriteSubset(period->GetSubsets().at(i));
+
+    this->EndElement(period);
+}
+void        ElementWriter::WriteAdaptationSet       (const IAdaptationSet *adaptationSet)
+{
+    this->BeginElement("AdaptationSet", adaptationSet);
+    this->WriteDigest(adaptationSet);
+
+    this->WriteRepresentationBase(adaptationSet);
+    this->WriteDescriptors("Accessibility", adaptationSet->GetAccessibility());
+    this->WriteDescriptors("Role", adaptationSet->GetRole());
+    this->WriteDescriptors("Rating", adaptationSet->GetRating());
+    this->WriteDescriptors("Viewpoint", adaptationSet->GetViewpoint());
+
+    for (size_t i = 0; i < adaptationSet->GetContentComponent().size(); i++)
+        this->WriteContentComponent(adaptationSet->GetContentComponent().at(i));
+
+    this->WriteBaseUrls(adaptationSet->GetBaseURLs());
+    this->WriteSegmentInformation(adaptationSet->GetSegmentBase(), adaptationSet->GetSegmentList(), adaptationSet->GetSegmentTemplate());
+
+    for (size_t i = 0; i < adaptationSet->GetRepresentation().size(); i++)
+        this->WriteRepresentation(adaptationSet->GetRepresentation().at(i));
+
+    this->EndElement(adaptationSet);
+}
+void        ElementWriter::WriteRepresentation      (const IRepresentation *representation)
+{
+    this->BeginElement("Representation", representation);
+    this->WriteDigest(representation);
+
+    this->WriteRepresentationBase(representation);
+    this->WriteBaseUrls(representation->GetBaseURLs());
+
+    for (size_t i = 0; i < representation->GetSubRepresentations().size(); i++)
+        this->WriteSubRepresentation(representation->GetSubRepresentations().at(i));
+
+    this->WriteSegmentInformation(representation->GetSegmentBase(), representation->GetSegmentList(), representation->GetSegmentTemplate());
+
+    this->EndElement(representation);
+}
+void        ElementWriter::WriteRepresentationBase  (const IRepresentationBase *representationBase)
+{
+    this->WriteDescriptors("FramePacking", representationBase->GetFramePacking());
+    this->WriteDescriptors("AudioChannelConfiguration", representationBase->GetAudioChannelConfiguration());
+    this->WriteDescriptors("ContentProtection", representationBase->GetContentProtection());
+}
+void        ElementWriter::WriteSubRepresentation   (const ISubRepresentation *subRepresentation)
+{
+    this->BeginElement("SubRepresentation", subRepresentation);
+    this->WriteRepresentationBase(subRepresentation);
+    this->EndElement(subRepresentation);
+}
+void        ElementWriter::WriteContentComponent    (const IContentComponent *contentComponent)
+{
+    this->BeginElement("ContentComponent", contentComponent);
+    this->WriteDescriptors("Accessibility", contentComponent->GetAccessibility());
+    this->WriteDescriptors("Role", contentComponent->GetRole());
+    this->WriteDescriptors("Rating", contentComponent->GetRating());
+    this->WriteDescriptors("Viewpoint", contentComponent->GetViewpoint());
+    this->EndElement(contentComponent);
+}
+void        ElementWriter::WriteSegmentInformation  (const ISegmentBase *segmentBase, const ISegmentList *segmentList, const ISegmentTemplate *segmentTemplate)
+{
+    /* SnapshotReader restores the digests in this order */
+    if (segmentBase)
+    {
+        this->BeginElement("SegmentBase", segmentBase);
+        this->WriteDigest(segmentBase);
+        this->WriteSegmentBase(segmentBase);
+        this->EndElement(segmentBase);
+    }
+
+    if (segmentList)
+        this->WriteSegmentList(segmentList);
+
+    if (segmentTemplate)
+        this->WriteSegmentTemplate(segmentTemplate);
+}
+void        ElementWriter::WriteSegmentBase         (const ISegmentBase *segmentBase)
+{
+    this->WriteURLType("Initialization", segmentBase->GetInitialization());
+    this->WriteURLType("RepresentationIndex", segmentBase->GetRepresentationIndex());
+}
+void        ElementWriter::WriteMultipleSegmentBase (const IMultipleSegmentBase *multipleSegmentBase)
+{
+    this->WriteSegmentBase(multipleSegmentBase);
+
+    if (multipleSegmentBase->GetSegmentTimeline())
+        this->WriteSegmentTimeline(multipleSegmentBase->GetSegmentTimeline());
+
+    this->WriteURLType("BitstreamSwitching", multipleSegmentBase->GetBitstreamSwitching());
+}
+void        ElementWriter::WriteSegmentList         (const ISegmentList *segmentList)
+{
+    this->BeginElement("SegmentList", segmentList);
+    this->WriteDigest(segmentList);
+    this->WriteMultipleSegmentBase(segmentList);
+
+    /* packed SegmentURLs are written from their table, so that no objects are created for them */
+    const SegmentList                                   *list = dynamic_cast<const SegmentList *>(segmentList);
+    std::vector<std::pair<std::string, std::string> >   attributes;
+
+    for (size_t i = 0; i < segmentList->GetSegmentURLCount(); i++)
+    {
+        if (list && list->GetPackedSegmentURLs().GetAttributes(i, attributes))
+        {
+            this->BeginElement("SegmentURL", std::map<std::string, std::string>(attributes.begin(), attributes.end()));
+            this->CloseElement();
+            continue;
+        }
+
+        const ISegmentURL *segmentURL = segmentList->GetSegmentURL(i);
+
+        this->BeginElement("SegmentURL", segmentURL);
+        this->EndElement(segmentURL);
+    }
+
+    this->EndElement(segmentList);
+}
+void        ElementWriter::WriteSegmentTemplate     (const ISegmentTemplate *segmentTemplate)
+{
+    this->BeginElement("SegmentTemplate", segmentTemplate);
+    this->WriteDigest(segmentTemplate);
+    this->WriteMultipleSegmentBase(segmentTemplate);
+    this->EndElement(segmentTemplate);
+}
+void        ElementWriter::WriteSegmentTimeline     (const ISegmentTimeline *segmentTimeline)
+{
+    this->BeginElement("SegmentTimeline", segmentTimeline);
+
+    for (size_t i = 0; i < segmentTimeline->GetTimelines().size(); i++)
+    {
+        this->BeginElement("S", segmentTimeline->GetTimelines().at(i));
+        this->EndElement(segmentTimeline->GetTimelines().at(i));
+    }
+
+    this->EndElement(segmentTimeline);
+}
+void        ElementWriter::WriteMetrics             (const IMetrics *metrics)
+{
+    this->BeginElement("Metrics", metrics);
+    this->WriteDescriptors("Reporting", metrics->GetReportings());
+
+    for (size_t i = 0; i < metrics->GetRanges().size(); i++)
+    {
+        /* Ranges keep no raw attributes */
+        const IRange                        *range = metrics->GetRanges().at(i);
+        std::map<std::string, std::string>  attributes;
+
+        if (!range->GetStarttime().empty())
+            attributes["starttime"] = range->GetStarttime();
+
+        if (!range->GetDuration().empty())
+            attributes["duration"] = range->GetDuration();
+
+        this->BeginElement("Range", attributes);
+        this->CloseElement();
+    }
+
+    this->EndElement(metrics);
+}
+void        ElementWriter::WriteSubset              (const ISubset *subset)
+{
+    this->BeginElement("Subset", subset);
+    this->EndElement(subset);
+}
+void        ElementWriter::WriteDescriptors         (const char *name, const std::vector<IDescriptor *> &descriptors)
+{
+    for (size_t i = 0; i < descriptors.size(); i++)
+    {
+        this->BeginElement(name, descriptors.at(i));
+        this->EndElement(descriptors.at(i));
+    }
+}
+void        ElementWriter::WriteURLType             (const char *name, const IURLType *urlType)
+{
+    if (urlType == NULL)
+        return;
+
+    this->BeginElement(name, urlType);
+    this->EndElement(urlType);
+}
+void        ElementWriter::WriteTextElement         (const char *name, const std::string &text)
+{
+    this->BeginElement(name, std::map<std::string, std::string>());
+    this->WriteText(text);
+    this->CloseElement();
+}
+void        ElementWriter::EndElement               (const IMPDElement *element)
+{
+    const std::vector<INode *> &nodes = element->GetAdditionalSubNodes();
+
+    for (size_t i = 0; i < nodes.size(); i++)
+        this->WriteNode(nodes.at(i));
+
+    this->CloseElement();
+}
@@ -0,0 +1,80 @@
+/*
+ * ElementWriter.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef ELEMENTWRITER_H_
+#define ELEMENTWRITER_H_
+
+#include "config.h"
+
+#include "IMPD.h"
+#include "INode.h"
+#include "../mpd/AbstractMPDElement.h"
+#include "../mpd/SegmentList.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Walks the MPD objects and writes them as elements with their raw attributes, in the order the objects keep them.
+         *  Elements that are not converted into objects follow the known elements of their parent. The subclasses decide
+         *  what an element is written to, SnapshotWriter writes the records of a snapshot and NodeWriter a node tree.
+         */
+        class ElementWriter
+        {
+            public:
+                ElementWriter           ();
+                virtual ~ElementWriter  ();
+
+            protected:
+                void            WriteMPD                    (const dash::mpd::IMPD *mpd);
+                void            WriteProgramInformation     (const dash::mpd::IProgramInformation *programInformation);
+                void            WriteBaseUrls               (const std::vector<dash::mpd::IBaseUrl *> &baseUrls);
+                virtual void    WritePeriod                 (const dash::mpd::IPeriod *period);
+                void            WriteAdaptationSet          (const dash::mpd::IAdaptationSet *adaptationSet);
+                void            WriteRepresentation         (const dash::mpd::IRepresentation *representation);
+                void            WriteRepresentationBase     (const dash::mpd::IRepresentationBase *representationBase);
+                void            WriteSubRepresentation      (const dash::mpd::ISubRepresentation *subRepresentation);
+                void            WriteContentComponent       (const dash::mpd::IContentComponent *contentComponent);
+                void            WriteSegmentInformation     (const dash::mpd::ISegmentBase *segmentBase, const dash::mpd::ISegmentList *segmentList,
+                                                             const dash::mpd::ISegmentTemplate *segmentTemplate);
+                void            WriteSegmentBase            (const dash::mpd::ISegmentBase *segmentBase);
+                void            WriteMultipleSegmentBase    (const dash::mpd::IMultipleSegmentBase *multipleSegmentBase);
+                void            WriteSegmentList            (const dash::mpd::ISegmentList *segmentList);
+                void            WriteSegmentTemplate        (const dash::mpd::ISegmentTemplate *segmentTemplate);
+                void            WriteSegmentTimeline        (const dash::mpd::ISegmentTimeline *segmentTimeline);
+                void            WriteMetrics                (const dash::mpd::IMetrics *metrics);
+                void            WriteSubset                 (const dash::mpd::ISubset *subset);
+                void            WriteDescriptors            (const char *name, const std::vector<dash::mpd::IDescriptor *> &descriptors);
+                void            WriteURLType                (const char *name, const dash::mpd::IURLType *urlType);
+                void            WriteTextElement            (const char *name, const std::string &text);
+
+                /*
+                 *  An element consists of its header, the known sub elements written by the caller and the additional
+                 *  sub nodes, which EndElement writes before it closes the element.
+                 */
+                void            EndElement                  (const dash::mpd::IMPDElement *element);
+
+                virtual void    BeginElement    (const std::string &name, const std::map<std::string, std::string> &attributes)   = 0;
+                virtual void    BeginElement    (const std::string &name, const dash::mpd::IMPDElement *element)                 = 0;
+                virtual void    CloseElement    ()                                                                              = 0;
+                virtual void    WriteNode       (const INode *node)                                                             = 0;
+                virtual void    WriteText       (const std::string &text)                                                       = 0;
+
+                /*
+                 *  Called after the header of each element that is refreshed separately and keeps its own digest.
+                 */
+                virtual void    WriteDigest     (const dash::mpd::IMPDElement *element)                                         = 0;
+        };
+    }
+}
+
+#endif /* ELEMENTWRITER_H_ */
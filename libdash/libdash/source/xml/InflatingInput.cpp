@@ -0,0 +1,158 @@
+/*
+ * InflatingInput.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "InflatingInput.h"
+
+using namespace dash::xml;
+
+const size_t InflatingInput::CHUNKSIZE = 65536;
+
+InflatingInput::InflatingInput  (const char *buffer, size_t length) :
+                file            (NULL),
+                buffer          (buffer),
+                length          (length),
+                isInitialized   (false),
+                isFinished      (false)
+{
+}
+InflatingInput::InflatingInput  (FILE *file) :
+                file            (file),
+                buffer          (NULL),
+                length          (0),
+                chunk           (CHUNKSIZE),
+                isInitialized   (false),
+                isFinished      (false)
+{
+}
+InflatingInput::~InflatingInput ()
+{
+    if (this->isInitialized)
+        inflateEnd(&this->stream);
+
+    if (this->file)
+        fclose(this->file);
+}
+
+bool                InflatingInput::IsCompressed    (const char *data, size_t length)
+{
+    if (data == NULL || length < 2)
+        return false;
+
+    const unsigned char *bytes = (const unsigned char *) data;
+
+    if (bytes[0] == 0x1f && bytes[1] == 0x8b)
+        return true;
+
+    /* a zlib header names the deflate method and is a multiple of 31, which no XML document starts with */
+    return (bytes[0] & 0x0f) == 8 && (bytes[0] >> 4) <= 7 && ((bytes[0] << 8) | bytes[1]) % 31 == 0;
+}
+xmlTextReaderPtr    InflatingInput::CreateReader    (const char *buffer, size_t length, const std::string &url)
+{
+    return CreateReader(new InflatingInput(buffer, length), url);
+}
+xmlTextReaderPtr    InflatingInput::CreateReader    (const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+
+    if (file == NULL)
+        return NULL;
+
+    char    header[2];
+    size_t  read = fread(header, 1, sizeof(header), file);
+
+    if (!IsCompressed(header, read) || fseek(file, 0, SEEK_SET) != 0)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    return CreateReader(new InflatingInput(file), path);
+}
+xmlTextReaderPtr    InflatingInput::CreateReader    (InflatingInput *input, const std::string &url)
+{
+    if (!input->Init())
+    {
+        delete input;
+        return NULL;
+    }
+
+    /* the reader owns the input from now on and deletes it through the close callback, even if it cannot be created */
+    return xmlReaderForIO(ReadCallback, CloseCallback, input, url.c_str(), NULL, 0);
+}
+bool                InflatingInput::Init            ()
+{
+    memset(&this->stream, 0, sizeof(this->stream));
+
+    /* 15 + 32 accepts the gzip and the zlib format with the largest window */
+    this->isInitialized = inflateInit2(&this->stream, 15 + 32) == Z_OK;
+
+    return this->isInitialized;
+}
+int                 InflatingInput::Inflate         (char *buffer, int length)
+{
+    this->stream.next_out   = (Bytef *) buffer;
+    this->stream.avail_out  = (uInt) length;
+
+    while (this->stream.avail_out > 0 && !this->isFinished)
+    {
+        /* the compressed data must not end before the end of the stream */
+        if (this->stream.avail_in == 0 && !this->Refill())
+            return -1;
+
+        int result = inflate(&this->stream, Z_NO_FLUSH);
+
+        if (result == Z_STREAM_END)
+        {
+            /* a gzip file may consist of several members, anything else that follows the stream is ignored */
+            if ((this->stream.avail_in > 0 || this->Refill()) && IsCompressed((const char *) this->stream.next_in, this->stream.avail_in))
+                inflateReset(&this->stream);
+            else
+                this->isFinished = true;
+        }
+        else if (result != Z_OK && result != Z_BUF_ERROR)
+        {
+            return -1;
+        }
+    }
+
+    return length - (int) this->stream.avail_out;
+}
+bool                InflatingInput::Refill          ()
+{
+    if (this->file)
+    {
+        size_t read = fread(&this->chunk[0], 1, this->chunk.size(), this->file);
+
+        this->stream.next_in    = (Bytef *) &this->chunk[0];
+        this->stream.avail_in   = (uInt) read;
+
+        return read > 0;
+    }
+
+    /* avail_in is only 32 bits wide, larger buffers are passed in several parts */
+    size_t part = this->length < 0x40000000 ? this->length : 0x40000000;
+
+    this->stream.next_in    = (Bytef *) this->buffer;
+    this->stream.avail_in   = (uInt) part;
+    this->buffer           += part;
+    this->length           -= part;
+
+    return part > 0;
+}
+int                 InflatingInput::ReadCallback    (void *context, char *buffer, int length)
+{
+    return ((InflatingInput *) context)->Inflate(buffer, length);
+}
+int                 InflatingInput::CloseCallback   (void *context)
+{
+    delete (InflatingInput *) context;
+    return 0;
+}
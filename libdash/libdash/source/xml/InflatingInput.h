@@ -0,0 +1,76 @@
+/*
+ * InflatingInput.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef INFLATINGINPUT_H_
+#define INFLATINGINPUT_H_
+
+#include "config.h"
+
+#include <stdio.h>
+#include <zlib.h>
+#include <libxml/xmlreader.h>
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Feeds a gzip or zlib compressed MPD into an xmlTextReader. The input is inflated chunk by chunk whenever the reader
+         *  asks for more data, so the decompressed document is never held in memory completely. A compressed file is read in
+         *  chunks as well, a compressed buffer is inflated in place.
+         */
+        class InflatingInput
+        {
+            public:
+                virtual ~InflatingInput ();
+
+                /*
+                 *  Returns true if the data starts with a gzip or zlib header.
+                 */
+                static bool             IsCompressed    (const char *data, size_t length);
+
+                /*
+                 *  Returns a reader for the compressed buffer, which must stay valid while the reader is used.
+                 */
+                static xmlTextReaderPtr CreateReader    (const char *buffer, size_t length, const std::string &url);
+
+                /*
+                 *  Returns a reader for the local file if it is compressed. NULL is returned if the file cannot be opened or is not
+                 *  compressed, e.g. because the path is a URL, so the caller falls back to xmlReaderForFile.
+                 */
+                static xmlTextReaderPtr CreateReader    (const std::string &path);
+
+            private:
+                InflatingInput          (const char *buffer, size_t length);
+                InflatingInput          (FILE *file);
+
+                bool                    Init            ();
+                int                     Inflate         (char *buffer, int length);
+                bool                    Refill          ();
+
+                static xmlTextReaderPtr CreateReader    (InflatingInput *input, const std::string &url);
+                static int              ReadCallback    (void *context, char *buffer, int length);
+                static int              CloseCallback   (void *context);
+
+                static const size_t     CHUNKSIZE;
+
+                z_stream                stream;
+                FILE                    *file;
+                const char              *buffer;
+                size_t                  length;
+                std::vector<char>       chunk;
+                bool                    isInitialized;
+                bool                    isFinished;
+        };
+    }
+}
+
+#endif /* INFLATINGINPUT_H_ */
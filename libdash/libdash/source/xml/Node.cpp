@@ -13,19 +13,26 @@
 #include <cstdlib>
 
 using namespace dash::xml;
+using namespace dash::helpers;
 using namespace dash::metrics;
 
-Node::Node  ()
+Node::Node  () :
+    arena(NULL),
+    rawAttributesRetained(true)
 {
 }
 Node::Node  (const Node& other) :
     name(other.name),
     text(other.text),
     type(other.type),
-    attributes(other.attributes)
+    attributes(other.attributes),
+    mpdPath(other.mpdPath),
+    arena(other.arena),
+    rawAttributesRetained(other.rawAttributesRetained)
 {
     for (size_t i = 0; i < other.subNodes.size(); i++)
-        this->subNodes.push_back(new Node(*(other.subNodes.at(i))));
+        if (other.subNodes.at(i))
+            this->subNodes.push_back(new Node(*(other.subNodes.at(i))));
 }
 Node::~Node ()
 {
@@ -33,763 +40,890 @@ Node::~Node ()
         delete(this->subNodes.at(i));
 }
 
-dash::mpd::ProgramInformation*              Node::ToProgramInformation  ()  const
+dash::mpd::ProgramInformation*              Node::ToProgramInformation  ()
 {
-    dash::mpd::ProgramInformation *programInformation = new dash::mpd::ProgramInformation();
+    dash::mpd::ProgramInformation *programInformation = new (this->arena) dash::mpd::ProgramInformation();
 
-    if (this->HasAttribute("lang"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        programInformation->SetLang(this->GetAttributeValue("lang"));
-    }
-    if (this->HasAttribute("moreInformationURL"))
-    {
-        programInformation->SetMoreInformationURL(this->GetAttributeValue("moreInformationURL"));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeLang:
+                programInformation->SetLang(value);
+                break;
+            case AttributeMoreInformationURL:
+                programInformation->SetMoreInformationURL(value);
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "Title")
+        switch (subNodes.at(i)->GetSchemaName())
         {
-            programInformation->SetTitle(subNodes.at(i)->GetText());
-            continue;
+            case ElementTitle:
+                programInformation->SetTitle(subNodes.at(i)->GetText());
+                break;
+            case ElementSource:
+                programInformation->SetSource(subNodes.at(i)->GetText());
+                break;
+            case ElementCopyright:
+                programInformation->SetCopyright(subNodes.at(i)->GetText());
+                break;
+            default:
+                this->MoveSubNodeTo(i, *programInformation);
         }
-        if (subNodes.at(i)->GetName() == "Source")
-        {
-            programInformation->SetSource(subNodes.at(i)->GetText());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Copyright")
-        {
-            programInformation->SetCopyright(subNodes.at(i)->GetText());
-            continue;
-        }
-        programInformation->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
     }
 
-    programInformation->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*programInformation);
     return programInformation;
 }
 dash::mpd::BaseUrl*                         Node::ToBaseUrl             ()  const
 {
-    dash::mpd::BaseUrl *baseUrl = new dash::mpd::BaseUrl();
+    dash::mpd::BaseUrl *baseUrl = new (this->arena) dash::mpd::BaseUrl();
 
-    if(this->HasAttribute("serviceLocation"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        baseUrl->SetServiceLocation(this->GetAttributeValue("serviceLocation"));
-    }
-    if(this->HasAttribute("byteRange"))
-    {
-        baseUrl->SetByteRange(this->GetAttributeValue("byteRange"));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeServiceLocation:
+                baseUrl->SetServiceLocation(value);
+                break;
+            case AttributeByteRange:
+                baseUrl->SetByteRange(value);
+                break;
+        }
     }
     if (this->GetText() == "./")
     {
-        baseUrl->SetUrl(this->mpdPath);
+        baseUrl->SetUrl(this->mpdPath.Get());
     }
-    else 
+    else
     {
         baseUrl->SetUrl(this->GetText());
     }
 
-    baseUrl->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*baseUrl);
     return baseUrl;
 }
-dash::mpd::Descriptor*                      Node::ToDescriptor          ()  const
+dash::mpd::PatchLocation*                   Node::ToPatchLocation       ()  const
 {
-    dash::mpd::Descriptor *descriptor = new dash::mpd::Descriptor();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::PatchLocation *patchLocation = new (this->arena) dash::mpd::PatchLocation();
 
-    if (this->HasAttribute("schemeIdUri"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        descriptor->SetSchemeIdUri(this->GetAttributeValue("schemeIdUri"));
+        if (this->attributes.at(i).first.GetTag() == AttributeTtl)
+            patchLocation->SetTTL(strtod(this->attributes.at(i).second.Get().c_str(), NULL));
     }
-    if (this->HasAttribute("value"))
-    {
-        descriptor->SetValue(this->GetAttributeValue("value"));
-    }
-    
-    for(size_t i = 0; i < subNodes.size(); i++)
+
+    patchLocation->SetUrl(this->GetText());
+
+    this->AddRawAttributesTo(*patchLocation);
+    return patchLocation;
+}
+dash::mpd::Descriptor*                      Node::ToDescriptor          ()
+{
+    dash::mpd::Descriptor *descriptor = new (this->arena) dash::mpd::Descriptor();
+
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        descriptor->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeSchemeIdUri:
+                descriptor->SetSchemeIdUri(value);
+                break;
+            case AttributeValue:
+                descriptor->SetValue(value);
+                break;
+        }
     }
 
-    descriptor->AddRawAttributes(this->attributes);
+    this->MoveSubNodesTo(*descriptor);
+
+    this->AddRawAttributesTo(*descriptor);
     return descriptor;
 }
-dash::mpd::ContentComponent*                Node::ToContentComponent    ()  const
+dash::mpd::ContentComponent*                Node::ToContentComponent    ()
 {
-    dash::mpd::ContentComponent *contentComponent = new dash::mpd::ContentComponent();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::ContentComponent *contentComponent = new (this->arena) dash::mpd::ContentComponent();
 
-    if (this->HasAttribute("id"))
-    {
-        contentComponent->SetId(strtoul(this->GetAttributeValue("id").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("lang"))
-    {
-        contentComponent->SetLang(this->GetAttributeValue("lang"));
-    }
-    if (this->HasAttribute("contentType"))
-    {
-        contentComponent->SetContentType(this->GetAttributeValue("contentType"));
-    }
-    if (this->HasAttribute("par"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        contentComponent->SetPar(this->GetAttributeValue("par"));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeId:
+                contentComponent->SetId(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeLang:
+                contentComponent->SetLang(value);
+                break;
+            case AttributeContentType:
+                contentComponent->SetContentType(value);
+                break;
+            case AttributePar:
+                contentComponent->SetPar(value);
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "Accessibility")
-        {
-            contentComponent->AddAccessibity(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Role")
-        {
-            contentComponent->AddRole(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Rating")
+        switch (subNodes.at(i)->GetSchemaName())
         {
-            contentComponent->AddRating(subNodes.at(i)->ToDescriptor());
-            continue;
+            case ElementAccessibility:
+                contentComponent->AddAccessibity(subNodes.at(i)->ToDescriptor());
+                break;
+            case ElementRole:
+                contentComponent->AddRole(subNodes.at(i)->ToDescriptor());
+                break;
+            case ElementRating:
+                contentComponent->AddRating(subNodes.at(i)->ToDescriptor());
+                break;
+            case ElementViewpoint:
+                contentComponent->AddViewpoint(subNodes.at(i)->ToDescriptor());
+                break;
+            default:
+                this->MoveSubNodeTo(i, *contentComponent);
         }
-        if (subNodes.at(i)->GetName() == "Viewpoint")
-        {
-            contentComponent->AddViewpoint(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        contentComponent->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
     }
 
-    contentComponent->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*contentComponent);
     return contentComponent;
 }
-dash::mpd::URLType*                         Node::ToURLType             (HTTPTransactionType type)  const
+dash::mpd::URLType*                         Node::ToURLType             (HTTPTransactionType type)
 {
-    dash::mpd::URLType* urlType = new dash::mpd::URLType();
-    
-    if (this->HasAttribute("sourceURL"))
-    {
-        urlType->SetSourceURL(this->GetAttributeValue("sourceURL"));
-    }
-    if (this->HasAttribute("range"))
-    {
-        urlType->SetRange(this->GetAttributeValue("range"));
-    }
+    dash::mpd::URLType* urlType = new (this->arena) dash::mpd::URLType();
 
-    for(size_t i = 0; i < subNodes.size(); i++)
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        urlType->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeSourceURL:
+                urlType->SetSourceURL(value);
+                break;
+            case AttributeRange:
+                urlType->SetRange(value);
+                break;
+        }
     }
 
+    this->MoveSubNodesTo(*urlType);
+
     urlType->SetType(type);
-    urlType->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*urlType);
     return urlType;
 }
-dash::mpd::SegmentBase*                     Node::ToSegmentBase         ()  const
+dash::mpd::SegmentBase*                     Node::ToSegmentBase         ()
 {
-    dash::mpd::SegmentBase* segmentBase = new dash::mpd::SegmentBase();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::SegmentBase* segmentBase = new (this->arena) dash::mpd::SegmentBase();
+    segmentBase->SetDigest(this->GetDigest());
 
-    SetCommonValuesForSeg(*segmentBase);
+    for (size_t i = 0; i < this->attributes.size(); i++)
+        this->SetSegmentBaseValue(*segmentBase, this->attributes.at(i));
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() != "Initialization" && subNodes.at(i)->GetName() != "RepresentationIndex")
-            segmentBase->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        if (!subNodes.at(i)->AppendToSegmentBase(*segmentBase))
+            this->MoveSubNodeTo(i, *segmentBase);
     }
 
-    segmentBase->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*segmentBase);
     return segmentBase;
 }
 dash::mpd::Timeline*                        Node::ToTimeline            ()  const
 {
-    dash::mpd::Timeline* timeline = new dash::mpd::Timeline();
+    dash::mpd::Timeline* timeline = new (this->arena) dash::mpd::Timeline();
 
-    if (this->HasAttribute("t"))
-    {
-        timeline->SetStartTime(strtoul(this->GetAttributeValue("t").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("d"))
-    {
-        timeline->SetDuration(strtoul(this->GetAttributeValue("d").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("r"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        timeline->SetRepeatCount(strtoul(this->GetAttributeValue("r").c_str(), NULL, 10));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeT:
+                timeline->SetStartTime(dash::helpers::String::ToUInt64(value));
+                break;
+            case AttributeD:
+                timeline->SetDuration(dash::helpers::String::ToUInt64(value));
+                break;
+            case AttributeR:
+                timeline->SetRepeatCount(dash::helpers::String::ToInt64(value));
+                break;
+        }
     }
 
-    timeline->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*timeline);
     return timeline;
 }
-dash::mpd::SegmentTimeline*                 Node::ToSegmentTimeline     ()  const
+dash::mpd::SegmentTimeline*                 Node::ToSegmentTimeline     ()
 {
-    dash::mpd::SegmentTimeline* segmentTimeline = new dash::mpd::SegmentTimeline();
+    dash::mpd::SegmentTimeline* segmentTimeline = new (this->arena) dash::mpd::SegmentTimeline();
 
-    std::vector<Node *> subNodes = this->GetSubNodes();
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "S")
+        if (subNodes.at(i)->GetSchemaName() == ElementS)
         {
             segmentTimeline->AddTimeline(subNodes.at(i)->ToTimeline());
             continue;
         }
-        segmentTimeline->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        this->MoveSubNodeTo(i, *segmentTimeline);
     }
 
-    segmentTimeline->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*segmentTimeline);
     return segmentTimeline;
 }
-dash::mpd::SegmentURL*                      Node::ToSegmentURL          ()  const
+dash::mpd::SegmentURL*                      Node::ToSegmentURL          ()
 {
-    dash::mpd::SegmentURL *segmentUrl = new dash::mpd::SegmentURL();
+    dash::mpd::SegmentURL *segmentUrl = new (this->arena) dash::mpd::SegmentURL();
 
-    if (this->HasAttribute("media"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        segmentUrl->SetMediaURI(this->GetAttributeValue("media"));
-    }
-    if (this->HasAttribute("mediaRange"))
-    {
-        segmentUrl->SetMediaRange(this->GetAttributeValue("mediaRange"));
-    }
-    if (this->HasAttribute("index"))
-    {
-        segmentUrl->SetIndexURI(this->GetAttributeValue("index"));
-    }
-    if (this->HasAttribute("indexRange"))
-    {
-        segmentUrl->SetIndexRange(this->GetAttributeValue("indexRange"));
-    }
+        const std::string &value = this->attributes.at(i).second.Get();
 
-    for(size_t i = 0; i < subNodes.size(); i++)
-    {
-        segmentUrl->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeMedia:
+                segmentUrl->SetMediaURI(value);
+                break;
+            case AttributeMediaRange:
+                segmentUrl->SetMediaRange(value);
+                break;
+            case AttributeIndex:
+                segmentUrl->SetIndexURI(value);
+                break;
+            case AttributeIndexRange:
+                segmentUrl->SetIndexRange(value);
+                break;
+        }
     }
 
-    segmentUrl->AddRawAttributes(this->attributes);
+    this->MoveSubNodesTo(*segmentUrl);
+
+    this->AddRawAttributesTo(*segmentUrl);
     return segmentUrl;
 }
-dash::mpd::SegmentList*                     Node::ToSegmentList         ()  const
+dash::mpd::SegmentList*                     Node::ToSegmentList         ()
 {
-    dash::mpd::SegmentList* segmentList = new dash::mpd::SegmentList();
-    std::vector<Node *> subNodes = this->GetSubNodes();
-
-    SetCommonValuesForMSeg(*segmentList);
+    dash::mpd::SegmentList* segmentList = new (this->arena) dash::mpd::SegmentList();
+    segmentList->SetDigest(this->GetDigest());
 
-    if (this->HasAttribute("xlink:href"))
-    {
-        segmentList->SetXlinkHref(this->GetAttributeValue("xlink:href"));
-    }
-    if (this->HasAttribute("xlink:actuate"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        segmentList->SetXlinkActuate(this->GetAttributeValue("xlink:actuate"));
+        if (this->SetMultipleSegmentBaseValue(*segmentList, this->attributes.at(i)))
+            continue;
+
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeXlinkHref:
+                segmentList->SetXlinkHref(value);
+                break;
+            case AttributeXlinkActuate:
+                segmentList->SetXlinkActuate(value);
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "SegmentURL")
+        if (subNodes.at(i)->GetSchemaName() == ElementSegmentURL)
         {
-            segmentList->AddSegmentURL(subNodes.at(i)->ToSegmentURL());
+            if (!subNodes.at(i)->subNodes.empty() || !segmentList->AddSegmentURL(subNodes.at(i)->attributes))
+                segmentList->AddSegmentURL(subNodes.at(i)->ToSegmentURL());
             continue;
         }
-        if (subNodes.at(i)->GetName() != "SegmentTimeline" && subNodes.at(i)->GetName() != "BitstreamSwitching" &&
-            subNodes.at(i)->GetName() != "Initialization" && subNodes.at(i)->GetName() != "RepresentationIndex")
-            segmentList->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        if (!subNodes.at(i)->AppendToMultipleSegmentBase(*segmentList))
+            this->MoveSubNodeTo(i, *segmentList);
     }
 
-    segmentList->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*segmentList);
     return segmentList;
 }
-dash::mpd::SegmentTemplate*                 Node::ToSegmentTemplate     ()  const
+dash::mpd::SegmentTemplate*                 Node::ToSegmentTemplate     ()
 {
-    dash::mpd::SegmentTemplate *segmentTemplate = new dash::mpd::SegmentTemplate();
-    std::vector<Node *> subNodes = this->GetSubNodes();
-
-    SetCommonValuesForMSeg(*segmentTemplate);
+    dash::mpd::SegmentTemplate *segmentTemplate = new (this->arena) dash::mpd::SegmentTemplate();
+    segmentTemplate->SetDigest(this->GetDigest());
 
-    if (this->HasAttribute("media"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        segmentTemplate->SetMedia(this->GetAttributeValue("media"));
-    }
-    if (this->HasAttribute("index"))
-    {
-        segmentTemplate->SetIndex(this->GetAttributeValue("index"));
-    }
-    if (this->HasAttribute("initialization"))
-    {
-        segmentTemplate->SetInitialization(this->GetAttributeValue("initialization"));
-    }
-    if (this->HasAttribute("bitstreamSwitching"))
-    {
-        segmentTemplate->SetBitstreamSwitching(this->GetAttributeValue("bitstreamSwitching"));
+        if (this->SetMultipleSegmentBaseValue(*segmentTemplate, this->attributes.at(i)))
+            continue;
+
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeMedia:
+                segmentTemplate->SetMedia(value);
+                break;
+            case AttributeIndex:
+                segmentTemplate->SetIndex(value);
+                break;
+            case AttributeInitialization:
+                segmentTemplate->SetInitialization(value);
+                break;
+            case AttributeBitstreamSwitching:
+                segmentTemplate->SetBitstreamSwitching(value);
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() != "SegmentTimeline" && subNodes.at(i)->GetName() != "BitstreamSwitching" &&
-            subNodes.at(i)->GetName() != "Initialization" && subNodes.at(i)->GetName() != "RepresentationIndex")
-            segmentTemplate->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        if (!subNodes.at(i)->AppendToMultipleSegmentBase(*segmentTemplate))
+            this->MoveSubNodeTo(i, *segmentTemplate);
     }
 
-    segmentTemplate->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*segmentTemplate);
     return segmentTemplate;
 }
-dash::mpd::SubRepresentation*               Node::ToSubRepresentation   ()  const
+dash::mpd::SubRepresentation*               Node::ToSubRepresentation   ()
 {
-    dash::mpd::SubRepresentation* subRepresentation = new dash::mpd::SubRepresentation();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::SubRepresentation* subRepresentation = new (this->arena) dash::mpd::SubRepresentation();
 
-    SetCommonValuesForRep(*subRepresentation);
-
-    if (this->HasAttribute("level"))
-    {
-        subRepresentation->SetLevel(strtoul(this->GetAttributeValue("level").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("dependencyLevel"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        subRepresentation->SetDependencyLevel(this->GetAttributeValue("dependencyLevel"));
-    }
-    if (this->HasAttribute("bandwidth"))
-    {
-        subRepresentation->SetBandWidth(strtoul(this->GetAttributeValue("bandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("contentComponent"))
-    {
-        subRepresentation->SetContentComponent(this->GetAttributeValue("contentComponent"));
+        if (this->SetRepresentationBaseValue(*subRepresentation, this->attributes.at(i)))
+            continue;
+
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeLevel:
+                subRepresentation->SetLevel(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeDependencyLevel:
+                subRepresentation->SetDependencyLevel(value);
+                break;
+            case AttributeBandwidth:
+                subRepresentation->SetBandWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeContentComponent:
+                subRepresentation->SetContentComponent(value);
+                break;
+        }
     }
     for (size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() != "FramePacking" && subNodes.at(i)->GetName() != "AudioChannelConfiguration" && subNodes.at(i)->GetName() != "ContentProtection")
-            subRepresentation->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        if (!subNodes.at(i)->AppendToRepresentationBase(*subRepresentation))
+            this->MoveSubNodeTo(i, *subRepresentation);
     }
 
-    subRepresentation->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*subRepresentation);
     return subRepresentation;
 }
-dash::mpd::Representation*                  Node::ToRepresentation      ()  const
+dash::mpd::Representation*                  Node::ToRepresentation      ()
 {
-    dash::mpd::Representation* representation = new dash::mpd::Representation();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::Representation* representation = new (this->arena) dash::mpd::Representation();
+    representation->SetDigest(this->GetDigest());
 
-    SetCommonValuesForRep(*representation);
-
-    if (this->HasAttribute("id"))
-    {
-        representation->SetId(this->GetAttributeValue("id"));
-    }
-    if (this->HasAttribute("bandwidth"))
-    {
-        representation->SetBandwidth(strtoul(this->GetAttributeValue("bandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("qualityRanking"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        representation->SetQualityRanking(strtoul(this->GetAttributeValue("qualityRanking").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("dependencyId"))
-    {
-        representation->SetDependencyId(this->GetAttributeValue("dependencyId"));
-    }
-    if (this->HasAttribute("mediaStreamStructureId"))
-    {
-        representation->SetMediaStreamStructureId(this->GetAttributeValue("mediaStreamStructureId"));
+        if (this->SetRepresentationBaseValue(*representation, this->attributes.at(i)))
+            continue;
+
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeId:
+                representation->SetId(value);
+                break;
+            case AttributeBandwidth:
+                representation->SetBandwidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeQualityRanking:
+                representation->SetQualityRanking(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeDependencyId:
+                representation->SetDependencyId(value);
+                break;
+            case AttributeMediaStreamStructureId:
+                representation->SetMediaStreamStructureId(value);
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "BaseURL")
+        switch (subNodes.at(i)->GetSchemaName())
         {
-            representation->AddBaseURL(subNodes.at(i)->ToBaseUrl());
-            continue;
+            case ElementBaseURL:
+                representation->AddBaseURL(subNodes.at(i)->ToBaseUrl());
+                break;
+            case ElementSubRepresentation:
+                representation->AddSubRepresentation(subNodes.at(i)->ToSubRepresentation());
+                break;
+            case ElementSegmentBase:
+                representation->SetSegmentBase(subNodes.at(i)->ToSegmentBase());
+                break;
+            case ElementSegmentList:
+                representation->SetSegmentList(subNodes.at(i)->ToSegmentList());
+                break;
+            case ElementSegmentTemplate:
+                representation->SetSegmentTemplate(subNodes.at(i)->ToSegmentTemplate());
+                break;
+            default:
+                if (!subNodes.at(i)->AppendToRepresentationBase(*representation))
+                    this->MoveSubNodeTo(i, *representation);
         }
-        if (subNodes.at(i)->GetName() == "SubRepresentation")
-        {
-            representation->AddSubRepresentation(subNodes.at(i)->ToSubRepresentation());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentBase")
-        {
-            representation->SetSegmentBase(subNodes.at(i)->ToSegmentBase());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentList")
-        {
-            representation->SetSegmentList(subNodes.at(i)->ToSegmentList());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentTemplate")
-        {
-            representation->SetSegmentTemplate(subNodes.at(i)->ToSegmentTemplate());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() != "FramePacking" && subNodes.at(i)->GetName() != "AudioChannelConfiguration" && subNodes.at(i)->GetName() != "ContentProtection")
-            representation->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
     }
 
-    representation->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*representation);
     return representation;
 }
-dash::mpd::AdaptationSet*                   Node::ToAdaptationSet       ()  const
+dash::mpd::AdaptationSet*                   Node::ToAdaptationSet       ()
 {
-    dash::mpd::AdaptationSet *adaptationSet = new dash::mpd::AdaptationSet();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::AdaptationSet *adaptationSet = new (this->arena) dash::mpd::AdaptationSet();
+    adaptationSet->SetDigest(this->GetDigest());
 
-    SetCommonValuesForRep(*adaptationSet);
-
-    if (this->HasAttribute("xlink:href"))
-    {
-        adaptationSet->SetXlinkHref(this->GetAttributeValue("xlink:href"));
-    }
-    if (this->HasAttribute("xlink:actuate"))
-    {
-        adaptationSet->SetXlinkActuate(this->GetAttributeValue("xlink:actuate"));
-    }
-    if (this->HasAttribute("id"))
-    {
-        adaptationSet->SetId(strtoul(this->GetAttributeValue("id").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("group"))
-    {
-        adaptationSet->SetGroup(strtoul(this->GetAttributeValue("group").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("lang"))
-    {
-        adaptationSet->SetLang(this->GetAttributeValue("lang"));
-    }
-    if (this->HasAttribute("contentType"))
-    {
-        adaptationSet->SetContentType(this->GetAttributeValue("contentType"));
-    }
-    if (this->HasAttribute("par"))
-    {
-        adaptationSet->SetPar(this->GetAttributeValue("par"));
-    }
-    if (this->HasAttribute("minBandwidth"))
-    {
-        adaptationSet->SetMinBandwidth(strtoul(this->GetAttributeValue("minBandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxBandwidth"))
-    {
-        adaptationSet->SetMaxBandwidth(strtoul(this->GetAttributeValue("maxBandwidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("minWidth"))
-    {
-        adaptationSet->SetMinWidth(strtoul(this->GetAttributeValue("minWidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxWidth"))
-    {
-        adaptationSet->SetMaxWidth(strtoul(this->GetAttributeValue("maxWidth").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("minHeight"))
-    {
-        adaptationSet->SetMinHeight(strtoul(this->GetAttributeValue("minHeight").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxHeight"))
-    {
-        adaptationSet->SetMaxHeight(strtoul(this->GetAttributeValue("maxHeight").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("minFrameRate"))
-    {
-        adaptationSet->SetMinFramerate(this->GetAttributeValue("minFrameRate"));
-    }
-    if (this->HasAttribute("maxFrameRate"))
-    {
-        adaptationSet->SetMaxFramerate(this->GetAttributeValue("maxFrameRate"));
-    }
-    if (this->HasAttribute("segmentAlignment"))
-    {
-        adaptationSet->SetSegmentAlignment(this->GetAttributeValue("segmentAlignment"));
-    }
-    if (this->HasAttribute("subsegmentAlignment"))
-    {
-        adaptationSet->SetSubsegmentAlignment(this->GetAttributeValue("subsegmentAlignment"));
-    }
-    if (this->HasAttribute("subsegmentStartsWithSAP"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        adaptationSet->SetMaxHeight((uint8_t) strtoul(this->GetAttributeValue("subsegmentStartsWithSAP").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("bitstreamSwitching"))
-    {
-        adaptationSet->SetBitstreamSwitching(dash::helpers::String::ToBool(this->GetAttributeValue("bitstreamSwitching")));
+        if (this->SetRepresentationBaseValue(*adaptationSet, this->attributes.at(i)))
+            continue;
+
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeXlinkHref:
+                adaptationSet->SetXlinkHref(value);
+                break;
+            case AttributeXlinkActuate:
+                adaptationSet->SetXlinkActuate(value);
+                break;
+            case AttributeId:
+                adaptationSet->SetId(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeGroup:
+                adaptationSet->SetGroup(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeLang:
+                adaptationSet->SetLang(value);
+                break;
+            case AttributeContentType:
+                adaptationSet->SetContentType(value);
+                break;
+            case AttributePar:
+                adaptationSet->SetPar(value);
+                break;
+            case AttributeMinBandwidth:
+                adaptationSet->SetMinBandwidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxBandwidth:
+                adaptationSet->SetMaxBandwidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMinWidth:
+                adaptationSet->SetMinWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxWidth:
+                adaptationSet->SetMaxWidth(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMinHeight:
+                adaptationSet->SetMinHeight(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMaxHeight:
+                adaptationSet->SetMaxHeight(strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeMinFrameRate:
+                adaptationSet->SetMinFramerate(value);
+                break;
+            case AttributeMaxFrameRate:
+                adaptationSet->SetMaxFramerate(value);
+                break;
+            case AttributeSegmentAlignment:
+                adaptationSet->SetSegmentAlignment(value);
+                break;
+            case AttributeSubsegmentAlignment:
+                adaptationSet->SetSubsegmentAlignment(value);
+                break;
+            case AttributeSubsegmentStartsWithSAP:
+                adaptationSet->SetMaxHeight((uint8_t) strtoul(value.c_str(), NULL, 10));
+                break;
+            case AttributeBitstreamSwitching:
+                adaptationSet->SetBitstreamSwitching(dash::helpers::String::ToBool(value));
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "Accessibility")
-        {
-            adaptationSet->AddAccessibity(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Role")
-        {
-            adaptationSet->AddRole(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Rating")
-        {
-            adaptationSet->AddRating(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Viewpoint")
-        {
-            adaptationSet->AddViewpoint(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "ContentComponent")
-        {
-            adaptationSet->AddContentComponent(subNodes.at(i)->ToContentComponent());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "BaseURL")
-        {
-            adaptationSet->AddBaseURL(subNodes.at(i)->ToBaseUrl());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentBase")
-        {
-            adaptationSet->SetSegmentBase(subNodes.at(i)->ToSegmentBase());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentList")
-        {
-            adaptationSet->SetSegmentList(subNodes.at(i)->ToSegmentList());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentTemplate")
-        {
-            adaptationSet->SetSegmentTemplate(subNodes.at(i)->ToSegmentTemplate());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Representation")
-        {
-            adaptationSet->AddRepresentation(subNodes.at(i)->ToRepresentation());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() != "FramePacking" && subNodes.at(i)->GetName() != "AudioChannelConfiguration" && subNodes.at(i)->GetName() != "ContentProtection")
-            adaptationSet->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        if (!subNodes.at(i)->AppendToAdaptationSet(adaptationSet))
+            this->MoveSubNodeTo(i, *adaptationSet);
     }
 
-    adaptationSet->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*adaptationSet);
     return adaptationSet;
 }
+bool                                        Node::AppendToAdaptationSet (dash::mpd::AdaptationSet *adaptationSet)
+{
+    switch (this->GetSchemaName())
+    {
+        case ElementAccessibility:
+            adaptationSet->AddAccessibity(this->ToDescriptor());
+            return true;
+        case ElementRole:
+            adaptationSet->AddRole(this->ToDescriptor());
+            return true;
+        case ElementRating:
+            adaptationSet->AddRating(this->ToDescriptor());
+            return true;
+        case ElementViewpoint:
+            adaptationSet->AddViewpoint(this->ToDescriptor());
+            return true;
+        case ElementContentComponent:
+            adaptationSet->AddContentComponent(this->ToContentComponent());
+            return true;
+        case ElementBaseURL:
+            adaptationSet->AddBaseURL(this->ToBaseUrl());
+            return true;
+        case ElementSegmentBase:
+            adaptationSet->SetSegmentBase(this->ToSegmentBase());
+            return true;
+        case ElementSegmentList:
+            adaptationSet->SetSegmentList(this->ToSegmentList());
+            return true;
+        case ElementSegmentTemplate:
+            adaptationSet->SetSegmentTemplate(this->ToSegmentTemplate());
+            return true;
+        case ElementRepresentation:
+            adaptationSet->AddRepresentation(this->ToRepresentation());
+            return true;
+        default:
+            return this->AppendToRepresentationBase(*adaptationSet);
+    }
+}
 dash::mpd::Subset*                          Node::ToSubset              ()  const
 {
-    dash::mpd::Subset *subset = new dash::mpd::Subset();
+    dash::mpd::Subset *subset = new (this->arena) dash::mpd::Subset();
 
-    if (this->HasAttribute("contains"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        subset->SetSubset(this->GetAttributeValue("contains"));
+        if (this->attributes.at(i).first.GetTag() == AttributeContains)
+            subset->SetSubset(this->attributes.at(i).second.Get());
     }
 
-    subset->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*subset);
     return subset;
 }
-dash::mpd::Period*                          Node::ToPeriod              ()  const
+dash::mpd::Period*                          Node::ToPeriod              ()
+{
+    return this->ToPeriod(NULL, NULL);
+}
+dash::mpd::Period*                          Node::ToPeriod              (IMPDBuildObserver *observer, dash::mpd::IMPD *mpd)
 {
-    dash::mpd::Period *period = new dash::mpd::Period();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    dash::mpd::Period *period = new (this->arena) dash::mpd::Period();
+    period->SetDigest(this->GetDigest());
 
-    if (this->HasAttribute("xlink:href"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        period->SetXlinkHref(this->GetAttributeValue("xlink:href"));
-    }
-    if (this->HasAttribute("xlink:actuate"))
-    {
-        period->SetXlinkActuate(this->GetAttributeValue("xlink:actuate"));
-    }
-    if (this->HasAttribute("id"))
-    {
-        period->SetId(this->GetAttributeValue("id"));
-    }
-    if (this->HasAttribute("start"))
-    {
-        period->SetStart(this->GetAttributeValue("start"));
-    }
-    if (this->HasAttribute("duration"))
-    {
-        period->SetDuration(this->GetAttributeValue("duration"));
-    }
-    if (this->HasAttribute("bitstreamSwitching"))
-    {
-        period->SetBitstreamSwitching(dash::helpers::String::ToBool(this->GetAttributeValue("bitstreamSwitching")));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeXlinkHref:
+                period->SetXlinkHref(value);
+                break;
+            case AttributeXlinkActuate:
+                period->SetXlinkActuate(value);
+                break;
+            case AttributeId:
+                period->SetId(value);
+                break;
+            case AttributeStart:
+                period->SetStart(value);
+                break;
+            case AttributeDuration:
+                period->SetDuration(value);
+                break;
+            case AttributeBitstreamSwitching:
+                period->SetBitstreamSwitching(dash::helpers::String::ToBool(value));
+                break;
+        }
     }
 
+    this->AddRawAttributesTo(*period);
+
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "BaseURL")
-        {
-            period->AddBaseURL(subNodes.at(i)->ToBaseUrl());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "AdaptationSet")
-        {
-            period->AddAdaptationSet(subNodes.at(i)->ToAdaptationSet());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Subset")
-        {
-            period->AddSubset(subNodes.at(i)->ToSubset());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentBase")
-        {
-            period->SetSegmentBase(subNodes.at(i)->ToSegmentBase());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentList")
-        {
-            period->SetSegmentList(subNodes.at(i)->ToSegmentList());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "SegmentTemplate")
-        {
-            period->SetSegmentTemplate(subNodes.at(i)->ToSegmentTemplate());
-            continue;
-        }
-        period->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
-    }    
+        if (!subNodes.at(i)->AppendToPeriod(period))
+            this->MoveSubNodeTo(i, *period);
+        else if (observer && subNodes.at(i)->GetSchemaName() == ElementAdaptationSet)
+            observer->OnAdaptationSetBuilt(mpd, period, period->GetAdaptationSets().back());
+    }
 
-    period->AddRawAttributes(this->attributes);
     return period;
 }
+bool                                        Node::AppendToPeriod        (dash::mpd::Period *period)
+{
+    switch (this->GetSchemaName())
+    {
+        case ElementBaseURL:
+            period->AddBaseURL(this->ToBaseUrl());
+            return true;
+        case ElementAdaptationSet:
+            period->AddAdaptationSet(this->ToAdaptationSet());
+            return true;
+        case ElementSubset:
+            period->AddSubset(this->ToSubset());
+            return true;
+        case ElementSegmentBase:
+            period->SetSegmentBase(this->ToSegmentBase());
+            return true;
+        case ElementSegmentList:
+            period->SetSegmentList(this->ToSegmentList());
+            return true;
+        case ElementSegmentTemplate:
+            period->SetSegmentTemplate(this->ToSegmentTemplate());
+            return true;
+        default:
+            return false;
+    }
+}
 dash::mpd::Range*                           Node::ToRange               ()  const
 {
-    dash::mpd::Range* range = new dash::mpd::Range();
+    dash::mpd::Range* range = new (this->arena) dash::mpd::Range();
 
-    if (this->HasAttribute("starttime"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        range->SetStarttime(this->GetAttributeValue("starttime"));
-    }
-    if (this->HasAttribute("duration"))
-    {
-        range->SetDuration(this->GetAttributeValue("duration"));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeStarttime:
+                range->SetStarttime(value);
+                break;
+            case AttributeDuration:
+                range->SetDuration(value);
+                break;
+        }
     }
 
     return range;
 }
-dash::mpd::Metrics*                         Node::ToMetrics             ()  const
+dash::mpd::Metrics*                         Node::ToMetrics             ()
 {
-    dash::mpd::Metrics* metrics = new dash::mpd::Metrics();
+    dash::mpd::Metrics* metrics = new (this->arena) dash::mpd::Metrics();
 
-    if (this->HasAttribute("metrics"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        metrics->SetMetrics(this->GetAttributeValue("metrics"));
+        if (this->attributes.at(i).first.GetTag() == AttributeMetrics)
+            metrics->SetMetrics(this->attributes.at(i).second.Get());
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "Reporting")
+        switch (subNodes.at(i)->GetSchemaName())
         {
-            metrics->AddReporting(subNodes.at(i)->ToDescriptor());
-            continue;
+            case ElementReporting:
+                metrics->AddReporting(subNodes.at(i)->ToDescriptor());
+                break;
+            case ElementRange:
+                metrics->AddRange(subNodes.at(i)->ToRange());
+                break;
+            default:
+                this->MoveSubNodeTo(i, *metrics);
         }
-        if (subNodes.at(i)->GetName() == "Range")
-        {
-            metrics->AddRange(subNodes.at(i)->ToRange());
-            continue;
-        }
-        metrics->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
     }
 
-    metrics->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*metrics);
     return metrics;
 }
-dash::mpd::MPD*                             Node::ToMPD                 ()  const
+dash::mpd::MPD*                             Node::ToMPD                 ()
 {
     dash::mpd::MPD *mpd = new dash::mpd::MPD();
-    std::vector<Node *> subNodes = this->GetSubNodes();
+    mpd->SetDigest(this->GetDigest());
+    mpd->SetArena(this->arena);
+    mpd->SetRawAttributesRetained(this->rawAttributesRetained);
 
-    if (this->HasAttribute("id"))
-    {
-        mpd->SetId(this->GetAttributeValue("id"));
-    }
-    if (this->HasAttribute("profiles"))
-    {
-        mpd->SetProfiles(this->GetAttributeValue("profiles"));
-    }
-    if (this->HasAttribute("type"))
-    {
-        mpd->SetType(this->GetAttributeValue("type"));
-    }
-    if (this->HasAttribute("availabilityStartTime"))
-    {
-        mpd->SetAvailabilityStarttime(this->GetAttributeValue("availabilityStartTime"));
-    }
-    if (this->HasAttribute("availabilityEndTime"))
-    {
-        mpd->SetAvailabilityEndtime(this->GetAttributeValue("availabilityEndTime"));
-    }
-    if (this->HasAttribute("mediaPresentationDuration"))
-    {
-        mpd->SetMediaPresentationDuration(this->GetAttributeValue("mediaPresentationDuration"));
-    }
-    if (this->HasAttribute("minimumUpdatePeriod"))
+    for (size_t i = 0; i < this->attributes.size(); i++)
     {
-        mpd->SetMinimumUpdatePeriod(this->GetAttributeValue("minimumUpdatePeriod"));
-    }
-    if (this->HasAttribute("minBufferTime"))
-    {
-        mpd->SetMinBufferTime(this->GetAttributeValue("minBufferTime"));
-    }
-    if (this->HasAttribute("timeShiftBufferDepth"))
-    {
-        mpd->SetTimeShiftBufferDepth(this->GetAttributeValue("timeShiftBufferDepth"));
-    }
-    if (this->HasAttribute("suggestedPresentationDelay"))
-    {
-        mpd->SetSuggestedPresentationDelay(this->GetAttributeValue("suggestedPresentationDelay"));
-    }
-    if (this->HasAttribute("maxSegmentDuration"))
-    {
-        mpd->SetMaxSegmentDuration(this->GetAttributeValue("maxSegmentDuration"));
-    }
-    if (this->HasAttribute("maxSubsegmentDuration"))
-    {
-        mpd->SetMaxSubsegmentDuration(this->GetAttributeValue("maxSubsegmentDuration"));
+        const std::string &value = this->attributes.at(i).second.Get();
+
+        switch (this->attributes.at(i).first.GetTag())
+        {
+            case AttributeId:
+                mpd->SetId(value);
+                break;
+            case AttributeProfiles:
+                mpd->SetProfiles(value);
+                break;
+            case AttributePublishTime:
+                mpd->SetPublishTime(value);
+                break;
+            case AttributeType:
+                mpd->SetType(value);
+                break;
+            case AttributeAvailabilityStartTime:
+                mpd->SetAvailabilityStarttime(value);
+                break;
+            case AttributeAvailabilityEndTime:
+                mpd->SetAvailabilityEndtime(value);
+                break;
+            case AttributeMediaPresentationDuration:
+                mpd->SetMediaPresentationDuration(value);
+                break;
+            case AttributeMinimumUpdatePeriod:
+                mpd->SetMinimumUpdatePeriod(value);
+                break;
+            case AttributeMinBufferTime:
+                mpd->SetMinBufferTime(value);
+                break;
+            case AttributeTimeShiftBufferDepth:
+                mpd->SetTimeShiftBufferDepth(value);
+                break;
+            case AttributeSuggestedPresentationDelay:
+                mpd->SetSuggestedPresentationDelay(value);
+                break;
+            case AttributeMaxSegmentDuration:
+                mpd->SetMaxSegmentDuration(value);
+                break;
+            case AttributeMaxSubsegmentDuration:
+                mpd->SetMaxSubsegmentDuration(value);
+                break;
+        }
     }
 
     for(size_t i = 0; i < subNodes.size(); i++)
     {
-        if (subNodes.at(i)->GetName() == "ProgramInformation")
-        {
-            mpd->AddProgramInformation(subNodes.at(i)->ToProgramInformation());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "BaseURL")
-        {
-            mpd->AddBaseUrl(subNodes.at(i)->ToBaseUrl());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Location")
-        {
-            mpd->AddLocation(subNodes.at(i)->GetText());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Period")
-        {
-            mpd->AddPeriod(subNodes.at(i)->ToPeriod());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "Metrics")
-        {
-            mpd->AddMetrics(subNodes.at(i)->ToMetrics());
-            continue;
-        }
-        mpd->AddAdditionalSubNode((xml::INode *) new Node(*(subNodes.at(i))));
+        if (!subNodes.at(i)->AppendToMPD(mpd))
+            this->MoveSubNodeTo(i, *mpd);
     }
 
-    dash::mpd::BaseUrl *mpdPathBaseUrl = new dash::mpd::BaseUrl();
-    mpdPathBaseUrl->SetUrl(mpdPath);
+    dash::mpd::BaseUrl *mpdPathBaseUrl = new (this->arena) dash::mpd::BaseUrl();
+    mpdPathBaseUrl->SetUrl(this->mpdPath.Get());
     mpd->SetMPDPathBaseUrl(mpdPathBaseUrl);
 
-    mpd->AddRawAttributes(this->attributes);
+    this->AddRawAttributesTo(*mpd);
     return mpd;
 }
-void                                        Node::SetMPDPath            (std::string path)
+bool                                        Node::AppendToMPD           (dash::mpd::MPD *mpd)
+{
+    switch (this->GetSchemaName())
+    {
+        case ElementProgramInformation:
+            mpd->AddProgramInformation(this->ToProgramInformation());
+            return true;
+        case ElementBaseURL:
+            mpd->AddBaseUrl(this->ToBaseUrl());
+            return true;
+        case ElementLocation:
+            mpd->AddLocation(this->GetText());
+            return true;
+        case ElementPatchLocation:
+            mpd->AddPatchLocation(this->ToPatchLocation());
+            return true;
+        case ElementPeriod:
+            mpd->AddPeriod(this->ToPeriod());
+            return true;
+        case ElementMetrics:
+            mpd->AddMetrics(this->ToMetrics());
+            return true;
+        default:
+            return false;
+    }
+}
+void                                        Node::SetMPDPath            (const InternedString &path)
 {
     this->mpdPath = path;
 }
+void                                        Node::SetArena              (Arena *arena)
+{
+    this->arena = arena;
+}
+void                                        Node::SetRawAttributesRetained  (bool retained)
+{
+    this->rawAttributesRetained = retained;
+}
+void                                        Node::MoveSubNodeTo         (size_t index, dash::mpd::AbstractMPDElement& object)
+{
+    object.AddAdditionalSubNode(this->subNodes.at(index));
+    this->subNodes.at(index) = NULL;
+}
+void                                        Node::MoveSubNodesTo        (dash::mpd::AbstractMPDElement& object)
+{
+    for(size_t i = 0; i < this->subNodes.size(); i++)
+        object.AddAdditionalSubNode(this->subNodes.at(i));
+
+    this->subNodes.clear();
+}
+void                                        Node::AddRawAttributesTo    (dash::mpd::AbstractMPDElement& object) const
+{
+    if (this->rawAttributesRetained)
+        object.AddRawAttributes(this->attributes);
+}
 
+uint64_t                                    Node::GetDigest             ()  const
+{
+    uint64_t digest = Node::HashString(FNV_OFFSET_BASIS, this->name.Get());
+
+    for (size_t i = 0; i < this->attributes.size(); i++)
+    {
+        digest = Node::HashString(digest, this->attributes.at(i).first.Get());
+        digest = Node::HashString(digest, this->attributes.at(i).second.Get());
+    }
+
+    digest = Node::HashString(digest, this->text.Get());
+
+    for (size_t i = 0; i < this->subNodes.size(); i++)
+        digest = Node::CombineDigest(digest, this->subNodes.at(i));
+
+    return digest;
+}
+uint64_t                                    Node::CombineDigest         (uint64_t digest, const Node *node)
+{
+    if (node == NULL || Node::IsRefreshedSeparately(node->GetSchemaName()))
+        return digest;
+
+    uint64_t subDigest = node->GetDigest();
+
+    for (size_t i = 0; i < sizeof(subDigest); i++)
+    {
+        digest ^= (subDigest >> (i * 8)) & 0xFF;
+        digest *= FNV_PRIME;
+    }
+    return digest;
+}
+bool                                        Node::IsRefreshedSeparately (SchemaName name)
+{
+    switch (name)
+    {
+        case ElementPeriod:
+        case ElementAdaptationSet:
+        case ElementRepresentation:
+        case ElementSegmentBase:
+        case ElementSegmentList:
+        case ElementSegmentTemplate:
+        case ElementSegmentTimeline:
+            return true;
+        default:
+            return false;
+    }
+}
+uint64_t                                    Node::HashString            (uint64_t digest, const std::string &value)
+{
+    for (size_t i = 0; i < value.size(); i++)
+    {
+        digest ^= (unsigned char) value[i];
+        digest *= FNV_PRIME;
+    }
+
+    /* terminate the string so that "ab" "c" and "a" "bc" differ */
+    digest *= FNV_PRIME;
+    return digest;
+}
 const std::vector<INode*>&                  Node::GetNodes              ()  const
 {
     return (std::vector<INode*> &) this->subNodes;
@@ -802,73 +936,153 @@ void                                        Node::AddSubNode            (Node *n
 {
     this->subNodes.push_back(node);
 }
+void                                        Node::InsertSubNode         (size_t index, Node *node)
+{
+    this->subNodes.insert(this->subNodes.begin() + index, node);
+}
+Node*                                       Node::RemoveSubNode         (size_t index)
+{
+    Node *node = this->subNodes.at(index);
+
+    this->subNodes.erase(this->subNodes.begin() + index);
+    return node;
+}
 const std::string&                          Node::GetName               ()  const
 {
-    return this->name;
+    return this->name.Get();
 }
-void                                        Node::SetName               (const std::string &name)
+SchemaName                                  Node::GetSchemaName         ()  const
+{
+    return (SchemaName) this->name.GetTag();
+}
+void                                        Node::SetName               (const InternedString &name)
 {
     this->name = name;
 }
-const std::string&                          Node::GetAttributeValue     (std::string key)   const
+const std::string&                          Node::GetAttributeValue     (const std::string& key)    const
 {
-    //return this->attributes[key];
-    return this->attributes.find(key)->second;
+    static const std::string empty;
+
+    size_t index = this->FindAttribute(key);
+
+    if (index < this->attributes.size() && this->attributes.at(index).first.Get() == key)
+        return this->attributes.at(index).second.Get();
+
+    return empty;
 }
 bool                                        Node::HasAttribute          (const std::string& name) const
 {
-    if(this->attributes.find(name) != this->attributes.end())
-        return true;
+    size_t index = this->FindAttribute(name);
 
-    return false;
+    return index < this->attributes.size() && this->attributes.at(index).first.Get() == name;
 }
-void                                        Node::AddAttribute          (const std::string &key, const std::string &value)
+void                                        Node::AddAttribute          (const InternedString &key, const InternedString &value)
 {
-    this->attributes[key] = value;
+    size_t index = this->FindAttribute(key.Get());
+
+    if (index < this->attributes.size() && this->attributes.at(index).first == key)
+        this->attributes.at(index).second = value;
+    else
+        this->attributes.insert(this->attributes.begin() + index, std::make_pair(key, value));
+
+    /* the lazily built views only notice a change of the number of attributes */
+    this->attributeKeys.clear();
+    this->attributeMap.clear();
 }
-std::vector<std::string>                    Node::GetAttributeKeys      ()  const
+void                                        Node::RemoveAttribute       (const std::string& key)
 {
-    std::vector<std::string> keys;
-    std::map<std::string, std::string>::const_iterator it;
+    size_t index = this->FindAttribute(key);
 
-    for(it = this->attributes.begin(); it != this->attributes.end(); ++it)
+    if (index < this->attributes.size() && this->attributes.at(index).first.Get() == key)
+        this->attributes.erase(this->attributes.begin() + index);
+
+    this->attributeKeys.clear();
+    this->attributeMap.clear();
+}
+size_t                                      Node::FindAttribute         (const std::string &key)    const
+{
+    /* the attributes are kept sorted by their key, like in a map */
+    size_t first = 0;
+    size_t last  = this->attributes.size();
+
+    while (first < last)
     {
-        keys.push_back(it->first);
+        size_t middle = (first + last) / 2;
+
+        if (this->attributes.at(middle).first.Get() < key)
+            first = middle + 1;
+        else
+            last = middle;
     }
-    return keys;
+    return first;
+}
+const std::vector<std::string>&             Node::GetAttributeKeys      ()  const
+{
+    /* built for callers of the public interface like the attribute map */
+    LazyLock::Enter();
+
+    if (this->attributeKeys.size() != this->attributes.size())
+    {
+        this->attributeKeys.clear();
+
+        for (size_t i = 0; i < this->attributes.size(); i++)
+            this->attributeKeys.push_back(this->attributes.at(i).first.Get());
+    }
+
+    LazyLock::Leave();
+    return this->attributeKeys;
+}
+size_t                                      Node::GetAttributeCount     ()  const
+{
+    return this->attributes.size();
+}
+const std::string&                          Node::GetAttributeKey       (size_t index)  const
+{
+    return this->attributes.at(index).first.Get();
+}
+const std::string&                          Node::GetAttributeValue     (size_t index)  const
+{
+    return this->attributes.at(index).second.Get();
 }
 bool                                        Node::HasText               ()  const
 {
     return false;
 }
-std::string                                 Node::GetText               () const
+const std::string&                          Node::GetText               () const
 {
-    if(this->type == 3)
-        return this->text;
-    else
-    {
-        if(this->subNodes.size())
-            return this->subNodes[0]->GetText();
-        else
-            return "";
-    }
+    /* the text of an element is held by its first sub node, the text of an element without one is empty */
+    if (this->type != 3 && this->subNodes.size() && this->subNodes[0])
+        return this->subNodes[0]->GetText();
+
+    return this->text.Get();
 }
-void                                        Node::SetText               (const std::string &text)
+void                                        Node::SetText               (const InternedString &text)
 {
     this->text = text;
 }
 void                                        Node::Print                 (std::ostream &stream)  const
 {
-    stream << this->name;
-    std::vector<std::string> keys = this->GetAttributeKeys();
-    for(size_t i = 0; i < keys.size(); i++)
-        stream << " " << keys.at(i) << "=" << this->GetAttributeValue(keys.at(i));
+    stream << this->name.Get();
+    for(size_t i = 0; i < this->attributes.size(); i++)
+        stream << " " << this->attributes.at(i).first.Get() << "=" << this->attributes.at(i).second.Get();
 
     stream << std::endl;
 }
 const std::map<std::string,std::string>&    Node::GetAttributes         ()  const
 {
-    return this->attributes;
+    /* only built for callers of the public interface, the conversion works on the interned attributes */
+    LazyLock::Enter();
+
+    if (this->attributeMap.size() != this->attributes.size())
+    {
+        this->attributeMap.clear();
+
+        for (size_t i = 0; i < this->attributes.size(); i++)
+            this->attributeMap[this->attributes.at(i).first.Get()] = this->attributes.at(i).second.Get();
+    }
+
+    LazyLock::Leave();
+    return this->attributeMap;
 }
 int                                         Node::GetType               ()  const
 {
@@ -878,148 +1092,136 @@ void                                        Node::SetType               (int typ
 {
     this->type = type;
 }
-void                                        Node::SetCommonValuesForRep (dash::mpd::RepresentationBase& object) const
+bool                                        Node::SetRepresentationBaseValue    (dash::mpd::RepresentationBase& object, const InternedAttribute &attribute) const
 {
-    std::vector<Node *> subNodes = this->GetSubNodes();
-
-    if (this->HasAttribute("profiles"))
-    {
-        object.SetProfiles(this->GetAttributeValue("profiles"));
-    }
-    if (this->HasAttribute("width"))
-    {
-        object.SetWidth(strtoul(this->GetAttributeValue("width").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("height"))
-    {
-        object.SetHeight(strtoul(this->GetAttributeValue("height").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("sar"))
-    {
-        object.SetSar(this->GetAttributeValue("sar"));
-    }
-    if (this->HasAttribute("frameRate"))
-    {
-        object.SetFrameRate(this->GetAttributeValue("frameRate"));
-    }
-    if (this->HasAttribute("audioSamplingRate"))
-    {
-        object.SetAudioSamplingRate(this->GetAttributeValue("audioSamplingRate"));
-    }
-    if (this->HasAttribute("mimeType"))
-    {
-        object.SetMimeType(this->GetAttributeValue("mimeType"));
-    }
-    if (this->HasAttribute("segmentProfiles"))
-    {
-        object.SetSegmentProfiles(this->GetAttributeValue("segmentProfiles"));
-    }
-    if (this->HasAttribute("codecs"))
-    {
-        object.SetCodecs(this->GetAttributeValue("codecs"));
-    }
-    if (this->HasAttribute("maximumSAPPeriod"))
-    {
-        object.SetMaximumSAPPeriod(strtod(this->GetAttributeValue("maximumSAPPeriod").c_str(), NULL));
-    }
-    if (this->HasAttribute("startWithSAP"))
-    {
-        object.SetStartWithSAP((uint8_t) strtoul(this->GetAttributeValue("startWithSAP").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("maxPlayoutRate"))
-    {
-        object.SetMaxPlayoutRate(strtod(this->GetAttributeValue("maxPlayoutRate").c_str(), NULL));
-    }
-    if (this->HasAttribute("codingDependency"))
-    {
-        object.SetCodingDependency(dash::helpers::String::ToBool(this->GetAttributeValue("codingDependency")));
-    }
-    if (this->HasAttribute("scanType"))
-    {
-        object.SetScanType(this->GetAttributeValue("scanType"));
-    }
-
-    for(size_t i = 0; i < subNodes.size(); i++)
-    {
-        if (subNodes.at(i)->GetName() == "FramePacking")
-        {
-            object.AddFramePacking(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "AudioChannelConfiguration")
-        {
-            object.AddAudioChannelConfiguration(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "ContentProtection")
-        {
-            object.AddContentProtection(subNodes.at(i)->ToDescriptor());
-            continue;
-        }
+    const std::string &value = attribute.second.Get();
+
+    switch (attribute.first.GetTag())
+    {
+        case AttributeProfiles:
+            object.SetProfiles(value);
+            return true;
+        case AttributeWidth:
+            object.SetWidth(strtoul(value.c_str(), NULL, 10));
+            return true;
+        case AttributeHeight:
+            object.SetHeight(strtoul(value.c_str(), NULL, 10));
+            return true;
+        case AttributeSar:
+            object.SetSar(attribute.second);
+            return true;
+        case AttributeFrameRate:
+            object.SetFrameRate(attribute.second);
+            return true;
+        case AttributeAudioSamplingRate:
+            object.SetAudioSamplingRate(attribute.second);
+            return true;
+        case AttributeMimeType:
+            object.SetMimeType(attribute.second);
+            return true;
+        case AttributeSegmentProfiles:
+            object.SetSegmentProfiles(value);
+            return true;
+        case AttributeCodecs:
+            object.SetCodecs(value);
+            return true;
+        case AttributeMaximumSAPPeriod:
+            object.SetMaximumSAPPeriod(strtod(value.c_str(), NULL));
+            return true;
+        case AttributeStartWithSAP:
+            object.SetStartWithSAP((uint8_t) strtoul(value.c_str(), NULL, 10));
+            return true;
+        case AttributeMaxPlayoutRate:
+            object.SetMaxPlayoutRate(strtod(value.c_str(), NULL));
+            return true;
+        case AttributeCodingDependency:
+            object.SetCodingDependency(dash::helpers::String::ToBool(value));
+            return true;
+        case AttributeScanType:
+            object.SetScanType(attribute.second);
+            return true;
+        default:
+            return false;
     }
 }
-void                                        Node::SetCommonValuesForSeg (dash::mpd::SegmentBase& object) const
+bool                                        Node::AppendToRepresentationBase    (dash::mpd::RepresentationBase& object)
 {
-    std::vector<Node *> subNodes = this->GetSubNodes();
-
-    if (this->HasAttribute("timescale"))
-    {
-        object.SetTimescale(strtoul(this->GetAttributeValue("timescale").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("presentationTimeOffset"))
-    {
-        object.SetPresentationTimeOffset(strtoul(this->GetAttributeValue("presentationTimeOffset").c_str(), NULL, 10));
-    }
-    if (this->HasAttribute("indexRange"))
-    {
-        object.SetIndexRange(this->GetAttributeValue("indexRange"));
-    }
-    if (this->HasAttribute("indexRangeExact"))
-    {
-        object.SetIndexRangeExact(dash::helpers::String::ToBool(this->GetAttributeValue("indexRangeExact")));
+    switch (this->GetSchemaName())
+    {
+        case ElementFramePacking:
+            object.AddFramePacking(this->ToDescriptor());
+            return true;
+        case ElementAudioChannelConfiguration:
+            object.AddAudioChannelConfiguration(this->ToDescriptor());
+            return true;
+        case ElementContentProtection:
+            object.AddContentProtection(this->ToDescriptor());
+            return true;
+        default:
+            return false;
     }
-
-    for(size_t i = 0; i < subNodes.size(); i++)
-    {
-        if (subNodes.at(i)->GetName() == "Initialization")
-        {
-            object.SetInitialization(subNodes.at(i)->ToURLType(dash::metrics::InitializationSegment));
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "RepresentationIndex")
-        {
-            object.SetRepresentationIndex(subNodes.at(i)->ToURLType(dash::metrics::IndexSegment));
-            continue;
-        }
+}
+bool                                        Node::SetSegmentBaseValue           (dash::mpd::SegmentBase& object, const InternedAttribute &attribute) const
+{
+    const std::string &value = attribute.second.Get();
+
+    switch (attribute.first.GetTag())
+    {
+        case AttributeTimescale:
+            object.SetTimescale(strtoul(value.c_str(), NULL, 10));
+            return true;
+        case AttributePresentationTimeOffset:
+            object.SetPresentationTimeOffset(strtoul(value.c_str(), NULL, 10));
+            return true;
+        case AttributeIndexRange:
+            object.SetIndexRange(value);
+            return true;
+        case AttributeIndexRangeExact:
+            object.SetIndexRangeExact(dash::helpers::String::ToBool(value));
+            return true;
+        default:
+            return false;
     }
 }
-void                                        Node::SetCommonValuesForMSeg(dash::mpd::MultipleSegmentBase& object) const
+bool                                        Node::AppendToSegmentBase           (dash::mpd::SegmentBase& object)
 {
-    std::vector<Node *> subNodes = this->GetSubNodes();
-
-    SetCommonValuesForSeg(object);
-
-    if (this->HasAttribute("duration"))
+    switch (this->GetSchemaName())
     {
-        object.SetDuration(strtoul(this->GetAttributeValue("duration").c_str(), NULL, 10));
+        case ElementInitialization:
+            object.SetInitialization(this->ToURLType(dash::metrics::InitializationSegment));
+            return true;
+        case ElementRepresentationIndex:
+            object.SetRepresentationIndex(this->ToURLType(dash::metrics::IndexSegment));
+            return true;
+        default:
+            return false;
     }
-    if (this->HasAttribute("startNumber"))
+}
+bool                                        Node::SetMultipleSegmentBaseValue   (dash::mpd::MultipleSegmentBase& object, const InternedAttribute &attribute) const
+{
+    switch (attribute.first.GetTag())
     {
-        object.SetStartNumber(strtoul(this->GetAttributeValue("startNumber").c_str(), NULL, 10));
+        case AttributeDuration:
+            object.SetDuration(strtoul(attribute.second.Get().c_str(), NULL, 10));
+            return true;
+        case AttributeStartNumber:
+            object.SetStartNumber(strtoul(attribute.second.Get().c_str(), NULL, 10));
+            return true;
+        default:
+            return this->SetSegmentBaseValue(object, attribute);
     }
-
-    for(size_t i = 0; i < subNodes.size(); i++)
+}
+bool                                        Node::AppendToMultipleSegmentBase   (dash::mpd::MultipleSegmentBase& object)
+{
+    switch (this->GetSchemaName())
     {
-        if (subNodes.at(i)->GetName() == "SegmentTimeline")
-        {
-            object.SetSegmentTimeline(subNodes.at(i)->ToSegmentTimeline());
-            continue;
-        }
-        if (subNodes.at(i)->GetName() == "BitstreamSwitching")
-        {
-            object.SetBitstreamSwitching(subNodes.at(i)->ToURLType(dash::metrics::BitstreamSwitchingSegment));
-            continue;
-        }
+        case ElementSegmentTimeline:
+            object.SetSegmentTimeline(this->ToSegmentTimeline());
+            return true;
+        case ElementBitstreamSwitching:
+            object.SetBitstreamSwitching(this->ToURLType(dash::metrics::BitstreamSwitchingSegment));
+            return true;
+        default:
+            return this->AppendToSegmentBase(object);
     }
-
-}
\ No newline at end of file
+}
@@ -16,6 +16,10 @@
 
 #include "INode.h"
 #include "../helpers/String.h"
+#include "../helpers/StringPool.h"
+#include "../helpers/LazyLock.h"
+#include "Schema.h"
+#include "IMPDBuildObserver.h"
 #include "../mpd/AdaptationSet.h"
 #include "../mpd/BaseUrl.h"
 #include "../mpd/ContentComponent.h"
@@ -23,6 +27,7 @@
 #include "../mpd/Metrics.h"
 #include "../mpd/MPD.h"
 #include "../mpd/MultipleSegmentBase.h"
+#include "../mpd/PatchLocation.h"
 #include "../mpd/Period.h"
 #include "../mpd/ProgramInformation.h"
 #include "../mpd/Range.h"
@@ -38,6 +43,9 @@
 #include "../mpd/URLType.h"
 #include "IHTTPTransaction.h"
 
+#define FNV_OFFSET_BASIS    14695981039346656037ULL
+#define FNV_PRIME           1099511628211ULL
+
 namespace dash
 {
     namespace xml
@@ -51,52 +59,110 @@ namespace dash
 
                 const std::vector<INode *>&                 GetNodes            ()  const;
                 const std::vector<Node *>&                  GetSubNodes         ()  const;
-                std::vector<std::string>                    GetAttributeKeys    ()  const;
+                const std::vector<std::string>&             GetAttributeKeys    ()  const;
+                size_t                                      GetAttributeCount   ()  const;
+                const std::string&                          GetAttributeKey     (size_t index)  const;
+                const std::string&                          GetAttributeValue   (size_t index)  const;
                 const std::string&                          GetName             ()  const;
-                std::string                                 GetText             ()  const;
+                SchemaName                                  GetSchemaName       ()  const;
+                const std::string&                          GetText             ()  const;
                 const std::map<std::string, std::string>&   GetAttributes       ()  const;
                 int                                         GetType             ()  const;
                 void                                        SetType             (int type);
-                const std::string&                          GetAttributeValue   (std::string key) const;
+                const std::string&                          GetAttributeValue   (const std::string& key) const;
                 void                                        AddSubNode          (Node *node);
-                void                                        SetName             (const std::string &name);
+
+                /*
+                 *  Used to patch a node tree. RemoveSubNode hands the sub node over to the caller, RemoveAttribute
+                 *  ignores an attribute that the node does not have.
+                 */
+                void                                        InsertSubNode       (size_t index, Node *node);
+                Node*                                       RemoveSubNode       (size_t index);
+                void                                        RemoveAttribute     (const std::string& key);
+                void                                        SetName             (const helpers::InternedString &name);
                 bool                                        HasAttribute        (const std::string& name) const;
-                void                                        AddAttribute        (const std::string &key, const std::string &value);
+                void                                        AddAttribute        (const helpers::InternedString &key, const helpers::InternedString &value);
                 bool                                        HasText             ()  const;
-                void                                        SetText             (const std::string &text);
+                void                                        SetText             (const helpers::InternedString &text);
                 void                                        Print               (std::ostream &stream)  const;
-                dash::mpd::MPD*                             ToMPD               ()  const;
-                void                                        SetMPDPath          (std::string path);
+                void                                        SetMPDPath          (const helpers::InternedString &path);
+                void                                        SetArena            (helpers::Arena *arena);
+
+                /*
+                 *  If disabled, the converted objects do not keep a copy of the attributes as raw attributes.
+                 */
+                void                                        SetRawAttributesRetained    (bool retained);
+
+                /*
+                 * The conversion methods consume the node: additional sub nodes are moved into the
+                 * resulting MPD objects instead of being copied, so the tree must not be converted twice.
+                 * The AppendTo methods convert a sub node of the given element and attach it. They return
+                 * false if the node is not known to the element, the caller then keeps its ownership.
+                 */
+                dash::mpd::MPD*                             ToMPD                   ();
+                dash::mpd::Period*                          ToPeriod                ();
+                /*
+                 *  Informs the observer about each AdaptationSet as soon as it has been appended to the Period.
+                 */
+                dash::mpd::Period*                          ToPeriod                (IMPDBuildObserver *observer, dash::mpd::IMPD *mpd);
+                dash::mpd::AdaptationSet*                   ToAdaptationSet         ();
+                dash::mpd::Representation*                  ToRepresentation        ();
+                dash::mpd::SegmentBase*                     ToSegmentBase           ();
+                dash::mpd::SegmentList*                     ToSegmentList           ();
+                dash::mpd::SegmentTemplate*                 ToSegmentTemplate       ();
+                dash::mpd::SegmentTimeline*                 ToSegmentTimeline       ();
+                bool                                        AppendToMPD             (dash::mpd::MPD *mpd);
+                bool                                        AppendToPeriod          (dash::mpd::Period *period);
+                bool                                        AppendToAdaptationSet   (dash::mpd::AdaptationSet *adaptationSet);
+
+                /*
+                 *  The digest covers the name, attributes, text and sub nodes of the node. Elements that are refreshed on
+                 *  their own (Periods, AdaptationSets, Representations and the segment information) are left out, so a
+                 *  refresh can tell whether the attributes of an element changed independently of its children.
+                 */
+                uint64_t                                    GetDigest               ()  const;
+                static uint64_t                             CombineDigest           (uint64_t digest, const Node *node);
+                static bool                                 IsRefreshedSeparately   (SchemaName name);
 
             private:
-                void                                        SetCommonValuesForRep   (dash::mpd::RepresentationBase& object) const;
-                void                                        SetCommonValuesForSeg   (dash::mpd::SegmentBase& object) const;
-                void                                        SetCommonValuesForMSeg  (dash::mpd::MultipleSegmentBase& object) const;
-                dash::mpd::AdaptationSet*                   ToAdaptationSet         ()  const;
+                /*
+                 *  The Set...Value methods convert an attribute that is shared by several elements and return false if
+                 *  the attribute is not known to the base class. The AppendTo methods do the same for sub nodes.
+                 */
+                bool                                        SetRepresentationBaseValue  (dash::mpd::RepresentationBase& object, const helpers::InternedAttribute &attribute) const;
+                bool                                        SetSegmentBaseValue         (dash::mpd::SegmentBase& object, const helpers::InternedAttribute &attribute) const;
+                bool                                        SetMultipleSegmentBaseValue (dash::mpd::MultipleSegmentBase& object, const helpers::InternedAttribute &attribute) const;
+                bool                                        AppendToRepresentationBase  (dash::mpd::RepresentationBase& object);
+                bool                                        AppendToSegmentBase         (dash::mpd::SegmentBase& object);
+                bool                                        AppendToMultipleSegmentBase (dash::mpd::MultipleSegmentBase& object);
+                void                                        MoveSubNodeTo               (size_t index, dash::mpd::AbstractMPDElement& object);
+                void                                        MoveSubNodesTo              (dash::mpd::AbstractMPDElement& object);
+                void                                        AddRawAttributesTo          (dash::mpd::AbstractMPDElement& object) const;
+                static uint64_t                             HashString                  (uint64_t digest, const std::string &value);
+                size_t                                      FindAttribute               (const std::string &key) const;
                 dash::mpd::BaseUrl*                         ToBaseUrl               ()  const;
-                dash::mpd::ContentComponent*                ToContentComponent      ()  const;
-                dash::mpd::Descriptor*                      ToDescriptor            ()  const;
-                dash::mpd::Metrics*                         ToMetrics               ()  const;
-                dash::mpd::Period*                          ToPeriod                ()  const;
-                dash::mpd::ProgramInformation*              ToProgramInformation    ()  const;
+                dash::mpd::ContentComponent*                ToContentComponent      ();
+                dash::mpd::Descriptor*                      ToDescriptor            ();
+                dash::mpd::Metrics*                         ToMetrics               ();
+                dash::mpd::PatchLocation*                   ToPatchLocation         ()  const;
+                dash::mpd::ProgramInformation*              ToProgramInformation    ();
                 dash::mpd::Range*                           ToRange                 ()  const;
-                dash::mpd::Representation*                  ToRepresentation        ()  const;
-                dash::mpd::SegmentBase*                     ToSegmentBase           ()  const;
-                dash::mpd::SegmentList*                     ToSegmentList           ()  const;
-                dash::mpd::SegmentTemplate*                 ToSegmentTemplate       ()  const;
                 dash::mpd::Timeline*                        ToTimeline              ()  const;
-                dash::mpd::SegmentTimeline*                 ToSegmentTimeline       ()  const;
-                dash::mpd::SegmentURL*                      ToSegmentURL            ()  const;
-                dash::mpd::SubRepresentation*               ToSubRepresentation     ()  const;
+                dash::mpd::SegmentURL*                      ToSegmentURL            ();
+                dash::mpd::SubRepresentation*               ToSubRepresentation     ();
                 dash::mpd::Subset*                          ToSubset                ()  const;
-                dash::mpd::URLType*                         ToURLType               (dash::metrics::HTTPTransactionType transActType)  const;
+                dash::mpd::URLType*                         ToURLType               (dash::metrics::HTTPTransactionType transActType);
 
                 std::vector<Node *>                 subNodes;
-                std::map<std::string, std::string>  attributes;
-                std::string                         name;
-                std::string                         text;
-                int                                 type;
-                std::string                         mpdPath;
+                helpers::InternedAttributes                 attributes;
+                mutable std::map<std::string, std::string>  attributeMap;
+                mutable std::vector<std::string>            attributeKeys;
+                helpers::InternedString                     name;
+                helpers::InternedString                     text;
+                int                                         type;
+                helpers::InternedString                     mpdPath;
+                helpers::Arena                              *arena;
+                bool                                        rawAttributesRetained;
 
         };
     }
@@ -0,0 +1,194 @@
+/*
+ * NodeWriter.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "NodeWriter.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+using namespace dash::helpers;
+
+NodeWriter::NodeWriter  (StringPool *stringPool, const InternedString &mpdPath) :
+            stringPool  (stringPool),
+            mpdPath     (mpdPath),
+            root        (NULL),
+            isShallow   (false)
+{
+    this->stringPool->Retain();
+}
+NodeWriter::~NodeWriter ()
+{
+    delete this->root;
+
+    this->stringPool->Release();
+}
+
+Node*                   NodeWriter::ToNode              (const IMPD *mpd)
+{
+    this->Reset();
+    this->isShallow = true;
+    this->WriteMPD(mpd);
+    this->isShallow = false;
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const IPeriod *period)
+{
+    this->Reset();
+    this->WritePeriod(period);
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const IAdaptationSet *adaptationSet)
+{
+    this->Reset();
+    this->WriteAdaptationSet(adaptationSet);
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const IRepresentation *representation)
+{
+    this->Reset();
+    this->WriteRepresentation(representation);
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const ISegmentBase *segmentBase)
+{
+    this->Reset();
+    this->WriteSegmentInformation(segmentBase, NULL, NULL);
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const ISegmentList *segmentList)
+{
+    this->Reset();
+    this->WriteSegmentList(segmentList);
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const ISegmentTemplate *segmentTemplate)
+{
+    this->Reset();
+    this->WriteSegmentTemplate(segmentTemplate);
+
+    return this->TakeRoot();
+}
+Node*                   NodeWriter::ToNode              (const ISegmentTimeline *segmentTimeline)
+{
+    this->Reset();
+    this->WriteSegmentTimeline(segmentTimeline);
+
+    return this->TakeRoot();
+}
+IPeriod*                NodeWriter::GetPeriod           (const Node *node)  const
+{
+    std::map<const Node *, IPeriod *>::const_iterator it = this->periods.find(node);
+
+    return it == this->periods.end() ? NULL : it->second;
+}
+size_t                  NodeWriter::GetDigestCount      ()  const
+{
+    return this->digests.size();
+}
+const IMPDElement*      NodeWriter::GetDigestElement    (size_t index)  const
+{
+    return this->digests.at(index).first;
+}
+const Node*             NodeWriter::GetDigestNode       (size_t index)  const
+{
+    return this->digests.at(index).second;
+}
+void                    NodeWriter::WritePeriod         (const IPeriod *period)
+{
+    if (!this->isShallow)
+    {
+        ElementWriter::WritePeriod(period);
+        return;
+    }
+
+    this->BeginElement("Period", period);
+    this->periods[this->open.back()] = (IPeriod *) period;
+    this->CloseElement();
+}
+void                    NodeWriter::BeginElement        (const std::string &name, const std::map<std::string, std::string> &attributes)
+{
+    Node *node = this->BeginNode(name);
+
+    for (std::map<std::string, std::string>::const_iterator it = attributes.begin(); it != attributes.end(); ++it)
+        node->AddAttribute(this->stringPool->Intern(it->first), this->stringPool->Intern(it->second));
+}
+void                    NodeWriter::BeginElement        (const std::string &name, const IMPDElement *element)
+{
+    Node *node = this->BeginNode(name);
+
+    for (size_t i = 0; i < element->GetRawAttributeCount(); i++)
+        node->AddAttribute(this->stringPool->Intern(element->GetRawAttributeKey(i)), this->stringPool->Intern(element->GetRawAttributeValue(i)));
+}
+void                    NodeWriter::CloseElement        ()
+{
+    this->open.pop_back();
+}
+void                    NodeWriter::WriteNode           (const INode *node)
+{
+    const Node *subnode = dynamic_cast<const Node *>(node);
+
+    if (subnode)
+        this->AddNode(new Node(*subnode));
+}
+void                    NodeWriter::WriteText           (const std::string &text)
+{
+    Node *node = new Node();
+    node->SetType(Text);
+    node->SetText(this->stringPool->Intern(text));
+
+    this->AddNode(node);
+}
+void                    NodeWriter::WriteDigest         (const IMPDElement *element)
+{
+    this->digests.push_back(std::make_pair(element, this->open.back()));
+}
+void                    NodeWriter::Reset               ()
+{
+    delete this->root;
+
+    this->root = NULL;
+    this->open.clear();
+    this->periods.clear();
+    this->digests.clear();
+}
+Node*                   NodeWriter::BeginNode           (const std::string &name)
+{
+    Node *node = new Node();
+    node->SetType(Start);
+    node->SetMPDPath(this->mpdPath);
+    node->SetName(this->stringPool->Intern(name));
+
+    this->AddNode(node);
+    this->open.push_back(node);
+
+    return node;
+}
+void                    NodeWriter::AddNode             (Node *node)
+{
+    if (this->open.size())
+        this->open.back()->AddSubNode(node);
+    else if (this->root == NULL)
+        this->root = node;
+    else
+        delete node;
+}
+Node*                   NodeWriter::TakeRoot            ()
+{
+    Node *node = this->root;
+
+    this->root = NULL;
+    return node;
+}
@@ -0,0 +1,86 @@
+/*
+ * NodeWriter.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef NODEWRITER_H_
+#define NODEWRITER_H_
+
+#include "config.h"
+
+#include "ElementWriter.h"
+#include "DOMParser.h"
+#include "Node.h"
+#include "../helpers/StringPool.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Turns an element of an MPD back into a node tree, which can be changed and converted again. The names and values
+         *  are interned into the given pool, the nodes are placed on the heap and take the given path of the MPD. The
+         *  caller owns the returned tree.
+         */
+        class NodeWriter : public ElementWriter
+        {
+            public:
+                NodeWriter          (helpers::StringPool *stringPool, const helpers::InternedString &mpdPath);
+                virtual ~NodeWriter ();
+
+                /*
+                 *  The MPD is written without the contents of its Periods. Each Period is an empty element with the attributes
+                 *  of the Period, GetPeriod returns the Period such a node stands for.
+                 */
+                Node*   ToNode  (const dash::mpd::IMPD *mpd);
+                Node*   ToNode  (const dash::mpd::IPeriod *period);
+                Node*   ToNode  (const dash::mpd::IAdaptationSet *adaptationSet);
+                Node*   ToNode  (const dash::mpd::IRepresentation *representation);
+                Node*   ToNode  (const dash::mpd::ISegmentBase *segmentBase);
+                Node*   ToNode  (const dash::mpd::ISegmentList *segmentList);
+                Node*   ToNode  (const dash::mpd::ISegmentTemplate *segmentTemplate);
+                Node*   ToNode  (const dash::mpd::ISegmentTimeline *segmentTimeline);
+
+                dash::mpd::IPeriod*                 GetPeriod           (const Node *node)  const;
+
+                /*
+                 *  The elements that keep a digest and the nodes they have been written to by the last call to ToNode, in the
+                 *  order they have been written.
+                 */
+                size_t                              GetDigestCount      ()  const;
+                const dash::mpd::IMPDElement*       GetDigestElement    (size_t index)  const;
+                const Node*                         GetDigestNode       (size_t index)  const;
+
+            protected:
+                void    WritePeriod     (const dash::mpd::IPeriod *period);
+                void    BeginElement    (const std::string &name, const std::map<std::string, std::string> &attributes);
+                void    BeginElement    (const std::string &name, const dash::mpd::IMPDElement *element);
+                void    CloseElement    ();
+                void    WriteNode       (const INode *node);
+                void    WriteText       (const std::string &text);
+                void    WriteDigest     (const dash::mpd::IMPDElement *element);
+
+            private:
+                void    Reset           ();
+                Node*   BeginNode       (const std::string &name);
+                void    AddNode         (Node *node);
+                Node*   TakeRoot        ();
+
+                helpers::StringPool                                         *stringPool;
+                helpers::InternedString                                     mpdPath;
+                Node                                                        *root;
+                std::vector<Node *>                                         open;
+                bool                                                        isShallow;
+                std::map<const Node *, dash::mpd::IPeriod *>                periods;
+                std::vector<std::pair<const dash::mpd::IMPDElement *, Node *> >  digests;
+        };
+    }
+}
+
+#endif /* NODEWRITER_H_ */
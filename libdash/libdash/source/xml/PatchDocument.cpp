@@ -0,0 +1,714 @@
+/*
+ * PatchDocument.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "PatchDocument.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+using namespace dash::helpers;
+
+PatchDocument::PatchDocument    (const char *data, size_t length, const MPD *mpd) :
+               parser           (data, length, GetMPDUrl(mpd)),
+               stringPool       (mpd->GetStringPool()),
+               root             (NULL)
+{
+    this->stringPool->Retain();
+    this->mpdPath = this->stringPool->Intern(mpd->GetMPDPathBaseUrl() ? mpd->GetMPDPathBaseUrl()->GetUrl() : "");
+
+    this->parser.SetStringPool(this->stringPool);
+
+    if (!this->parser.Parse() || GetLocalName(this->parser.GetRootNode()->GetName()) != "Patch")
+        return;
+
+    this->root                  = this->parser.GetRootNode();
+    this->mpdId                 = this->root->GetAttributeValue("mpdId");
+    this->originalPublishTime   = this->root->GetAttributeValue("originalPublishTime");
+    this->publishTime           = this->root->GetAttributeValue("publishTime");
+}
+PatchDocument::~PatchDocument   ()
+{
+    this->stringPool->Release();
+}
+
+bool                PatchDocument::IsApplicableTo   (const IMPD *mpd)  const
+{
+    if (this->root == NULL || this->publishTime.empty() || this->mpdId != mpd->GetId())
+        return false;
+
+    return IsDateTimeEqual(this->originalPublishTime, mpd->GetPublishTime());
+}
+const std::string&  PatchDocument::GetPublishTime   ()  const
+{
+    return this->publishTime;
+}
+bool                PatchDocument::Apply            (MPD *mpd, const ParseOptions &options, RefreshReport &report) const
+{
+    if (this->root == NULL)
+        return false;
+
+    for (size_t i = 0; i < this->root->GetSubNodes().size(); i++)
+    {
+        const Node *operation = this->root->GetSubNodes().at(i);
+
+        if (operation && operation->GetType() == Start && !this->ApplyOperation(mpd, operation, options, report))
+            return false;
+    }
+
+    if (IsDateTimeEqual(mpd->GetPublishTime(), this->publishTime))
+        return true;
+
+    /* the new version is identified by the publish time of the patch, even if the patch does not replace it explicitly */
+    NodeWriter  writer(this->stringPool, this->mpdPath);
+    Node        *node = writer.ToNode((const IMPD *) mpd);
+
+    AdoptDigests(writer);
+    node->AddAttribute(this->stringPool->Intern("publishTime"), this->stringPool->Intern(this->publishTime));
+
+    this->MergeMPD(mpd, node, writer, options, report);
+
+    delete node;
+    return true;
+}
+bool                PatchDocument::ApplyOperation   (MPD *mpd, const Node *operation, const ParseOptions &options, RefreshReport &report) const
+{
+    std::string                 name = GetLocalName(operation->GetName());
+    std::vector<std::string>    steps;
+    std::string                 attribute;
+
+    if (!SplitSteps(operation->GetAttributeValue("sel"), steps))
+        return false;
+
+    if (steps.back().at(0) == '@')
+    {
+        attribute = steps.back().substr(1);
+        steps.pop_back();
+    }
+
+    /* removing or replacing an element and adding a sibling change the parent of the selected element */
+    const std::string   &pos            = operation->GetAttributeValue("pos");
+    bool                changesParent   = attribute.empty() && (name == "remove" || name == "replace" ||
+                                          (name == "add" && operation->GetAttributeValue("type").empty() && (pos == "before" || pos == "after")));
+
+    if (steps.size() < (changesParent ? 2 : 1))
+        return false;
+
+    Scope   scope;
+    size_t  depth = 0;
+
+    if (!this->SelectScope(mpd, steps, steps.size() - (changesParent ? 1 : 0), scope, depth))
+        return false;
+
+    /* a live MPD grows by the S elements that are appended to its timelines, only these are converted then */
+    if (scope.name == ElementSegmentTimeline && depth == steps.size() && name == "add" && attribute.empty() &&
+        pos.empty() && operation->GetAttributeValue("type").empty() && IsTimeline(operation->GetSubNodes()))
+        return this->AppendTimelines(dynamic_cast<SegmentTimeline *>(scope.element), operation, report);
+
+    NodeWriter  writer(this->stringPool, this->mpdPath);
+    Node        *node = this->ToNode(scope, writer);
+
+    /* the digests of the written elements are compared with those of the converted nodes, so that the elements the
+       operation does not change stay as they are, even if their nodes differ from the document they have been parsed from */
+    AdoptDigests(writer);
+
+    Selection           target;
+    std::vector<Node *> removed;
+    bool                isApplied = Select(node, steps, depth, target) && this->Modify(target, operation, name, attribute, removed);
+
+    if (isApplied)
+        this->Merge(scope, node, writer, options, report);
+
+    /* removed nodes are deleted last, a node that is added in their place must not be taken for a Period of the MPD */
+    delete node;
+
+    for (size_t i = 0; i < removed.size(); i++)
+        delete removed.at(i);
+
+    return isApplied;
+}
+bool                PatchDocument::Modify           (const Selection &target, const Node *operation, const std::string &name, const std::string &attribute,
+                                                     std::vector<Node *> &removed)  const
+{
+    Node                        *element    = target.node;
+    Node                        *parent     = target.parent;
+    const std::vector<Node *>   &content    = operation->GetSubNodes();
+    size_t                      index       = 0;
+
+    if (parent)
+        index = std::find(parent->GetSubNodes().begin(), parent->GetSubNodes().end(), element) - parent->GetSubNodes().begin();
+
+    if (name == "add")
+    {
+        const std::string &type    = operation->GetAttributeValue("type");
+        const std::string &pos     = operation->GetAttributeValue("pos");
+
+        if (!attribute.empty())
+            return false;
+
+        if (!type.empty())
+        {
+            if (type.at(0) != '@' || element->HasAttribute(type.substr(1)))
+                return false;
+
+            element->AddAttribute(this->stringPool->Intern(type.substr(1)), this->stringPool->Intern(operation->GetText()));
+            return true;
+        }
+
+        if (pos == "before" || pos == "after")
+        {
+            element = parent;
+            index   = index + (pos == "after" ? 1 : 0);
+        }
+        else if (pos == "prepend")
+            index = 0;
+        else if (pos.empty())
+            index = element->GetSubNodes().size();
+        else
+            return false;
+
+        for (size_t i = 0; i < content.size(); i++)
+            if (content.at(i))
+                element->InsertSubNode(index++, new Node(*content.at(i)));
+
+        return true;
+    }
+
+    if (name == "replace")
+    {
+        if (!attribute.empty())
+        {
+            if (!element->HasAttribute(attribute))
+                return false;
+
+            element->AddAttribute(this->stringPool->Intern(attribute), this->stringPool->Intern(operation->GetText()));
+            return true;
+        }
+
+        const Node *replacement = NULL;
+
+        for (size_t i = 0; i < content.size(); i++)
+        {
+            if (content.at(i) == NULL || content.at(i)->GetType() != Start)
+                continue;
+
+            if (replacement)
+                return false;
+
+            replacement = content.at(i);
+        }
+
+        if (replacement == NULL)
+            return false;
+
+        removed.push_back(parent->RemoveSubNode(index));
+        parent->InsertSubNode(index, new Node(*replacement));
+        return true;
+    }
+
+    if (name == "remove")
+    {
+        if (!attribute.empty())
+        {
+            if (!element->HasAttribute(attribute))
+                return false;
+
+            element->RemoveAttribute(attribute);
+            return true;
+        }
+
+        removed.push_back(parent->RemoveSubNode(index));
+        return true;
+    }
+
+    return false;
+}
+bool                PatchDocument::AppendTimelines  (SegmentTimeline *segmentTimeline, const Node *operation, RefreshReport &report)   const
+{
+    Node node;
+    node.SetType(Start);
+    node.SetMPDPath(this->mpdPath);
+    node.SetName(this->stringPool->Intern("SegmentTimeline"));
+
+    for (size_t i = 0; i < operation->GetSubNodes().size(); i++)
+        if (operation->GetSubNodes().at(i)->GetType() == Start)
+            node.AddSubNode(new Node(*operation->GetSubNodes().at(i)));
+
+    SegmentTimeline *update = node.ToSegmentTimeline();
+
+    segmentTimeline->Append(update, report);
+
+    delete update;
+    return true;
+}
+bool                PatchDocument::SelectScope      (MPD *mpd, const std::vector<std::string> &steps, size_t stop, Scope &scope, size_t &depth) const
+{
+    std::vector<std::string>    predicates;
+    std::vector<Scope>          candidates(1);
+
+    candidates.at(0).element    = mpd;
+    candidates.at(0).name       = ElementMPD;
+
+    if (steps.at(0).substr(0, steps.at(0).find('[')) != "MPD" || !SplitPredicates(steps.at(0), predicates))
+        return false;
+
+    for (size_t i = 0; i < predicates.size(); i++)
+        if (!SelectPredicate(predicates.at(i), candidates))
+            return false;
+
+    if (candidates.size() != 1)
+        return false;
+
+    scope = candidates.at(0);
+    depth = 1;
+
+    /* the remaining steps are selected in the nodes of the scope, e.g. if they lead to an element that is not refreshed
+       separately or to several elements of the MPD */
+    while (depth < stop)
+    {
+        const std::string &step = steps.at(depth);
+
+        candidates.clear();
+        predicates.clear();
+
+        GetChildren(scope, (SchemaName) Schema::GetName(step.substr(0, step.find('['))), candidates);
+
+        if (candidates.empty() || !SplitPredicates(step, predicates))
+            break;
+
+        for (size_t i = 0; i < predicates.size(); i++)
+            if (!SelectPredicate(predicates.at(i), candidates))
+                return false;
+
+        if (candidates.size() != 1)
+            break;
+
+        scope = candidates.at(0);
+        depth++;
+    }
+
+    return true;
+}
+Node*               PatchDocument::ToNode           (const Scope &scope, NodeWriter &writer)   const
+{
+    switch (scope.name)
+    {
+        case ElementMPD:
+            return writer.ToNode(dynamic_cast<const IMPD *>(scope.element));
+        case ElementPeriod:
+            return writer.ToNode(dynamic_cast<const IPeriod *>(scope.element));
+        case ElementAdaptationSet:
+            return writer.ToNode(dynamic_cast<const IAdaptationSet *>(scope.element));
+        case ElementRepresentation:
+            return writer.ToNode(dynamic_cast<const IRepresentation *>(scope.element));
+        case ElementSegmentBase:
+            return writer.ToNode(dynamic_cast<const ISegmentBase *>(scope.element));
+        case ElementSegmentList:
+            return writer.ToNode(dynamic_cast<const ISegmentList *>(scope.element));
+        case ElementSegmentTemplate:
+            return writer.ToNode(dynamic_cast<const ISegmentTemplate *>(scope.element));
+        default:
+            return writer.ToNode(dynamic_cast<const ISegmentTimeline *>(scope.element));
+    }
+}
+void                PatchDocument::Merge            (const Scope &scope, Node *node, const NodeWriter &writer, const ParseOptions &options, RefreshReport &report)  const
+{
+    Period *period = NULL;
+
+    switch (scope.name)
+    {
+        case ElementMPD:
+            this->MergeMPD(dynamic_cast<MPD *>(scope.element), node, writer, options, report);
+            break;
+        case ElementPeriod:
+            period = node->ToPeriod();
+            FilterAdaptationSets(options, period);
+            RefreshScope(scope.element, period, report);
+            break;
+        case ElementAdaptationSet:
+            RefreshScope(scope.element, node->ToAdaptationSet(), report);
+            break;
+        case ElementRepresentation:
+            RefreshScope(scope.element, node->ToRepresentation(), report);
+            break;
+        case ElementSegmentBase:
+            RefreshScope(scope.element, node->ToSegmentBase(), report);
+            break;
+        case ElementSegmentList:
+            RefreshScope(scope.element, node->ToSegmentList(), report);
+            break;
+        case ElementSegmentTemplate:
+            RefreshScope(scope.element, node->ToSegmentTemplate(), report);
+            break;
+        default:
+            RefreshScope(scope.element, node->ToSegmentTimeline(), report);
+            break;
+    }
+}
+void                PatchDocument::MergeMPD         (MPD *mpd, Node *node, const NodeWriter &writer, const ParseOptions &options, RefreshReport &report) const
+{
+    /* the Periods are taken out, so that the update only consists of the elements RefreshHeader merges */
+    std::vector<Node *> periodNodes;
+
+    for (size_t i = 0; i < node->GetSubNodes().size();)
+    {
+        if (node->GetSubNodes().at(i) && node->GetSubNodes().at(i)->GetSchemaName() == ElementPeriod)
+            periodNodes.push_back(node->RemoveSubNode(i));
+        else
+            i++;
+    }
+
+    MPD *update = node->ToMPD();
+
+    mpd->RefreshHeader(update, report);
+
+    delete update;
+
+    /* the nodes the Periods of the MPD have been written to stand for them, all other Periods have been added */
+    std::vector<Period *> periods;
+
+    for (size_t i = 0; i < periodNodes.size(); i++)
+    {
+        Period *period = dynamic_cast<Period *>(writer.GetPeriod(periodNodes.at(i)));
+
+        if (period == NULL)
+        {
+            period = periodNodes.at(i)->ToPeriod();
+
+            if (options.filter && !options.filter->AcceptPeriod(period, periods.size()))
+            {
+                delete period;
+                period = NULL;
+            }
+            else
+            {
+                FilterAdaptationSets(options, period);
+                report.AddAddedElement(period);
+            }
+        }
+
+        if (period)
+            periods.push_back(period);
+
+        delete periodNodes.at(i);
+    }
+
+    mpd->SwapPeriods(periods);
+
+    for (size_t i = 0; i < periods.size(); i++)
+    {
+        if (std::find(mpd->GetPeriods().begin(), mpd->GetPeriods().end(), periods.at(i)) == mpd->GetPeriods().end())
+        {
+            report.AddRemovedElement();
+            delete periods.at(i);
+        }
+    }
+}
+void                PatchDocument::GetChildren      (const Scope &scope, SchemaName name, std::vector<Scope> &children)
+{
+    const IPeriod               *period             = NULL;
+    const IAdaptationSet        *adaptationSet      = NULL;
+    const IRepresentation       *representation     = NULL;
+    const IMultipleSegmentBase  *multipleSegmentBase = NULL;
+    Scope                       child;
+
+    switch (scope.name)
+    {
+        case ElementMPD:
+            for (size_t i = 0; name == ElementPeriod && i < dynamic_cast<const IMPD *>(scope.element)->GetPeriods().size(); i++)
+            {
+                child.element   = dynamic_cast<const IMPD *>(scope.element)->GetPeriods().at(i);
+                child.name      = ElementPeriod;
+                children.push_back(child);
+            }
+            break;
+        case ElementPeriod:
+            period = dynamic_cast<const IPeriod *>(scope.element);
+
+            for (size_t i = 0; name == ElementAdaptationSet && i < period->GetAdaptationSets().size(); i++)
+            {
+                child.element   = period->GetAdaptationSets().at(i);
+                child.name      = ElementAdaptationSet;
+                children.push_back(child);
+            }
+
+            GetSegmentInformation(period->GetSegmentBase(), period->GetSegmentList(), period->GetSegmentTemplate(), name, children);
+            break;
+        case ElementAdaptationSet:
+            adaptationSet = dynamic_cast<const IAdaptationSet *>(scope.element);
+
+            for (size_t i = 0; name == ElementRepresentation && i < adaptationSet->GetRepresentation().size(); i++)
+            {
+                child.element   = adaptationSet->GetRepresentation().at(i);
+                child.name      = ElementRepresentation;
+                children.push_back(child);
+            }
+
+            GetSegmentInformation(adaptationSet->GetSegmentBase(), adaptationSet->GetSegmentList(), adaptationSet->GetSegmentTemplate(), name, children);
+            break;
+        case ElementRepresentation:
+            representation = dynamic_cast<const IRepresentation *>(scope.element);
+
+            GetSegmentInformation(representation->GetSegmentBase(), representation->GetSegmentList(), representation->GetSegmentTemplate(), name, children);
+            break;
+        case ElementSegmentList:
+        case ElementSegmentTemplate:
+            multipleSegmentBase = dynamic_cast<const IMultipleSegmentBase *>(scope.element);
+
+            if (name == ElementSegmentTimeline && multipleSegmentBase->GetSegmentTimeline())
+            {
+                child.element   = (ISegmentTimeline *) multipleSegmentBase->GetSegmentTimeline();
+                child.name      = ElementSegmentTimeline;
+                children.push_back(child);
+            }
+            break;
+        default:
+            break;
+    }
+}
+void                PatchDocument::GetSegmentInformation    (const ISegmentBase *segmentBase, const ISegmentList *segmentList, const ISegmentTemplate *segmentTemplate,
+                                                             SchemaName name, std::vector<Scope> &children)
+{
+    Scope child;
+    child.element   = NULL;
+    child.name      = name;
+
+    if (name == ElementSegmentBase)
+        child.element = (ISegmentBase *) segmentBase;
+    else if (name == ElementSegmentList)
+        child.element = (ISegmentList *) segmentList;
+    else if (name == ElementSegmentTemplate)
+        child.element = (ISegmentTemplate *) segmentTemplate;
+
+    if (child.element)
+        children.push_back(child);
+}
+template <class T>
+void                PatchDocument::RefreshScope     (IMPDElement *element, T *update, RefreshReport &report)
+{
+    dynamic_cast<T *>(element)->Refresh(update, report);
+
+    delete update;
+}
+void                PatchDocument::AdoptDigests     (const NodeWriter &writer)
+{
+    for (size_t i = 0; i < writer.GetDigestCount(); i++)
+    {
+        AbstractMPDElement *element = dynamic_cast<AbstractMPDElement *>((IMPDElement *) writer.GetDigestElement(i));
+
+        if (element)
+            element->SetDigest(writer.GetDigestNode(i)->GetDigest());
+    }
+}
+void                PatchDocument::FilterAdaptationSets (const ParseOptions &options, Period *period)
+{
+    if (options.filter == NULL)
+        return;
+
+    std::vector<IAdaptationSet *> adaptationSets = period->GetAdaptationSets();
+
+    for (size_t i = 0; i < adaptationSets.size(); i++)
+    {
+        if (!DOMParser::AcceptAdaptationSet(options, period, adaptationSets.at(i)))
+            period->ReplaceAdaptationSet(dynamic_cast<AdaptationSet *>(adaptationSets.at(i)), std::vector<AdaptationSet *>());
+    }
+}
+bool                PatchDocument::IsTimeline       (const std::vector<Node *> &nodes)
+{
+    for (size_t i = 0; i < nodes.size(); i++)
+        if (nodes.at(i) == NULL || (nodes.at(i)->GetType() == Start && GetLocalName(nodes.at(i)->GetName()) != "S"))
+            return false;
+
+    return true;
+}
+bool                PatchDocument::Select           (Node *root, const std::vector<std::string> &steps, size_t depth, Selection &selection)
+{
+    std::vector<Selection> selections(1);
+
+    selections.at(0).parent = NULL;
+    selections.at(0).node   = root;
+
+    for (size_t i = depth; i < steps.size() && selections.size(); i++)
+    {
+        std::string                 name = GetLocalName(steps.at(i).substr(0, steps.at(i).find('[')));
+        std::vector<std::string>    predicates;
+        std::vector<Selection>      context;
+
+        if (!SplitPredicates(steps.at(i), predicates))
+            return false;
+
+        context.swap(selections);
+
+        for (size_t j = 0; j < context.size(); j++)
+        {
+            const std::vector<Node *>   &subNodes = context.at(j).node->GetSubNodes();
+            std::vector<Selection>      nodes;
+
+            for (size_t k = 0; k < subNodes.size(); k++)
+            {
+                if (subNodes.at(k) && subNodes.at(k)->GetType() == Start && (name == "*" || name == subNodes.at(k)->GetName()))
+                {
+                    Selection candidate;
+                    candidate.parent    = context.at(j).node;
+                    candidate.node      = subNodes.at(k);
+                    nodes.push_back(candidate);
+                }
+            }
+
+            /* positions count among the children of the same parent that passed the preceding predicates */
+            for (size_t k = 0; k < predicates.size(); k++)
+                if (!SelectPredicate(predicates.at(k), nodes))
+                    return false;
+
+            selections.insert(selections.end(), nodes.begin(), nodes.end());
+        }
+    }
+
+    if (selections.size() != 1)
+        return false;
+
+    selection = selections.at(0);
+    return true;
+}
+bool                PatchDocument::SplitSteps       (const std::string &selector, std::vector<std::string> &steps)
+{
+    if (selector.empty() || selector.at(0) != '/')
+        return false;
+
+    char    quote   = 0;
+    int     depth   = 0;
+    size_t  begin   = 1;
+
+    /* slashes inside predicates, e.g. in a quoted URL, do not separate steps */
+    for (size_t i = 1; i <= selector.size(); i++)
+    {
+        char c = i < selector.size() ? selector.at(i) : '/';
+
+        if (quote)
+        {
+            if (c == quote)
+                quote = 0;
+        }
+        else if (c == '\'' || c == '"')
+            quote = c;
+        else if (c == '[')
+            depth++;
+        else if (c == ']')
+            depth--;
+        else if (c == '/' && depth == 0)
+        {
+            if (i == begin)
+                return false;
+
+            steps.push_back(selector.substr(begin, i - begin));
+            begin = i + 1;
+        }
+    }
+
+    return quote == 0 && depth == 0 && steps.size();
+}
+bool                PatchDocument::SplitPredicates  (const std::string &step, std::vector<std::string> &predicates)
+{
+    size_t begin = step.find('[');
+
+    while (begin != std::string::npos)
+    {
+        size_t  end     = begin + 1;
+        char    quote   = 0;
+
+        for (; end < step.size() && (quote || step.at(end) != ']'); end++)
+        {
+            if (quote && step.at(end) == quote)
+                quote = 0;
+            else if (!quote && (step.at(end) == '\'' || step.at(end) == '"'))
+                quote = step.at(end);
+        }
+
+        if (end == step.size())
+            return false;
+
+        predicates.push_back(step.substr(begin + 1, end - begin - 1));
+        begin = step.find('[', end);
+    }
+
+    return true;
+}
+template <class T>
+bool                PatchDocument::SelectPredicate  (const std::string &predicate, std::vector<T> &candidates)
+{
+    std::vector<T> selection;
+
+    if (predicate.size() && predicate.at(0) == '@')
+    {
+        size_t equals = predicate.find('=');
+
+        if (equals == std::string::npos || equals + 2 >= predicate.size())
+            return false;
+
+        char quote = predicate.at(equals + 1);
+
+        if ((quote != '\'' && quote != '"') || predicate.at(predicate.size() - 1) != quote)
+            return false;
+
+        std::string name    = predicate.substr(1, equals - 1);
+        std::string value   = predicate.substr(equals + 2, predicate.size() - equals - 3);
+
+        for (size_t i = 0; i < candidates.size(); i++)
+            if (GetAttribute(candidates.at(i), name) == value)
+                selection.push_back(candidates.at(i));
+    }
+    else
+    {
+        char    *end        = NULL;
+        long    position    = strtol(predicate.c_str(), &end, 10);
+
+        if (predicate.empty() || *end != '\0')
+            return false;
+
+        if (position >= 1 && (size_t) position <= candidates.size())
+            selection.push_back(candidates.at(position - 1));
+    }
+
+    candidates.swap(selection);
+    return true;
+}
+std::string         PatchDocument::GetAttribute     (const Selection &selection, const std::string &name)
+{
+    return selection.node->GetAttributeValue(name);
+}
+std::string         PatchDocument::GetAttribute     (const Scope &scope, const std::string &name)
+{
+    for (size_t i = 0; i < scope.element->GetRawAttributeCount(); i++)
+        if (scope.element->GetRawAttributeKey(i) == name)
+            return scope.element->GetRawAttributeValue(i);
+
+    return "";
+}
+bool                PatchDocument::IsDateTimeEqual  (const std::string &time1, const std::string &time2)
+{
+    DateTime value1 = String::ToDateTime(time1);
+    DateTime value2 = String::ToDateTime(time2);
+
+    /* the same time may be written with different time zones or fractions */
+    if (value1.isValid && value2.isValid)
+        return value1.ticks == value2.ticks;
+
+    return time1 == time2;
+}
+std::string         PatchDocument::GetLocalName     (const std::string &name)
+{
+    size_t colon = name.find(':');
+
+    return colon == std::string::npos ? name : name.substr(colon + 1);
+}
+std::string         PatchDocument::GetMPDUrl        (const MPD *mpd)
+{
+    /* the parser takes the directory of the URL as the path of the nodes, the path of the MPD has no trailing slash */
+    return mpd->GetMPDPathBaseUrl() ? mpd->GetMPDPathBaseUrl()->GetUrl() + "/" : "";
+}
@@ -0,0 +1,125 @@
+/*
+ * PatchDocument.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef PATCHDOCUMENT_H_
+#define PATCHDOCUMENT_H_
+
+#include "config.h"
+
+#include "IMPD.h"
+#include "ParseOptions.h"
+#include "DOMParser.h"
+#include "Node.h"
+#include "NodeWriter.h"
+#include "../mpd/MPD.h"
+#include "../mpd/RefreshReport.h"
+#include "../helpers/String.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  An MPD Patch document, i.e. a Patch element whose add, replace and remove operations (RFC 5261) turn the MPD with
+         *  the given @id and @publishTime into its next version. Selectors are the absolute location paths the patches of
+         *  the MPD use: element steps with @attribute='value' and position predicates, and an optional @attribute as the
+         *  last step. Each selector has to match exactly one node, positions count the elements the MPD has kept.
+         *
+         *  The operations are applied to the MPD objects one by one. A selector is followed down the Periods, AdaptationSets,
+         *  Representations, segment information and SegmentTimelines as far as it goes, the deepest of these elements that
+         *  contains everything the operation changes is written back into nodes by NodeWriter. The operation is applied to
+         *  the nodes, which are converted again and merged into the element like the same element of a refreshed MPD. The
+         *  MPD itself is written without the contents of its Periods, so an operation on the MPD or on the list of Periods
+         *  only converts the Periods it adds. S elements that are appended to a SegmentTimeline are converted without the
+         *  entries the timeline already has.
+         */
+        class PatchDocument
+        {
+            public:
+                /*
+                 *  The patch is parsed into the string pool of the MPD, the elements it adds take the path of the MPD.
+                 */
+                PatchDocument           (const char *data, size_t length, const dash::mpd::MPD *mpd);
+                virtual ~PatchDocument  ();
+
+                /*
+                 *  Returns true if the patch has been parsed and refers to the given version of the MPD.
+                 */
+                bool                IsApplicableTo  (const dash::mpd::IMPD *mpd)  const;
+                const std::string&  GetPublishTime  ()  const;
+
+                /*
+                 *  Applies the operations to the MPD and sets its @publishTime to the one of the patch. False is returned as
+                 *  soon as an operation does not match the MPD, the operations before it have been applied then, so the MPD
+                 *  has to be refreshed completely. The MPD has to keep its raw attributes. Periods and AdaptationSets that
+                 *  the filter of the options rejects are left out of the elements an operation converts.
+                 */
+                bool                Apply           (dash::mpd::MPD *mpd, const ParseOptions &options, dash::mpd::RefreshReport &report) const;
+
+            private:
+                /*
+                 *  An element of the MPD that is refreshed separately, with its schema name.
+                 */
+                struct Scope
+                {
+                    dash::mpd::IMPDElement  *element;
+                    SchemaName              name;
+                };
+
+                /*
+                 *  An element node with the node it is a sub node of, which is NULL for the root of the tree.
+                 */
+                struct Selection
+                {
+                    Node    *parent;
+                    Node    *node;
+                };
+
+                bool    ApplyOperation  (dash::mpd::MPD *mpd, const Node *operation, const ParseOptions &options, dash::mpd::RefreshReport &report)  const;
+                bool    Modify          (const Selection &target, const Node *operation, const std::string &name, const std::string &attribute,
+                                         std::vector<Node *> &removed)  const;
+                bool    AppendTimelines (dash::mpd::SegmentTimeline *segmentTimeline, const Node *operation, dash::mpd::RefreshReport &report)  const;
+                bool    SelectScope     (dash::mpd::MPD *mpd, const std::vector<std::string> &steps, size_t stop, Scope &scope, size_t &depth)  const;
+                Node*   ToNode          (const Scope &scope, NodeWriter &writer)  const;
+                void    Merge           (const Scope &scope, Node *node, const NodeWriter &writer, const ParseOptions &options, dash::mpd::RefreshReport &report)  const;
+                void    MergeMPD        (dash::mpd::MPD *mpd, Node *node, const NodeWriter &writer, const ParseOptions &options, dash::mpd::RefreshReport &report)  const;
+
+                static void         GetChildren             (const Scope &scope, SchemaName name, std::vector<Scope> &children);
+                static void         GetSegmentInformation   (const dash::mpd::ISegmentBase *segmentBase, const dash::mpd::ISegmentList *segmentList,
+                                                             const dash::mpd::ISegmentTemplate *segmentTemplate, SchemaName name, std::vector<Scope> &children);
+                template <class T>
+                static void         RefreshScope            (dash::mpd::IMPDElement *element, T *update, dash::mpd::RefreshReport &report);
+                static void         AdoptDigests            (const NodeWriter &writer);
+                static void         FilterAdaptationSets    (const ParseOptions &options, dash::mpd::Period *period);
+                static bool         IsTimeline              (const std::vector<Node *> &nodes);
+                static bool         Select                  (Node *root, const std::vector<std::string> &steps, size_t depth, Selection &selection);
+                static bool         SplitSteps              (const std::string &selector, std::vector<std::string> &steps);
+                static bool         SplitPredicates         (const std::string &step, std::vector<std::string> &predicates);
+                template <class T>
+                static bool         SelectPredicate         (const std::string &predicate, std::vector<T> &candidates);
+                static std::string  GetAttribute            (const Selection &selection, const std::string &name);
+                static std::string  GetAttribute            (const Scope &scope, const std::string &name);
+                static bool         IsDateTimeEqual         (const std::string &time1, const std::string &time2);
+                static std::string  GetLocalName            (const std::string &name);
+                static std::string  GetMPDUrl               (const dash::mpd::MPD *mpd);
+
+                DOMParser               parser;
+                helpers::StringPool     *stringPool;
+                helpers::InternedString mpdPath;
+                const Node              *root;
+                std::string             mpdId;
+                std::string             originalPublishTime;
+                std::string             publishTime;
+        };
+    }
+}
+
+#endif /* PATCHDOCUMENT_H_ */
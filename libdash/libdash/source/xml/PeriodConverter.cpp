@@ -0,0 +1,125 @@
+/*
+ * PeriodConverter.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "PeriodConverter.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+
+PeriodConverter::PeriodConverter    (size_t threads, IMPDBuildObserver *observer, IMPD *mpd) :
+                 observer           (observer),
+                 mpd                (mpd),
+                 takenPeriods       (0),
+                 maxQueuedNodes     (2 * threads),
+                 isFinished         (false)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+    InitializeConditionVariable(&this->nodeAvailable);
+    InitializeConditionVariable(&this->spaceAvailable);
+
+    for (size_t i = 0; i < threads; i++)
+    {
+        THREAD_HANDLE thread = CreateThreadPortable(Convert, this);
+
+        if (thread == NULL)
+            break;
+
+        this->threads.push_back(thread);
+    }
+}
+PeriodConverter::~PeriodConverter   ()
+{
+    this->Finish();
+
+    for (size_t i = this->takenPeriods; i < this->periods.size(); i++)
+        delete this->periods.at(i);
+
+    DeleteConditionVariable(&this->spaceAvailable);
+    DeleteConditionVariable(&this->nodeAvailable);
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+void                            PeriodConverter::Add            (Node *node)
+{
+    if (this->threads.empty())
+    {
+        this->periods.push_back(node->ToPeriod(this->observer, this->mpd));
+        delete node;
+        return;
+    }
+
+    EnterCriticalSection(&this->monitorMutex);
+
+    while (this->nodes.size() >= this->maxQueuedNodes)
+        SleepConditionVariableCS(&this->spaceAvailable, &this->monitorMutex, INFINITE);
+
+    this->nodes.push_back(std::make_pair(this->periods.size(), node));
+    this->periods.push_back(NULL);
+
+    WakeConditionVariable(&this->nodeAvailable);
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void                            PeriodConverter::TakeConverted  (std::vector<Period *> &periods)
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    while (this->takenPeriods < this->periods.size() && this->periods.at(this->takenPeriods) != NULL)
+        periods.push_back(this->periods.at(this->takenPeriods++));
+
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void                            PeriodConverter::Finish         ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->isFinished = true;
+    WakeAllConditionVariable(&this->nodeAvailable);
+    LeaveCriticalSection(&this->monitorMutex);
+
+    for (size_t i = 0; i < this->threads.size(); i++)
+    {
+        JoinThread(this->threads.at(i));
+        DestroyThreadPortable(this->threads.at(i));
+    }
+
+    this->threads.clear();
+}
+void*                           PeriodConverter::Convert        (void *periodConverter)
+{
+    PeriodConverter *converter = (PeriodConverter *) periodConverter;
+
+    EnterCriticalSection(&converter->monitorMutex);
+
+    while (true)
+    {
+        while (converter->nodes.empty() && !converter->isFinished)
+            SleepConditionVariableCS(&converter->nodeAvailable, &converter->monitorMutex, INFINITE);
+
+        if (converter->nodes.empty())
+            break;
+
+        std::pair<size_t, Node *> entry = converter->nodes.front();
+        converter->nodes.pop_front();
+
+        WakeConditionVariable(&converter->spaceAvailable);
+        LeaveCriticalSection(&converter->monitorMutex);
+
+        /* the string pool and the arena synchronize the allocations of the workers themselves */
+        Period *period = entry.second->ToPeriod(converter->observer, converter->mpd);
+        delete entry.second;
+
+        EnterCriticalSection(&converter->monitorMutex);
+        converter->periods.at(entry.first) = period;
+    }
+
+    LeaveCriticalSection(&converter->monitorMutex);
+
+    return NULL;
+}
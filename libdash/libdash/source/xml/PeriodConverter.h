@@ -0,0 +1,62 @@
+/*
+ * PeriodConverter.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef PERIODCONVERTER_H_
+#define PERIODCONVERTER_H_
+
+#include "config.h"
+
+#include "Node.h"
+#include "../mpd/Period.h"
+#include "../portable/MultiThreading.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Converts Period nodes into dash::mpd::Period objects on a fixed number of worker threads while the parser
+         *  reads the following Periods. Only a few nodes per thread are queued, Add blocks until a worker has taken one,
+         *  so the node trees of a large manifest are never held at once. TakeConverted hands out the Periods in the order
+         *  their nodes have been added, as soon as they and all previous ones are converted; after Finish all of them are.
+         *  Periods that have not been taken are deleted with the converter. If no thread can be started the nodes are
+         *  converted by Add itself. The observer is informed about each AdaptationSet on the thread that converts its Period,
+         *  before the Period can be taken.
+         */
+        class PeriodConverter
+        {
+            public:
+                PeriodConverter             (size_t threads, IMPDBuildObserver *observer, dash::mpd::IMPD *mpd);
+                virtual ~PeriodConverter    ();
+
+                void    Add             (Node *node);
+                void    TakeConverted   (std::vector<dash::mpd::Period *> &periods);
+                void    Finish          ();
+
+            private:
+                static void*    Convert (void *converter);
+
+                IMPDBuildObserver                       *observer;
+                dash::mpd::IMPD                         *mpd;
+                std::deque<std::pair<size_t, Node *> >  nodes;
+                std::vector<dash::mpd::Period *>        periods;
+                size_t                                  takenPeriods;
+                std::vector<THREAD_HANDLE>              threads;
+                size_t                                  maxQueuedNodes;
+                bool                                    isFinished;
+                CRITICAL_SECTION                        monitorMutex;
+                CONDITION_VARIABLE                      nodeAvailable;
+                CONDITION_VARIABLE                      spaceAvailable;
+        };
+    }
+}
+
+#endif /* PERIODCONVERTER_H_ */
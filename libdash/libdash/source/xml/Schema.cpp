@@ -0,0 +1,159 @@
+/*
+ * Schema.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "Schema.h"
+
+#include <cstring>
+
+using namespace dash::xml;
+
+struct SchemaEntry
+{
+    const char  *string;
+    SchemaName  name;
+};
+
+/* sorted by strcmp, upper case letters come first */
+static const SchemaEntry schemaEntries[] =
+{
+    { "Accessibility",              ElementAccessibility },
+    { "AdaptationSet",              ElementAdaptationSet },
+    { "AudioChannelConfiguration",  ElementAudioChannelConfiguration },
+    { "BaseURL",                    ElementBaseURL },
+    { "BitstreamSwitching",         ElementBitstreamSwitching },
+    { "ContentComponent",           ElementContentComponent },
+    { "ContentProtection",          ElementContentProtection },
+    { "Copyright",                  ElementCopyright },
+    { "FramePacking",               ElementFramePacking },
+    { "Initialization",             ElementInitialization },
+    { "Location",                   ElementLocation },
+    { "MPD",                        ElementMPD },
+    { "Metrics",                    ElementMetrics },
+    { "PatchLocation",              ElementPatchLocation },
+    { "Period",                     ElementPeriod },
+    { "ProgramInformation",         ElementProgramInformation },
+    { "Range",                      ElementRange },
+    { "Rating",                     ElementRating },
+    { "Reporting",                  ElementReporting },
+    { "Representation",             ElementRepresentation },
+    { "RepresentationIndex",        ElementRepresentationIndex },
+    { "Role",                       ElementRole },
+    { "S",                          ElementS },
+    { "SegmentBase",                ElementSegmentBase },
+    { "SegmentList",                ElementSegmentList },
+    { "SegmentTemplate",            ElementSegmentTemplate },
+    { "SegmentTimeline",            ElementSegmentTimeline },
+    { "SegmentURL",                 ElementSegmentURL },
+    { "Source",                     ElementSource },
+    { "SubRepresentation",          ElementSubRepresentation },
+    { "Subset",                     ElementSubset },
+    { "Title",                      ElementTitle },
+    { "Viewpoint",                  ElementViewpoint },
+    { "audioSamplingRate",          AttributeAudioSamplingRate },
+    { "availabilityEndTime",        AttributeAvailabilityEndTime },
+    { "availabilityStartTime",      AttributeAvailabilityStartTime },
+    { "bandwidth",                  AttributeBandwidth },
+    { "bitstreamSwitching",         AttributeBitstreamSwitching },
+    { "byteRange",                  AttributeByteRange },
+    { "codecs",                     AttributeCodecs },
+    { "codingDependency",           AttributeCodingDependency },
+    { "contains",                   AttributeContains },
+    { "contentComponent",           AttributeContentComponent },
+    { "contentType",                AttributeContentType },
+    { "d",                          AttributeD },
+    { "dependencyId",               AttributeDependencyId },
+    { "dependencyLevel",            AttributeDependencyLevel },
+    { "duration",                   AttributeDuration },
+    { "frameRate",                  AttributeFrameRate },
+    { "group",                      AttributeGroup },
+    { "height",                     AttributeHeight },
+    { "id",                         AttributeId },
+    { "index",                      AttributeIndex },
+    { "indexRange",                 AttributeIndexRange },
+    { "indexRangeExact",            AttributeIndexRangeExact },
+    { "initialization",             AttributeInitialization },
+    { "lang",                       AttributeLang },
+    { "level",                      AttributeLevel },
+    { "maxBandwidth",               AttributeMaxBandwidth },
+    { "maxFrameRate",               AttributeMaxFrameRate },
+    { "maxHeight",                  AttributeMaxHeight },
+    { "maxPlayoutRate",             AttributeMaxPlayoutRate },
+    { "maxSegmentDuration",         AttributeMaxSegmentDuration },
+    { "maxSubsegmentDuration",      AttributeMaxSubsegmentDuration },
+    { "maxWidth",                   AttributeMaxWidth },
+    { "maximumSAPPeriod",           AttributeMaximumSAPPeriod },
+    { "media",                      AttributeMedia },
+    { "mediaPresentationDuration",  AttributeMediaPresentationDuration },
+    { "mediaRange",                 AttributeMediaRange },
+    { "mediaStreamStructureId",     AttributeMediaStreamStructureId },
+    { "metrics",                    AttributeMetrics },
+    { "mimeType",                   AttributeMimeType },
+    { "minBandwidth",               AttributeMinBandwidth },
+    { "minBufferTime",              AttributeMinBufferTime },
+    { "minFrameRate",               AttributeMinFrameRate },
+    { "minHeight",                  AttributeMinHeight },
+    { "minWidth",                   AttributeMinWidth },
+    { "minimumUpdatePeriod",        AttributeMinimumUpdatePeriod },
+    { "moreInformationURL",         AttributeMoreInformationURL },
+    { "par",                        AttributePar },
+    { "presentationTimeOffset",     AttributePresentationTimeOffset },
+    { "profiles",                   AttributeProfiles },
+    { "publishTime",                AttributePublishTime },
+    { "qualityRanking",             AttributeQualityRanking },
+    { "r",                          AttributeR },
+    { "range",                      AttributeRange },
+    { "sar",                        AttributeSar },
+    { "scanType",                   AttributeScanType },
+    { "schemeIdUri",                AttributeSchemeIdUri },
+    { "segmentAlignment",           AttributeSegmentAlignment },
+    { "segmentProfiles",            AttributeSegmentProfiles },
+    { "serviceLocation",            AttributeServiceLocation },
+    { "sourceURL",                  AttributeSourceURL },
+    { "start",                      AttributeStart },
+    { "startNumber",                AttributeStartNumber },
+    { "startWithSAP",               AttributeStartWithSAP },
+    { "starttime",                  AttributeStarttime },
+    { "subsegmentAlignment",        AttributeSubsegmentAlignment },
+    { "subsegmentStartsWithSAP",    AttributeSubsegmentStartsWithSAP },
+    { "suggestedPresentationDelay", AttributeSuggestedPresentationDelay },
+    { "t",                          AttributeT },
+    { "timeShiftBufferDepth",       AttributeTimeShiftBufferDepth },
+    { "timescale",                  AttributeTimescale },
+    { "ttl",                        AttributeTtl },
+    { "type",                       AttributeType },
+    { "value",                      AttributeValue },
+    { "width",                      AttributeWidth },
+    { "xlink:actuate",              AttributeXlinkActuate },
+    { "xlink:href",                 AttributeXlinkHref }
+};
+
+static const size_t schemaEntryCount = sizeof(schemaEntries) / sizeof(schemaEntries[0]);
+
+int Schema::GetName (const std::string &name)
+{
+    size_t first = 0;
+    size_t last  = schemaEntryCount;
+
+    while (first < last)
+    {
+        size_t  middle  = (first + last) / 2;
+        int     result  = strcmp(schemaEntries[middle].string, name.c_str());
+
+        if (result == 0)
+            return schemaEntries[middle].name;
+
+        if (result < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+    return UnknownName;
+}
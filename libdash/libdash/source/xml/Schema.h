@@ -0,0 +1,153 @@
+/*
+ * Schema.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SCHEMA_H_
+#define SCHEMA_H_
+
+#include "config.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Every element and attribute name that is converted into an MPD object. Names that are not listed here are
+         *  UnknownName and only end up in the additional sub nodes or raw attributes.
+         */
+        enum SchemaName
+        {
+            UnknownName = 0,
+
+            ElementAccessibility,
+            ElementAdaptationSet,
+            ElementAudioChannelConfiguration,
+            ElementBaseURL,
+            ElementBitstreamSwitching,
+            ElementContentComponent,
+            ElementContentProtection,
+            ElementCopyright,
+            ElementFramePacking,
+            ElementInitialization,
+            ElementLocation,
+            ElementMPD,
+            ElementMetrics,
+            ElementPatchLocation,
+            ElementPeriod,
+            ElementProgramInformation,
+            ElementRange,
+            ElementRating,
+            ElementReporting,
+            ElementRepresentation,
+            ElementRepresentationIndex,
+            ElementRole,
+            ElementS,
+            ElementSegmentBase,
+            ElementSegmentList,
+            ElementSegmentTemplate,
+            ElementSegmentTimeline,
+            ElementSegmentURL,
+            ElementSource,
+            ElementSubRepresentation,
+            ElementSubset,
+            ElementTitle,
+            ElementViewpoint,
+
+            AttributeAudioSamplingRate,
+            AttributeAvailabilityEndTime,
+            AttributeAvailabilityStartTime,
+            AttributeBandwidth,
+            AttributeBitstreamSwitching,
+            AttributeByteRange,
+            AttributeCodecs,
+            AttributeCodingDependency,
+            AttributeContains,
+            AttributeContentComponent,
+            AttributeContentType,
+            AttributeD,
+            AttributeDependencyId,
+            AttributeDependencyLevel,
+            AttributeDuration,
+            AttributeFrameRate,
+            AttributeGroup,
+            AttributeHeight,
+            AttributeId,
+            AttributeIndex,
+            AttributeIndexRange,
+            AttributeIndexRangeExact,
+            AttributeInitialization,
+            AttributeLang,
+            AttributeLevel,
+            AttributeMaxBandwidth,
+            AttributeMaxFrameRate,
+            AttributeMaxHeight,
+            AttributeMaxPlayoutRate,
+            AttributeMaxSegmentDuration,
+            AttributeMaxSubsegmentDuration,
+            AttributeMaxWidth,
+            AttributeMaximumSAPPeriod,
+            AttributeMedia,
+            AttributeMediaPresentationDuration,
+            AttributeMediaRange,
+            AttributeMediaStreamStructureId,
+            AttributeMetrics,
+            AttributeMimeType,
+            AttributeMinBandwidth,
+            AttributeMinBufferTime,
+            AttributeMinFrameRate,
+            AttributeMinHeight,
+            AttributeMinWidth,
+            AttributeMinimumUpdatePeriod,
+            AttributeMoreInformationURL,
+            AttributePar,
+            AttributePresentationTimeOffset,
+            AttributeProfiles,
+            AttributePublishTime,
+            AttributeQualityRanking,
+            AttributeR,
+            AttributeRange,
+            AttributeSar,
+            AttributeScanType,
+            AttributeSchemeIdUri,
+            AttributeSegmentAlignment,
+            AttributeSegmentProfiles,
+            AttributeServiceLocation,
+            AttributeSourceURL,
+            AttributeStart,
+            AttributeStartNumber,
+            AttributeStartWithSAP,
+            AttributeStarttime,
+            AttributeSubsegmentAlignment,
+            AttributeSubsegmentStartsWithSAP,
+            AttributeSuggestedPresentationDelay,
+            AttributeT,
+            AttributeTimeShiftBufferDepth,
+            AttributeTimescale,
+            AttributeTtl,
+            AttributeType,
+            AttributeValue,
+            AttributeWidth,
+            AttributeXlinkActuate,
+            AttributeXlinkHref
+        };
+
+        class Schema
+        {
+            public:
+                /*
+                 *  Looks the name up in a table sorted by strcmp. The string pool of the parser calls this only once for every
+                 *  distinct string, the conversion then switches on the stored id.
+                 */
+                static int  GetName (const std::string &name);
+        };
+    }
+}
+
+#endif /* SCHEMA_H_ */
@@ -0,0 +1,64 @@
+/*
+ * Snapshot.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+#include "config.h"
+
+#define SNAPSHOT_MAGIC          "LIBDASHS"
+#define SNAPSHOT_VERSION        2
+#define SNAPSHOT_BYTE_ORDER     0x01020304
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Layout of a snapshot file: the header is followed by the string table, which consists of stringCount + 1
+         *  offsets into the string data and the NUL terminated strings themselves, and by the records. The records are
+         *  a stream of 32 bit words that describe the elements of the MPD in document order. Strings are referenced by
+         *  their index into the string table. All values are stored in the byte order of the machine that wrote the
+         *  snapshot, a snapshot of another byte order is rejected.
+         *
+         *  Element     SnapshotElement, name, attribute count, key and value of each attribute
+         *  Text        SnapshotText, text
+         *  Digest      SnapshotDigest, lower and upper 32 bits of the digest of the preceding element
+         *  End         SnapshotEnd, closes the last element that has been opened
+         */
+        enum SnapshotRecord
+        {
+            SnapshotElement = 1,
+            SnapshotText    = 2,
+            SnapshotEnd     = 3,
+            SnapshotDigest  = 4
+        };
+
+        struct SnapshotHeader
+        {
+            char        magic[8];
+            uint32_t    version;
+            uint32_t    byteOrder;
+            uint32_t    stringCount;
+            uint32_t    mpdPath;        /* string index of the path that relative BaseURLs are resolved against */
+            uint32_t    fetchTime;
+            uint32_t    eTag;           /* string indices of the HTTP validators of the MPD, empty if it has not been fetched over HTTP */
+            uint32_t    lastModified;
+            uint32_t    reserved;
+            uint64_t    stringOffsets;  /* file offsets of the string table, the string data and the records */
+            uint64_t    stringData;
+            uint64_t    records;
+            uint64_t    recordCount;    /* number of 32 bit words */
+        };
+    }
+}
+
+#endif /* SNAPSHOT_H_ */
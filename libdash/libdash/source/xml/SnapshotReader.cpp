@@ -0,0 +1,367 @@
+/*
+ * SnapshotReader.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "SnapshotReader.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+using namespace dash::helpers;
+
+SnapshotReader::SnapshotReader  (const std::string &path) :
+                path            (path),
+                isMapped        (false),
+                header          (NULL),
+                stringOffsets   (NULL),
+                stringData      (NULL),
+                records         (NULL),
+                position        (0),
+                arena           (NULL)
+{
+    this->stringPool = new StringPool(Schema::GetName);
+}
+SnapshotReader::~SnapshotReader ()
+{
+    this->Close();
+
+    this->strings.clear();
+    this->stringPool->Release();
+
+    if (this->arena)
+        this->arena->Release();
+}
+
+MPD*    SnapshotReader::BuildMPD            ()
+{
+    uint32_t record = 0;
+
+    if (!this->Open() || !this->ReadWord(record) || record != SnapshotElement)
+        return NULL;
+
+    Node *header = this->ReadElementHeader();
+
+    if (header == NULL || header->GetSchemaName() != ElementMPD)
+    {
+        delete header;
+        return NULL;
+    }
+
+    MPD *mpd = header->ToMPD();
+    mpd->SetStringPool(this->stringPool);
+    mpd->SetFetchTime(this->header->fetchTime);
+    delete header;
+
+    InternedString eTag;
+    InternedString lastModified;
+
+    if (!this->GetString(this->header->eTag, eTag) || !this->GetString(this->header->lastModified, lastModified))
+    {
+        delete mpd;
+        return NULL;
+    }
+
+    mpd->SetETag(eTag.Get());
+    mpd->SetLastModified(lastModified.Get());
+
+    bool isValid = true;
+
+    while (isValid)
+    {
+        if (!this->ReadWord(record))
+        {
+            isValid = false;
+            break;
+        }
+
+        if (record == SnapshotEnd)
+            break;
+
+        if (record == SnapshotDigest)
+        {
+            isValid = this->ReadDigest();
+            continue;
+        }
+
+        /* the Periods are converted one by one, so only the nodes of a single Period are held at once */
+        Node *node = this->ReadNode(record, 1);
+
+        if (node == NULL)
+        {
+            isValid = false;
+            break;
+        }
+
+        if (node->AppendToMPD(mpd))
+            delete node;
+        else
+            mpd->AddAdditionalSubNode(node);
+    }
+
+    if (!isValid || this->position != this->header->recordCount || !this->ApplyDigests(mpd))
+    {
+        delete mpd;
+        return NULL;
+    }
+
+    this->Close();
+    return mpd;
+}
+void    SnapshotReader::SetArena            (Arena *arena)
+{
+    if (arena)
+        arena->Retain();
+
+    if (this->arena)
+        this->arena->Release();
+
+    this->arena = arena;
+}
+bool    SnapshotReader::Open                ()
+{
+    this->Close();
+
+    if (!MapFilePortable(this->path.c_str(), &this->file))
+        return false;
+
+    this->isMapped = true;
+
+    const char  *data   = this->file.data;
+    uint64_t    size    = this->file.size;
+
+    if (size < sizeof(SnapshotHeader))
+        return false;
+
+    /* the mapping starts at a page boundary, so the header and the aligned tables can be accessed in place */
+    this->header = (const SnapshotHeader *) data;
+
+    if (memcmp(this->header->magic, SNAPSHOT_MAGIC, sizeof(this->header->magic)) ||
+        this->header->version != SNAPSHOT_VERSION || this->header->byteOrder != SNAPSHOT_BYTE_ORDER)
+        return false;
+
+    uint64_t offsetsSize = ((uint64_t) this->header->stringCount + 1) * sizeof(uint32_t);
+
+    if (this->header->stringOffsets % sizeof(uint32_t) || this->header->stringOffsets > size ||
+        offsetsSize > size - this->header->stringOffsets)
+        return false;
+
+    this->stringOffsets = (const uint32_t *) (data + this->header->stringOffsets);
+
+    if (this->header->stringData > size || this->stringOffsets[this->header->stringCount] > size - this->header->stringData)
+        return false;
+
+    this->stringData = data + this->header->stringData;
+
+    if (this->header->records % sizeof(uint32_t) || this->header->records > size ||
+        this->header->recordCount > (size - this->header->records) / sizeof(uint32_t))
+        return false;
+
+    this->records = (const uint32_t *) (data + this->header->records);
+
+    this->strings.assign(this->header->stringCount, InternedString());
+    this->isInterned.assign(this->header->stringCount, false);
+
+    return this->GetString(this->header->mpdPath, this->mpdPath);
+}
+void    SnapshotReader::Close               ()
+{
+    if (this->isMapped)
+        UnmapFilePortable(&this->file);
+
+    this->isMapped      = false;
+    this->header        = NULL;
+    this->stringOffsets = NULL;
+    this->stringData    = NULL;
+    this->records       = NULL;
+    this->position      = 0;
+}
+bool    SnapshotReader::ReadWord            (uint32_t &word)
+{
+    if (this->position >= this->header->recordCount)
+        return false;
+
+    word = this->records[this->position++];
+    return true;
+}
+bool    SnapshotReader::ReadString          (InternedString &string)
+{
+    uint32_t index = 0;
+
+    return this->ReadWord(index) && this->GetString(index, string);
+}
+bool    SnapshotReader::GetString           (uint32_t index, InternedString &string)
+{
+    if (index >= this->header->stringCount)
+        return false;
+
+    /* every distinct string is interned once, the following references only copy the handle */
+    if (!this->isInterned.at(index))
+    {
+        uint32_t first  = this->stringOffsets[index];
+        uint32_t last   = this->stringOffsets[index + 1];
+
+        if (first >= last || last > this->stringOffsets[this->header->stringCount] || this->stringData[last - 1] != '\0')
+            return false;
+
+        this->strings.at(index)     = this->stringPool->Intern(std::string(this->stringData + first, last - first - 1));
+        this->isInterned.at(index)  = true;
+    }
+
+    string = this->strings.at(index);
+    return true;
+}
+Node*   SnapshotReader::ReadElementHeader   ()
+{
+    InternedString  name;
+    uint32_t        attributeCount = 0;
+
+    if (!this->ReadString(name) || !this->ReadWord(attributeCount))
+        return NULL;
+
+    Node *node = new Node();
+    node->SetType(Start);
+    node->SetMPDPath(this->mpdPath);
+    node->SetArena(this->arena);
+    node->SetName(name);
+
+    for (uint32_t i = 0; i < attributeCount; i++)
+    {
+        InternedString key;
+        InternedString value;
+
+        if (!this->ReadString(key) || !this->ReadString(value))
+        {
+            delete node;
+            return NULL;
+        }
+
+        node->AddAttribute(key, value);
+    }
+
+    return node;
+}
+Node*   SnapshotReader::ReadNode            (uint32_t record, int depth)
+{
+    if (depth > MaxDepth)
+        return NULL;
+
+    if (record == SnapshotText)
+    {
+        InternedString text;
+
+        if (!this->ReadString(text))
+            return NULL;
+
+        Node *node = new Node();
+        node->SetType(Text);
+        node->SetText(text);
+        return node;
+    }
+
+    if (record != SnapshotElement)
+        return NULL;
+
+    Node *node = this->ReadElementHeader();
+
+    if (node == NULL)
+        return NULL;
+
+    while (this->ReadWord(record))
+    {
+        if (record == SnapshotEnd)
+            return node;
+
+        if (record == SnapshotDigest)
+        {
+            if (!this->ReadDigest())
+                break;
+            continue;
+        }
+
+        Node *subnode = this->ReadNode(record, depth + 1);
+
+        if (subnode == NULL)
+            break;
+
+        node->AddSubNode(subnode);
+    }
+
+    delete node;
+    return NULL;
+}
+bool    SnapshotReader::ReadDigest          ()
+{
+    uint32_t lower = 0;
+    uint32_t upper = 0;
+
+    if (!this->ReadWord(lower) || !this->ReadWord(upper))
+        return false;
+
+    this->digests.push_back(((uint64_t) upper << 32) | lower);
+    return true;
+}
+bool    SnapshotReader::ApplyDigests        (MPD *mpd)
+{
+    /* the digests are stored in the order SnapshotWriter visits the elements, which is the order of the objects */
+    if (!this->ApplyDigest(mpd))
+        return false;
+
+    for (size_t i = 0; i < mpd->GetPeriods().size(); i++)
+    {
+        IPeriod *period = mpd->GetPeriods().at(i);
+
+        if (!this->ApplyDigest(period) ||
+            !this->ApplyDigests(period->GetSegmentBase(), period->GetSegmentList(), period->GetSegmentTemplate()))
+            return false;
+
+        for (size_t j = 0; j < period->GetAdaptationSets().size(); j++)
+        {
+            IAdaptationSet *adaptationSet = period->GetAdaptationSets().at(j);
+
+            if (!this->ApplyDigest(adaptationSet) ||
+                !this->ApplyDigests(adaptationSet->GetSegmentBase(), adaptationSet->GetSegmentList(), adaptationSet->GetSegmentTemplate()))
+                return false;
+
+            for (size_t k = 0; k < adaptationSet->GetRepresentation().size(); k++)
+            {
+                IRepresentation *representation = adaptationSet->GetRepresentation().at(k);
+
+                if (!this->ApplyDigest(representation) ||
+                    !this->ApplyDigests(representation->GetSegmentBase(), representation->GetSegmentList(), representation->GetSegmentTemplate()))
+                    return false;
+            }
+        }
+    }
+
+    return this->digests.empty();
+}
+bool    SnapshotReader::ApplyDigests        (ISegmentBase *segmentBase, ISegmentList *segmentList, ISegmentTemplate *segmentTemplate)
+{
+    if (segmentBase && !this->ApplyDigest(segmentBase))
+        return false;
+
+    if (segmentList && !this->ApplyDigest(segmentList))
+        return false;
+
+    if (segmentTemplate && !this->ApplyDigest(segmentTemplate))
+        return false;
+
+    return true;
+}
+bool    SnapshotReader::ApplyDigest         (IMPDElement *element)
+{
+    AbstractMPDElement *abstractElement = dynamic_cast<AbstractMPDElement *>(element);
+
+    if (abstractElement == NULL || this->digests.empty())
+        return false;
+
+    abstractElement->SetDigest(this->digests.front());
+    this->digests.pop_front();
+    return true;
+}
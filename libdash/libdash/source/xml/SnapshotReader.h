@@ -0,0 +1,81 @@
+/*
+ * SnapshotReader.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SNAPSHOTREADER_H_
+#define SNAPSHOTREADER_H_
+
+#include "config.h"
+
+#include "Snapshot.h"
+#include "Node.h"
+#include "DOMParser.h"
+#include "../helpers/StringPool.h"
+#include "../helpers/Arena.h"
+#include "../portable/MemoryMapping.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Loads an MPD from a snapshot written by SnapshotWriter. The file is mapped into memory and the records are
+         *  turned into nodes that are converted like the ones of DOMParser, one element below the MPD at a time.
+         *  Every offset and string index is checked against the size of the file, BuildMPD returns NULL for a
+         *  snapshot that is truncated, malformed or has been written by another version.
+         */
+        class SnapshotReader
+        {
+            public:
+                SnapshotReader          (const std::string &path);
+                virtual ~SnapshotReader ();
+
+                dash::mpd::MPD* BuildMPD    ();
+
+                /*
+                 *  Places the MPD elements into the given arena, see DOMParser::SetArena.
+                 */
+                void            SetArena    (helpers::Arena *arena);
+
+            private:
+                static const int MaxDepth = 256;
+
+                bool    Open                ();
+                void    Close               ();
+                bool    ReadWord            (uint32_t &word);
+                bool    ReadString          (helpers::InternedString &string);
+                bool    GetString           (uint32_t index, helpers::InternedString &string);
+                Node*   ReadElementHeader   ();
+                Node*   ReadNode            (uint32_t record, int depth);
+                bool    ReadDigest          ();
+                bool    ApplyDigests        (dash::mpd::MPD *mpd);
+                bool    ApplyDigests        (dash::mpd::ISegmentBase *segmentBase, dash::mpd::ISegmentList *segmentList,
+                                             dash::mpd::ISegmentTemplate *segmentTemplate);
+                bool    ApplyDigest         (dash::mpd::IMPDElement *element);
+
+                std::string                             path;
+                mapped_file_t                           file;
+                bool                                    isMapped;
+                const SnapshotHeader                    *header;
+                const uint32_t                          *stringOffsets;
+                const char                              *stringData;
+                const uint32_t                          *records;
+                uint64_t                                position;
+                std::vector<helpers::InternedString>    strings;
+                std::vector<bool>                       isInterned;
+                std::deque<uint64_t>                    digests;
+                helpers::StringPool                     *stringPool;
+                helpers::InternedString                 mpdPath;
+                helpers::Arena                          *arena;
+        };
+    }
+}
+
+#endif /* SNAPSHOTREADER_H_ */
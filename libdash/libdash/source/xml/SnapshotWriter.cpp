@@ -0,0 +1,197 @@
+/*
+ * SnapshotWriter.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "SnapshotWriter.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+
+SnapshotWriter::SnapshotWriter  ()
+{
+}
+SnapshotWriter::~SnapshotWriter ()
+{
+}
+
+bool        SnapshotWriter::Write                   (const IMPD *mpd, const char *path)
+{
+    if (mpd == NULL || path == NULL)
+        return false;
+
+    /* the elements are written from their raw attributes, an MPD that has been parsed without them would lose all attributes */
+    const MPD *parsedMPD = dynamic_cast<const MPD *>(mpd);
+
+    if (parsedMPD && !parsedMPD->AreRawAttributesRetained())
+        return false;
+
+    this->stringIndices.clear();
+    this->strings.clear();
+    this->records.clear();
+
+    this->WriteMPD(mpd);
+
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL)
+        return false;
+
+    bool written = this->WriteFile(mpd, file);
+
+    if (fclose(file) != 0)
+        written = false;
+
+    /* a partially written snapshot would be rejected by the reader anyway, but it must not take up the cache entry */
+    if (!written)
+        remove(path);
+
+    return written;
+}
+void        SnapshotWriter::WriteNode               (const INode *node)
+{
+    if (node->GetType() == Text)
+    {
+        this->WriteText(node->GetText());
+        return;
+    }
+
+    this->records.push_back(SnapshotElement);
+    this->records.push_back(this->AddString(node->GetName()));
+    this->records.push_back((uint32_t) node->GetAttributeCount());
+
+    for (size_t i = 0; i < node->GetAttributeCount(); i++)
+    {
+        this->records.push_back(this->AddString(node->GetAttributeKey(i)));
+        this->records.push_back(this->AddString(node->GetAttributeValue(i)));
+    }
+
+    for (size_t i = 0; i < node->GetNodes().size(); i++)
+        if (node->GetNodes().at(i))
+            this->WriteNode(node->GetNodes().at(i));
+
+    this->records.push_back(SnapshotEnd);
+}
+void        SnapshotWriter::BeginElement            (const std::string &name, const std::map<std::string, std::string> &attributes)
+{
+    this->records.push_back(SnapshotElement);
+    this->records.push_back(this->AddString(name));
+    this->records.push_back((uint32_t) attributes.size());
+
+    for (std::map<std::string, std::string>::const_iterator it = attributes.begin(); it != attributes.end(); ++it)
+    {
+        this->records.push_back(this->AddString(it->first));
+        this->records.push_back(this->AddString(it->second));
+    }
+}
+void        SnapshotWriter::BeginElement            (const std::string &name, const IMPDElement *element)
+{
+    this->records.push_back(SnapshotElement);
+    this->records.push_back(this->AddString(name));
+    this->records.push_back((uint32_t) element->GetRawAttributeCount());
+
+    for (size_t i = 0; i < element->GetRawAttributeCount(); i++)
+    {
+        this->records.push_back(this->AddString(element->GetRawAttributeKey(i)));
+        this->records.push_back(this->AddString(element->GetRawAttributeValue(i)));
+    }
+}
+void        SnapshotWriter::CloseElement            ()
+{
+    this->records.push_back(SnapshotEnd);
+}
+void        SnapshotWriter::WriteDigest             (const IMPDElement *element)
+{
+    const AbstractMPDElement    *abstractElement    = dynamic_cast<const AbstractMPDElement *>(element);
+    uint64_t                    digest              = abstractElement ? abstractElement->GetDigest() : 0;
+
+    this->records.push_back(SnapshotDigest);
+    this->records.push_back((uint32_t) digest);
+    this->records.push_back((uint32_t) (digest >> 32));
+}
+void        SnapshotWriter::WriteText               (const std::string &text)
+{
+    this->records.push_back(SnapshotText);
+    this->records.push_back(this->AddString(text));
+}
+uint32_t    SnapshotWriter::AddString               (const std::string &value)
+{
+    std::map<std::string, uint32_t>::iterator it = this->stringIndices.lower_bound(value);
+
+    if (it != this->stringIndices.end() && it->first == value)
+        return it->second;
+
+    it = this->stringIndices.insert(it, std::make_pair(value, (uint32_t) this->strings.size()));
+    this->strings.push_back(&it->first);
+
+    return it->second;
+}
+bool        SnapshotWriter::WriteFile               (const IMPD *mpd, FILE *file)
+{
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+
+    std::string mpdPath = mpd->GetMPDPathBaseUrl() ? mpd->GetMPDPathBaseUrl()->GetUrl() : "";
+
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version      = SNAPSHOT_VERSION;
+    header.byteOrder    = SNAPSHOT_BYTE_ORDER;
+    header.mpdPath      = this->AddString(mpdPath);
+    header.fetchTime    = mpd->GetFetchTime();
+    header.eTag         = this->AddString(mpd->GetETag());
+    header.lastModified = this->AddString(mpd->GetLastModified());
+    header.stringCount  = (uint32_t) this->strings.size();
+
+    std::vector<uint32_t> offsets;
+    offsets.reserve(this->strings.size() + 1);
+
+    uint64_t stringBytes = 0;
+
+    for (size_t i = 0; i < this->strings.size(); i++)
+    {
+        offsets.push_back((uint32_t) stringBytes);
+        stringBytes += this->strings.at(i)->size() + 1;
+    }
+
+    if (stringBytes > 0xFFFFFFFF)
+        return false;
+
+    offsets.push_back((uint32_t) stringBytes);
+
+    /* the records are aligned to 4 bytes so that the reader can access them in place */
+    static const char padding[4] = { 0, 0, 0, 0 };
+    size_t paddingBytes = (size_t) ((4 - stringBytes % 4) % 4);
+
+    header.stringOffsets    = sizeof(header);
+    header.stringData       = header.stringOffsets + offsets.size() * sizeof(uint32_t);
+    header.records          = header.stringData + stringBytes + paddingBytes;
+    header.recordCount      = this->records.size();
+
+    if (fwrite(&header, sizeof(header), 1, file) != 1)
+        return false;
+
+    if (fwrite(&offsets[0], sizeof(uint32_t), offsets.size(), file) != offsets.size())
+        return false;
+
+    for (size_t i = 0; i < this->strings.size(); i++)
+    {
+        const std::string *value = this->strings.at(i);
+
+        if (fwrite(value->c_str(), 1, value->size() + 1, file) != value->size() + 1)
+            return false;
+    }
+
+    if (paddingBytes > 0 && fwrite(padding, 1, paddingBytes, file) != paddingBytes)
+        return false;
+
+    if (!this->records.empty() && fwrite(&this->records[0], sizeof(uint32_t), this->records.size(), file) != this->records.size())
+        return false;
+
+    return true;
+}
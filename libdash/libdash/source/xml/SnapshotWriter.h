@@ -0,0 +1,59 @@
+/*
+ * SnapshotWriter.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef SNAPSHOTWRITER_H_
+#define SNAPSHOTWRITER_H_
+
+#include "config.h"
+
+#include "Snapshot.h"
+#include "ElementWriter.h"
+#include "DOMParser.h"
+#include "../mpd/MPD.h"
+#include <cstdio>
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Writes an MPD into a snapshot that SnapshotReader loads without parsing the XML again. The elements are
+         *  written by ElementWriter. The digests of the elements that are refreshed separately are stored along with
+         *  them, so that a refresh of a loaded MPD behaves like one of the parsed MPD.
+         */
+        class SnapshotWriter : public ElementWriter
+        {
+            public:
+                SnapshotWriter          ();
+                virtual ~SnapshotWriter ();
+
+                bool    Write   (const dash::mpd::IMPD *mpd, const char *path);
+
+            protected:
+                void        BeginElement        (const std::string &name, const std::map<std::string, std::string> &attributes);
+                void        BeginElement        (const std::string &name, const dash::mpd::IMPDElement *element);
+                void        CloseElement        ();
+                void        WriteNode           (const INode *node);
+                void        WriteText           (const std::string &text);
+                void        WriteDigest         (const dash::mpd::IMPDElement *element);
+
+            private:
+                uint32_t    AddString           (const std::string &value);
+                bool        WriteFile           (const dash::mpd::IMPD *mpd, FILE *file);
+
+                std::map<std::string, uint32_t>     stringIndices;
+                std::vector<const std::string *>    strings;
+                std::vector<uint32_t>               records;
+        };
+    }
+}
+
+#endif /* SNAPSHOTWRITER_H_ */
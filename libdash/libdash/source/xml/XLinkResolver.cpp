@@ -0,0 +1,323 @@
+/*
+ * XLinkResolver.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "XLinkResolver.h"
+
+using namespace dash::xml;
+using namespace dash::mpd;
+using namespace dash::network;
+using namespace dash::helpers;
+
+const size_t    XLinkResolver::MAXDEPTH        = 4;
+const char      *XLinkResolver::RESOLVETOZERO  = "urn:mpeg:dash:resolve-to-zero:2013";
+
+XLinkResolver::XLinkResolver    (ManifestFetcher *fetcher, FragmentCache *cache, size_t parallelism) :
+               fetcher          (fetcher),
+               cache            (cache),
+               parallelism      (parallelism ? parallelism : 1)
+{
+}
+XLinkResolver::~XLinkResolver   ()
+{
+}
+
+void        XLinkResolver::SetParseOptions  (const ParseOptions &options)
+{
+    this->options = options;
+}
+void        XLinkResolver::SetBuildObservers(const std::vector<IMPDBuildObserver *> &observers)
+{
+    this->observers = observers;
+}
+void        XLinkResolver::Resolve          (MPD *mpd)
+{
+    /* remote elements may refer to further remote elements, the depth bounds chains and cycles */
+    for (size_t depth = 0; depth < MAXDEPTH; depth++)
+    {
+        std::vector<Link> links;
+
+        this->CollectLinks(mpd, links);
+
+        if (links.empty() || !this->ResolveLinks(mpd, links))
+            return;
+    }
+}
+bool        XLinkResolver::Resolve          (MPD *mpd, IMPDElement *element)
+{
+    const std::vector<IPeriod *> &periods = mpd->GetPeriods();
+
+    for (size_t i = 0; i < periods.size(); i++)
+    {
+        Period  *period = (Period *) periods.at(i);
+        Link    link;
+
+        link.period         = period;
+        link.adaptationSet  = NULL;
+        link.index          = i;
+
+        if (element != (IMPDElement *) period)
+        {
+            const std::vector<IAdaptationSet *> &adaptationSets = period->GetAdaptationSets();
+
+            for (size_t j = 0; j < adaptationSets.size() && link.adaptationSet == NULL; j++)
+                if (element == (IMPDElement *) adaptationSets.at(j))
+                    link.adaptationSet = (AdaptationSet *) adaptationSets.at(j);
+
+            if (link.adaptationSet == NULL)
+                continue;
+        }
+
+        const std::string &xlinkHref = link.adaptationSet ? link.adaptationSet->GetXlinkHref() : period->GetXlinkHref();
+
+        if (xlinkHref.empty())
+            return false;
+
+        link.url = this->GetUrl(mpd, xlinkHref);
+
+        if (!this->ResolveLinks(mpd, std::vector<Link>(1, link)))
+            return false;
+
+        this->Resolve(mpd);
+        return true;
+    }
+
+    return false;
+}
+void        XLinkResolver::CollectLinks     (MPD *mpd, std::vector<Link> &links)
+{
+    const std::vector<IPeriod *> &periods = mpd->GetPeriods();
+
+    for (size_t i = 0; i < periods.size(); i++)
+    {
+        Period  *period = (Period *) periods.at(i);
+        Link    link;
+
+        link.period         = period;
+        link.adaptationSet  = NULL;
+        link.index          = i;
+
+        /* the AdaptationSets of a Period that is replaced are replaced along with it */
+        if (DOMParser::IsResolvedOnLoad(period->GetXlinkHref(), period->GetXlinkActuate()))
+        {
+            link.url = this->GetUrl(mpd, period->GetXlinkHref());
+
+            if (this->failedUrls.find(link.url) == this->failedUrls.end())
+                links.push_back(link);
+
+            continue;
+        }
+
+        const std::vector<IAdaptationSet *> &adaptationSets = period->GetAdaptationSets();
+
+        for (size_t j = 0; j < adaptationSets.size(); j++)
+        {
+            AdaptationSet *adaptationSet = (AdaptationSet *) adaptationSets.at(j);
+
+            if (!DOMParser::IsResolvedOnLoad(adaptationSet->GetXlinkHref(), adaptationSet->GetXlinkActuate()))
+                continue;
+
+            link.adaptationSet  = adaptationSet;
+            link.url            = this->GetUrl(mpd, adaptationSet->GetXlinkHref());
+
+            if (this->failedUrls.find(link.url) == this->failedUrls.end())
+                links.push_back(link);
+        }
+    }
+}
+bool        XLinkResolver::ResolveLinks     (MPD *mpd, const std::vector<Link> &links)
+{
+    std::map<std::string, std::string> documents;
+
+    this->FetchDocuments(links, documents);
+
+    bool isResolved = false;
+
+    for (size_t i = 0; i < links.size(); i++)
+    {
+        const Link &link = links.at(i);
+
+        /* the element is removed without a request */
+        if (link.url == RESOLVETOZERO)
+        {
+            if (link.adaptationSet)
+                link.period->ReplaceAdaptationSet(link.adaptationSet, std::vector<AdaptationSet *>());
+            else
+                mpd->ReplacePeriod(link.period, std::vector<Period *>());
+
+            isResolved = true;
+            continue;
+        }
+
+        std::map<std::string, std::string>::const_iterator it = documents.find(link.url);
+
+        /* the element is kept as it is, a link that failed once is not tried again */
+        if (it == documents.end() || !this->Replace(mpd, link, it->second))
+        {
+            this->failedUrls.insert(link.url);
+            continue;
+        }
+
+        isResolved = true;
+    }
+
+    return isResolved;
+}
+void        XLinkResolver::FetchDocuments   (const std::vector<Link> &links, std::map<std::string, std::string> &documents)
+{
+    std::vector<ManifestTransfer *> transfers;
+    std::set<std::string>           requested;
+
+    for (size_t i = 0; i < links.size(); i++)
+    {
+        const std::string   &url = links.at(i).url;
+        std::string         document;
+
+        if (url == RESOLVETOZERO || requested.find(url) != requested.end())
+            continue;
+
+        requested.insert(url);
+
+        if (this->cache->Get(url, document))
+        {
+            documents[url] = document;
+            continue;
+        }
+
+        if (ManifestFetcher::IsRemoteUrl(url))
+        {
+            transfers.push_back(new ManifestTransfer(url));
+            continue;
+        }
+
+        std::ifstream file(url.c_str(), std::ios::in | std::ios::binary);
+
+        if (!file)
+            continue;
+
+        std::stringstream data;
+        data << file.rdbuf();
+
+        documents[url] = Wrap(data.str());
+    }
+
+    this->fetcher->FetchAll(transfers, this->parallelism);
+
+    for (size_t i = 0; i < transfers.size(); i++)
+    {
+        ManifestTransfer *transfer = transfers.at(i);
+
+        if (transfer->HasSucceeded() && !transfer->GetData().empty())
+        {
+            std::string document = Wrap(transfer->GetData());
+
+            documents[transfer->GetUrl()] = document;
+            this->cache->Put(transfer->GetUrl(), document);
+        }
+
+        delete transfer;
+    }
+}
+bool        XLinkResolver::Replace          (MPD *mpd, const Link &link, const std::string &document)
+{
+    /* the remote elements are built on the heap, the arena of the MPD would keep the memory of the elements that a
+       later refresh or resolution replaces */
+    DOMParser parser(document.data(), document.size(), link.url);
+
+    if (mpd->GetStringPool())
+        parser.SetStringPool(mpd->GetStringPool());
+
+    parser.SetParseOptions(this->options);
+
+    if (link.adaptationSet)
+    {
+        std::vector<AdaptationSet *> adaptationSets;
+
+        if (!parser.BuildAdaptationSets(link.period, adaptationSets))
+            return false;
+
+        link.period->ReplaceAdaptationSet(link.adaptationSet, adaptationSets);
+
+        for (size_t i = 0; i < adaptationSets.size(); i++)
+            this->Notify(mpd, link.period, adaptationSets.at(i));
+
+        return true;
+    }
+
+    std::vector<Period *> periods;
+
+    if (!parser.BuildPeriods(link.index, periods))
+        return false;
+
+    mpd->ReplacePeriod(link.period, periods);
+
+    for (size_t i = 0; i < periods.size(); i++)
+    {
+        const std::vector<IAdaptationSet *> &adaptationSets = periods.at(i)->GetAdaptationSets();
+
+        for (size_t j = 0; j < adaptationSets.size(); j++)
+            this->Notify(mpd, periods.at(i), (AdaptationSet *) adaptationSets.at(j));
+
+        this->Notify(mpd, periods.at(i), NULL);
+    }
+
+    return true;
+}
+void        XLinkResolver::Notify           (MPD *mpd, Period *period, AdaptationSet *adaptationSet)
+{
+    /* elements that are replaced in the next round are reported once they are */
+    if (adaptationSet && DOMParser::IsResolvedOnLoad(adaptationSet->GetXlinkHref(), adaptationSet->GetXlinkActuate()))
+        return;
+
+    if (DOMParser::IsResolvedOnLoad(period->GetXlinkHref(), period->GetXlinkActuate()))
+        return;
+
+    for (size_t i = 0; i < this->observers.size(); i++)
+    {
+        if (adaptationSet)
+            this->observers.at(i)->OnAdaptationSetBuilt(mpd, period, adaptationSet);
+        else
+            this->observers.at(i)->OnPeriodBuilt(mpd, period);
+    }
+}
+std::string XLinkResolver::GetUrl           (MPD *mpd, const std::string &xlinkHref)
+{
+    if (xlinkHref.find("://") != std::string::npos || xlinkHref.substr(0,4) == "urn:" || mpd->GetMPDPathBaseUrl() == NULL)
+        return xlinkHref;
+
+    const std::string &mpdPath = mpd->GetMPDPathBaseUrl()->GetUrl();
+
+    /* the path of an MPD that has been opened from the working directory is its file name */
+    if (mpdPath.find('/') == std::string::npos)
+        return xlinkHref;
+
+    /* an absolute path refers to the host of a remote MPD */
+    if (xlinkHref.at(0) == '/' && ManifestFetcher::IsRemoteUrl(mpdPath))
+        return mpdPath.substr(0, mpdPath.find('/', mpdPath.find("://") + 3)) + xlinkHref;
+
+    return Path::CombinePaths(mpdPath, xlinkHref);
+}
+std::string XLinkResolver::Wrap             (const std::string &data)
+{
+    size_t begin = 0;
+
+    if (data.substr(0,3) == "\xEF\xBB\xBF")
+        begin = 3;
+
+    /* the XML declaration of the fragment may only appear at the start of the document */
+    if (data.compare(begin, 5, "<?xml") == 0)
+    {
+        size_t end = data.find("?>", begin);
+        begin = (end == std::string::npos) ? data.size() : end + 2;
+    }
+
+    /* a remote element entity may consist of several elements and its prefixes may be declared by the MPD only */
+    return "<XLinkFragment xmlns:xlink=\"http://www.w3.org/1999/xlink\">" + data.substr(begin) + "</XLinkFragment>";
+}
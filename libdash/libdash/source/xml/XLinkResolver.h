@@ -0,0 +1,89 @@
+/*
+ * XLinkResolver.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef XLINKRESOLVER_H_
+#define XLINKRESOLVER_H_
+
+#include "config.h"
+
+#include <set>
+#include <fstream>
+#include "DOMParser.h"
+#include "ParseOptions.h"
+#include "IMPDBuildObserver.h"
+#include "../mpd/MPD.h"
+#include "../network/ManifestFetcher.h"
+#include "../network/ManifestTransfer.h"
+#include "../network/FragmentCache.h"
+#include "../helpers/Path.h"
+
+namespace dash
+{
+    namespace xml
+    {
+        /*
+         *  Replaces the Periods and AdaptationSets that carry an xlink:href with the elements of the remote element entity
+         *  the link refers to. All links that are known at a time are fetched concurrently, the remote elements may hold
+         *  links themselves, which are resolved in the following round. The remote documents are wrapped into a root element,
+         *  since they may consist of several elements, and kept in the cache in that form.
+         */
+        class XLinkResolver
+        {
+            public:
+                XLinkResolver           (network::ManifestFetcher *fetcher, network::FragmentCache *cache, size_t parallelism);
+                virtual ~XLinkResolver  ();
+
+                void    SetParseOptions     (const ParseOptions &options);
+                void    SetBuildObservers   (const std::vector<IMPDBuildObserver *> &observers);
+
+                /*
+                 *  Resolves all links with xlink:actuate onLoad. Links that cannot be resolved are kept.
+                 */
+                void    Resolve             (dash::mpd::MPD *mpd);
+
+                /*
+                 *  Resolves the link of the given Period or AdaptationSet of the MPD regardless of its xlink:actuate,
+                 *  followed by the onLoad links of the elements that replace it.
+                 */
+                bool    Resolve             (dash::mpd::MPD *mpd, dash::mpd::IMPDElement *element);
+
+            private:
+                struct Link
+                {
+                    dash::mpd::Period           *period;
+                    dash::mpd::AdaptationSet    *adaptationSet;     /* NULL if the Period itself is replaced */
+                    size_t                      index;
+                    std::string                 url;
+                };
+
+                void                CollectLinks    (dash::mpd::MPD *mpd, std::vector<Link> &links);
+                bool                ResolveLinks    (dash::mpd::MPD *mpd, const std::vector<Link> &links);
+                void                FetchDocuments  (const std::vector<Link> &links, std::map<std::string, std::string> &documents);
+                bool                Replace         (dash::mpd::MPD *mpd, const Link &link, const std::string &document);
+                void                Notify          (dash::mpd::MPD *mpd, dash::mpd::Period *period, dash::mpd::AdaptationSet *adaptationSet);
+                std::string         GetUrl          (dash::mpd::MPD *mpd, const std::string &xlinkHref);
+
+                static std::string  Wrap            (const std::string &data);
+
+                static const size_t MAXDEPTH;
+                static const char   *RESOLVETOZERO;
+
+                network::ManifestFetcher            *fetcher;
+                network::FragmentCache              *cache;
+                size_t                              parallelism;
+                ParseOptions                        options;
+                std::vector<IMPDBuildObserver *>    observers;
+                std::set<std::string>               failedUrls;
+        };
+    }
+}
+
+#endif /* XLINKRESOLVER_H_ */
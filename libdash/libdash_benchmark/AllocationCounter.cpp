@@ -0,0 +1,68 @@
+/*
+ * AllocationCounter.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "Measurement.h"
+
+#include <cstdlib>
+#include <new>
+
+/*
+ *  Replaces the global operator new and delete to keep track of the bytes that are currently allocated. Every block
+ *  carries a small header with its size. On ELF platforms the replacement is also used by the libdash shared library,
+ *  on Windows only allocations of the benchmark itself are counted. The counters are not synchronized, they are only
+ *  exact while a single thread allocates, which is the case for the memory mode.
+ */
+namespace
+{
+    const size_t    headerSize      = 16;
+    size_t          allocatedBytes  = 0;
+    size_t          allocations     = 0;
+
+    void*   allocate    (size_t size)
+    {
+        char *block = (char *) malloc(size + headerSize);
+
+        if (block == NULL)
+            throw std::bad_alloc();
+
+        *(size_t *) block = size;
+        allocatedBytes += size;
+        allocations++;
+
+        return block + headerSize;
+    }
+    void    deallocate  (void *pointer)
+    {
+        if (pointer == NULL)
+            return;
+
+        char *block = (char *) pointer - headerSize;
+        allocatedBytes -= *(size_t *) block;
+
+        free(block);
+    }
+}
+
+void*   operator new        (size_t size)                           { return allocate(size); }
+void*   operator new[]      (size_t size)                           { return allocate(size); }
+void    operator delete     (void *pointer) throw()                 { deallocate(pointer); }
+void    operator delete[]   (void *pointer) throw()                 { deallocate(pointer); }
+void    operator delete     (void *pointer, size_t) throw()         { deallocate(pointer); }
+void    operator delete[]   (void *pointer, size_t) throw()         { deallocate(pointer); }
+
+uint64_t    libdashbenchmark::Measurement::GetAllocatedBytes    ()
+{
+    return allocatedBytes;
+}
+uint64_t    libdashbenchmark::Measurement::GetAllocations       ()
+{
+    return allocations;
+}
@@ -0,0 +1,63 @@
+/*
+ * BuildTimer.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "BuildTimer.h"
+#include "Measurement.h"
+
+using namespace libdashbenchmark;
+using namespace dash::mpd;
+
+BuildTimer::BuildTimer  () :
+            start               (0),
+            firstAdaptationSet  (0),
+            firstPeriod         (0),
+            adaptationSets      (0),
+            periods             (0)
+{
+}
+BuildTimer::~BuildTimer ()
+{
+}
+
+void        BuildTimer::Start                       ()
+{
+    this->start                 = Measurement::GetTimeInUsec();
+    this->firstAdaptationSet    = 0;
+    this->firstPeriod           = 0;
+    this->adaptationSets        = 0;
+    this->periods               = 0;
+}
+uint64_t    BuildTimer::GetFirstAdaptationSetTime   () const
+{
+    return this->firstAdaptationSet;
+}
+uint64_t    BuildTimer::GetFirstPeriodTime          () const
+{
+    return this->firstPeriod;
+}
+uint64_t    BuildTimer::GetAdaptationSets           () const
+{
+    return this->adaptationSets;
+}
+uint64_t    BuildTimer::GetPeriods                  () const
+{
+    return this->periods;
+}
+void        BuildTimer::OnAdaptationSetBuilt        (IMPD *, IPeriod *, IAdaptationSet *)
+{
+    if (this->adaptationSets++ == 0)
+        this->firstAdaptationSet = Measurement::GetTimeInUsec() - this->start;
+}
+void        BuildTimer::OnPeriodBuilt               (IMPD *, IPeriod *)
+{
+    if (this->periods++ == 0)
+        this->firstPeriod = Measurement::GetTimeInUsec() - this->start;
+}
@@ -0,0 +1,49 @@
+/*
+ * BuildTimer.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef BUILDTIMER_H_
+#define BUILDTIMER_H_
+
+#include "config.h"
+
+#include "IMPDBuildObserver.h"
+
+namespace libdashbenchmark
+{
+    /*
+     *  Records when the first AdaptationSet and the first Period of an MPD have been built, relative to Start, which is
+     *  the time a player could issue its first segment request if it reacted to the build events.
+     */
+    class BuildTimer : public dash::IMPDBuildObserver
+    {
+        public:
+            BuildTimer          ();
+            virtual ~BuildTimer ();
+
+            void        Start                       ();
+            uint64_t    GetFirstAdaptationSetTime   () const;
+            uint64_t    GetFirstPeriodTime          () const;
+            uint64_t    GetAdaptationSets           () const;
+            uint64_t    GetPeriods                  () const;
+
+            void        OnAdaptationSetBuilt        (dash::mpd::IMPD *mpd, dash::mpd::IPeriod *period, dash::mpd::IAdaptationSet *adaptationSet);
+            void        OnPeriodBuilt               (dash::mpd::IMPD *mpd, dash::mpd::IPeriod *period);
+
+        private:
+            uint64_t    start;
+            uint64_t    firstAdaptationSet;
+            uint64_t    firstPeriod;
+            uint64_t    adaptationSets;
+            uint64_t    periods;
+    };
+}
+
+#endif /* BUILDTIMER_H_ */
@@ -0,0 +1,303 @@
+/*
+ * HTTPStandIn.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "HTTPStandIn.h"
+
+#include <cstdio>
+#include <sstream>
+
+#if !defined MSG_NOSIGNAL
+    #define MSG_NOSIGNAL 0
+#endif
+
+using namespace libdashbenchmark;
+
+HTTPStandIn::HTTPStandIn    () :
+             listener       (-1),
+             port           (0),
+             isStopping     (false),
+             rangeHandling  (IgnoreRange),
+             thread         (NULL),
+             bytesSent      (0)
+{
+    InitializeCriticalSection(&this->monitorMutex);
+}
+HTTPStandIn::~HTTPStandIn   ()
+{
+    this->Stop();
+
+    DeleteCriticalSection(&this->monitorMutex);
+}
+
+bool        HTTPStandIn::Start          ()
+{
+    if (this->thread)
+        return false;
+
+#if defined _WIN32 || defined _WIN64
+    WSADATA info;
+
+    if (WSAStartup(MAKEWORD(2,0), &info))
+        return false;
+#endif
+
+    this->listener = (int) socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+    sockaddr_in addr;
+    socklen_t   length = sizeof(addr);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family         = AF_INET;
+    addr.sin_addr.s_addr    = htonl(INADDR_LOOPBACK);
+    addr.sin_port           = 0;
+
+    /* port 0 lets the system pick a free port, so several runs do not collide */
+    if (this->listener < 0 || bind(this->listener, (sockaddr *) &addr, sizeof(addr)) != 0 || listen(this->listener, 16) != 0 ||
+        getsockname(this->listener, (sockaddr *) &addr, &length) != 0)
+    {
+        this->Stop();
+        return false;
+    }
+
+    this->port          = ntohs(addr.sin_port);
+    this->isStopping    = false;
+    this->thread        = CreateThreadPortable(Serve, this);
+
+    if (this->thread == NULL)
+    {
+        this->Stop();
+        return false;
+    }
+
+    return true;
+}
+void        HTTPStandIn::Stop           ()
+{
+    if (this->thread)
+    {
+        EnterCriticalSection(&this->monitorMutex);
+        this->isStopping = true;
+        LeaveCriticalSection(&this->monitorMutex);
+
+        /* accept only returns for a connection, the serving thread finds the flag set then */
+        int         wakeUp = (int) socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        sockaddr_in addr;
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family         = AF_INET;
+        addr.sin_addr.s_addr    = htonl(INADDR_LOOPBACK);
+        addr.sin_port           = htons(this->port);
+
+        if (wakeUp >= 0)
+        {
+            connect(wakeUp, (sockaddr *) &addr, sizeof(addr));
+            closesocket(wakeUp);
+        }
+
+        JoinThread(this->thread);
+        DestroyThreadPortable(this->thread);
+        this->thread = NULL;
+    }
+
+    if (this->listener >= 0)
+    {
+        closesocket(this->listener);
+        this->listener = -1;
+        WSACleanup();
+    }
+}
+void        HTTPStandIn::SetResource    (const std::string &path, const std::string &body)
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    if (body.empty())
+        this->resources.erase(path);
+    else
+        this->resources[path] = body;
+
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void        HTTPStandIn::SetRangeHandling   (RangeHandling rangeHandling)
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->rangeHandling = rangeHandling;
+    LeaveCriticalSection(&this->monitorMutex);
+}
+std::string HTTPStandIn::GetUrl         (const std::string &path) const
+{
+    std::stringstream ss;
+    ss << "http://127.0.0.1:" << this->port << path;
+
+    return ss.str();
+}
+size_t      HTTPStandIn::GetRequests    (const std::string &path) const
+{
+    EnterCriticalSection(&this->monitorMutex);
+
+    std::map<std::string, size_t>::const_iterator it = this->requests.find(path);
+    size_t count = it == this->requests.end() ? 0 : it->second;
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return count;
+}
+uint64_t    HTTPStandIn::GetBytesSent   () const
+{
+    EnterCriticalSection(&this->monitorMutex);
+    uint64_t bytes = this->bytesSent;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return bytes;
+}
+void        HTTPStandIn::ResetCounters  ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    this->requests.clear();
+    this->bytesSent = 0;
+    LeaveCriticalSection(&this->monitorMutex);
+}
+void*       HTTPStandIn::Serve          (void *standIn)
+{
+    HTTPStandIn *server = (HTTPStandIn *) standIn;
+
+    while (true)
+    {
+        int connection = (int) accept(server->listener, NULL, NULL);
+
+        EnterCriticalSection(&server->monitorMutex);
+        bool isStopping = server->isStopping;
+        LeaveCriticalSection(&server->monitorMutex);
+
+        if (connection < 0 || isStopping)
+        {
+            if (connection >= 0)
+                closesocket(connection);
+            break;
+        }
+
+        server->Answer(connection);
+        closesocket(connection);
+    }
+
+    return NULL;
+}
+std::string HTTPStandIn::GetETag        (const std::string &body)
+{
+    /* FNV-1a, the tag only has to change with the body */
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < body.size(); i++)
+        hash = (hash ^ (uint8_t) body[i]) * 16777619U;
+
+    std::stringstream ss;
+    ss << "\"" << std::hex << hash << "-" << std::dec << body.size() << "\"";
+
+    return ss.str();
+}
+void        HTTPStandIn::Answer         (int connection)
+{
+    std::string request;
+    char        buffer[1024];
+
+    /* only the request line is of interest, the body of a GET request is empty */
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 16384)
+    {
+        int size = recv(connection, buffer, sizeof(buffer), 0);
+
+        if (size <= 0)
+            return;
+
+        request.append(buffer, size);
+    }
+
+    size_t      begin   = request.find(' ');
+    size_t      end     = begin == std::string::npos ? std::string::npos : request.find(' ', begin + 1);
+    std::string path    = end == std::string::npos ? "" : request.substr(begin + 1, end - begin - 1);
+    std::string body;
+    bool        isFound = false;
+
+    EnterCriticalSection(&this->monitorMutex);
+
+    RangeHandling rangeHandling = this->rangeHandling;
+
+    std::map<std::string, std::string>::const_iterator it = this->resources.find(path);
+
+    if (it != this->resources.end())
+    {
+        body    = it->second;
+        isFound = true;
+    }
+
+    this->requests[path]++;
+
+    LeaveCriticalSection(&this->monitorMutex);
+
+    const std::string   rangeHeader     = "\r\nrange: bytes=";
+
+    std::stringstream   ss;
+    std::string         lowerRequest    = request;
+    size_t              range           = std::string::npos;
+    uint64_t            firstByte       = 0;
+    uint64_t            lastByte        = 0;
+
+    for (size_t i = 0; i < lowerRequest.size(); i++)
+        lowerRequest[i] = tolower(lowerRequest[i]);
+
+    if (isFound && rangeHandling != IgnoreRange)
+        range = lowerRequest.find(rangeHeader);
+
+    if (range != std::string::npos &&
+        sscanf(lowerRequest.c_str() + range + rangeHeader.size(), "%llu-%llu", (unsigned long long *) &firstByte, (unsigned long long *) &lastByte) == 2 &&
+        firstByte <= lastByte && firstByte < body.size())
+    {
+        if (rangeHandling == ShiftRange && lastByte + 1 < body.size())
+        {
+            firstByte++;
+            lastByte++;
+        }
+
+        lastByte = std::min(lastByte, (uint64_t) body.size() - 1);
+
+        ss << "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " << firstByte << "-" << lastByte << "/" << body.size() << "\r\n";
+        body = body.substr((size_t) firstByte, (size_t) (lastByte - firstByte + 1));
+    }
+    else if (isFound && lowerRequest.find("\r\nif-none-match: " + GetETag(body)) != std::string::npos)
+    {
+        ss << "HTTP/1.1 304 Not Modified\r\nETag: " << GetETag(body) << "\r\n";
+        body.clear();
+    }
+    else
+    {
+        ss << (isFound ? "HTTP/1.1 200 OK\r\n" : "HTTP/1.1 404 Not Found\r\n");
+
+        if (isFound)
+            ss << "ETag: " << GetETag(body) << "\r\n";
+    }
+
+    ss << "Content-Length: " << body.size() << "\r\nConnection: close\r\n\r\n" << body;
+
+    std::string response    = ss.str();
+    size_t      sent        = 0;
+
+    while (sent < response.size())
+    {
+        int size = send(connection, response.data() + sent, (int) (response.size() - sent), MSG_NOSIGNAL);
+
+        if (size <= 0)
+            break;
+
+        sent += size;
+    }
+
+    EnterCriticalSection(&this->monitorMutex);
+    this->bytesSent += sent;
+    LeaveCriticalSection(&this->monitorMutex);
+}
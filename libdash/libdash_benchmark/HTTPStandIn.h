@@ -0,0 +1,80 @@
+/*
+ * HTTPStandIn.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef HTTPSTANDIN_H_
+#define HTTPSTANDIN_H_
+
+#include "config.h"
+
+#include "../libdash/source/portable/Networking.h"
+#include "../libdash/source/portable/MultiThreading.h"
+
+#include <map>
+#include <string>
+
+namespace libdashbenchmark
+{
+    /*
+     *  How the stand-in answers a request with a Range header.
+     */
+    enum RangeHandling
+    {
+        IgnoreRange,    /* the whole resource is sent with 200 */
+        ServeRange,     /* the requested bytes are sent with 206 */
+        ShiftRange      /* like ServeRange, but the bytes and the Content-Range start one byte later, like a broken cache */
+    };
+
+    /*
+     *  A minimal HTTP server on the loopback interface that stands in for the origin of a live MPD. It answers GET
+     *  requests for the resources that have been set with 200 and all others with 404, one request per connection,
+     *  and counts the requests per path and the bytes it sent, headers included. Ranges are ignored unless set otherwise.
+     *  Every resource is sent with an ETag derived from its body, a request whose If-None-Match carries it gets 304.
+     */
+    class HTTPStandIn
+    {
+        public:
+            HTTPStandIn             ();
+            virtual ~HTTPStandIn    ();
+
+            /*
+             *  Listens on a free port of 127.0.0.1 and serves the requests on a thread of its own until Stop() is called.
+             */
+            bool        Start           ();
+            void        Stop            ();
+
+            /*
+             *  An empty body removes the resource, requests for it are answered with 404 then.
+             */
+            void        SetResource     (const std::string &path, const std::string &body);
+            void        SetRangeHandling(RangeHandling rangeHandling);
+            std::string GetUrl          (const std::string &path) const;
+            size_t      GetRequests     (const std::string &path) const;
+            uint64_t    GetBytesSent    () const;
+            void        ResetCounters   ();
+
+        private:
+            int                                 listener;
+            unsigned short                      port;
+            bool                                isStopping;
+            RangeHandling                       rangeHandling;
+            THREAD_HANDLE                       thread;
+            std::map<std::string, std::string>  resources;
+            std::map<std::string, size_t>       requests;
+            uint64_t                            bytesSent;
+            mutable CRITICAL_SECTION            monitorMutex;
+
+            static void*        Serve   (void *standIn);
+            static std::string  GetETag (const std::string &body);
+            void                Answer  (int connection);
+    };
+}
+
+#endif /* HTTPSTANDIN_H_ */
@@ -0,0 +1,255 @@
+/*
+ * MPDGenerator.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "MPDGenerator.h"
+
+#include <fstream>
+
+using namespace libdashbenchmark;
+
+MPDGenerator::MPDGenerator  () :
+              periods           (1),
+              adaptationSets    (2),
+              representations   (8),
+              segmentURLs       (2000),
+              timelineEntries   (0),
+              contentProtections(1),
+              adSplices         (false),
+              publishTime       ("")
+{
+}
+MPDGenerator::~MPDGenerator ()
+{
+}
+
+void        MPDGenerator::SetPeriods                (size_t periods)
+{
+    this->periods = periods;
+}
+void        MPDGenerator::SetAdaptationSets         (size_t adaptationSets)
+{
+    this->adaptationSets = adaptationSets;
+}
+void        MPDGenerator::SetRepresentations        (size_t representations)
+{
+    this->representations = representations;
+}
+void        MPDGenerator::SetSegmentURLs            (size_t segmentURLs)
+{
+    this->segmentURLs = segmentURLs;
+}
+void        MPDGenerator::SetTimelineEntries        (size_t timelineEntries)
+{
+    this->timelineEntries = timelineEntries;
+}
+void        MPDGenerator::SetContentProtections     (size_t contentProtections)
+{
+    this->contentProtections = contentProtections;
+}
+void        MPDGenerator::SetAdSplices              (bool adSplices)
+{
+    this->adSplices = adSplices;
+}
+void        MPDGenerator::SetPublishTime            (const std::string &publishTime)
+{
+    this->publishTime = publishTime;
+}
+std::string MPDGenerator::Generate                  () const
+{
+    std::stringstream ss;
+
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    ss << "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" xmlns:ext=\"urn:example:extension\" xmlns:cenc=\"urn:mpeg:cenc:2013\"";
+
+    if (this->publishTime.empty())
+        ss << " type=\"static\" mediaPresentationDuration=\"PT2H0M0S\"";
+    else
+        ss << " id=\"benchmark\" type=\"dynamic\" publishTime=\"" << this->publishTime << "\" availabilityStartTime=\"1970-01-01T00:00:00Z\" minimumUpdatePeriod=\"PT2S\"";
+
+    ss << " minBufferTime=\"PT2S\" profiles=\"urn:mpeg:dash:profile:full:2011\">\n";
+    ss << "  <ProgramInformation moreInformationURL=\"http://www.example.com\"><Title>Benchmark</Title></ProgramInformation>\n";
+    ss << "  <BaseURL>http://www.example.com/content/</BaseURL>\n";
+
+    if (!this->publishTime.empty())
+        ss << "  <PatchLocation>benchmark.mpp</PatchLocation>\n";
+
+    for (size_t p = 0; p < this->periods; p++)
+        this->GeneratePeriod(ss, p);
+
+    ss << "</MPD>\n";
+
+    return ss.str();
+}
+std::string MPDGenerator::GeneratePatch             (const MPDGenerator &next) const
+{
+    std::stringstream ss;
+
+    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    ss << "<Patch xmlns=\"urn:mpeg:dash:schema:mpd-patch:2020\" xmlns:p=\"urn:ietf:params:xml:schema:patch-ops\""
+       << " xmlns:ext=\"urn:example:extension\" xmlns:cenc=\"urn:mpeg:cenc:2013\" mpdId=\"benchmark\""
+       << " originalPublishTime=\"" << this->publishTime << "\" publishTime=\"" << next.publishTime << "\">\n";
+    ss << "  <p:replace sel=\"/MPD/@publishTime\">" << next.publishTime << "</p:replace>\n";
+
+    for (size_t p = 0; p < this->periods && this->timelineEntries > 0 && next.timelineEntries > this->timelineEntries; p++)
+    {
+        if (this->adSplices && p % 2 == 1)
+            continue;
+
+        for (size_t a = 0; a < this->adaptationSets; a++)
+        {
+            ss << "  <p:add sel=\"/MPD/Period[@id='" << p << "']/AdaptationSet[@id='" << a << "']/SegmentTemplate/SegmentTimeline\">";
+
+            for (size_t s = this->timelineEntries; s < next.timelineEntries; s++)
+                this->GenerateTimelineEntry(ss, s);
+
+            ss << "</p:add>\n";
+        }
+    }
+
+    /* the Periods are appended behind the last element of the MPD */
+    if (next.periods > this->periods)
+    {
+        ss << "  <p:add sel=\"/MPD\">\n";
+
+        for (size_t p = this->periods; p < next.periods; p++)
+            next.GeneratePeriod(ss, p);
+
+        ss << "  </p:add>\n";
+    }
+
+    ss << "</Patch>\n";
+
+    return ss.str();
+}
+bool        MPDGenerator::WriteToFile               (const std::string &path) const
+{
+    std::ofstream file(path.c_str(), std::ios::out | std::ios::binary);
+
+    if (!file.is_open())
+        return false;
+
+    file << this->Generate();
+    file.close();
+
+    return true;
+}
+void        MPDGenerator::GeneratePeriod            (std::stringstream &ss, size_t period) const
+{
+    bool    isAd            = this->adSplices && period % 2 == 1;
+    size_t  representations = isAd ? std::min<size_t>(this->representations, 3) : this->representations;
+    size_t  segmentURLs     = isAd ? std::min<size_t>(this->segmentURLs, 15) : this->segmentURLs;
+    size_t  start           = 0;
+
+    for (size_t p = 0; p < period; p++)
+        start += this->adSplices && p % 2 == 1 ? 30 : 7200;
+
+    if (isAd)
+    {
+        ss << "  <Period id=\"ad-" << period << "\" start=\"PT" << start << "S\" duration=\"PT30S\">\n";
+        ss << "    <BaseURL>http://ads.example.com/creative-" << period << "/</BaseURL>\n";
+    }
+    else
+    {
+        ss << "  <Period id=\"" << period << "\" start=\"PT" << start << "S\">\n";
+    }
+
+    ss << "    <ext:PeriodInfo ext:index=\"" << period << "\"><ext:Note>generated</ext:Note></ext:PeriodInfo>\n";
+
+    for (size_t a = 0; a < this->adaptationSets; a++)
+    {
+        ss << "    <AdaptationSet id=\"" << a << "\" mimeType=\"" << (a % 2 ? "audio/mp4" : "video/mp4") << "\" segmentAlignment=\"true\">\n";
+
+        for (size_t c = 0; c < this->contentProtections; c++)
+            this->GenerateContentProtection(ss, c);
+
+        ss << "      <Role schemeIdUri=\"urn:mpeg:dash:role:2011\" value=\"main\"/>\n";
+
+        if (this->timelineEntries > 0 && !isAd)
+            this->GenerateSegmentTimeline(ss);
+
+        for (size_t r = 0; r < representations; r++)
+            this->GenerateRepresentation(ss, period, a, r, this->timelineEntries > 0 && !isAd ? 0 : segmentURLs);
+
+        ss << "    </AdaptationSet>\n";
+    }
+    ss << "  </Period>\n";
+}
+void        MPDGenerator::GenerateContentProtection (std::stringstream &ss, size_t index) const
+{
+    if (index == 0)
+    {
+        ss << "      <ContentProtection schemeIdUri=\"urn:mpeg:dash:mp4protection:2011\" value=\"cenc\" cenc:default_KID=\"10000000-1000-1000-1000-100000000001\"/>\n";
+        return;
+    }
+
+    /* the pssh boxes of real manifests are base64 blobs of several hundred bytes that are kept as additional nodes */
+    ss << "      <ContentProtection schemeIdUri=\"urn:uuid:" << std::hex << 0x9a04f079 + index << std::dec << "-9840-4286-ab92-e65be0885f95\" value=\"drm-" << index << "\">\n";
+    ss << "        <cenc:pssh>";
+
+    for (size_t i = 0; i < 12; i++)
+        ss << "AAAAQHBzc2gAAAAA7e+LqXnWSs6jyCfc1R0h7QAAACAIARIQEAAAABAAEAAQABAAAAAAAR";
+
+    ss << "</cenc:pssh>\n";
+    ss << "        <ext:LicenseServer ext:url=\"https://license.example.com/drm-" << index << "\" ext:retries=\"3\"><ext:Header ext:name=\"X-Token\">token-" << index << "</ext:Header></ext:LicenseServer>\n";
+    ss << "      </ContentProtection>\n";
+}
+void        MPDGenerator::GenerateSegmentTimeline   (std::stringstream &ss) const
+{
+    ss << "      <SegmentTemplate timescale=\"90000\" initialization=\"$RepresentationID$/init.mp4\" media=\"$RepresentationID$/$Time$.m4s\">\n";
+    ss << "        <SegmentTimeline>\n";
+
+    for (size_t s = 0; s < this->timelineEntries; s++)
+    {
+        ss << "          ";
+        this->GenerateTimelineEntry(ss, s);
+        ss << "\n";
+    }
+
+    ss << "        </SegmentTimeline>\n";
+    ss << "      </SegmentTemplate>\n";
+}
+void        MPDGenerator::GenerateTimelineEntry     (std::stringstream &ss, size_t index) const
+{
+    /* durations that change from one element to the next, as with audio frames, so that @r can rarely be used */
+    uint64_t    duration    = index % 3 == 2 ? 178178 : 180180;
+    size_t      repeat      = index % 50 == 49 ? 2 : 0;
+
+    ss << "<S";
+    if (index == 0)
+        ss << " t=\"0\"";
+    ss << " d=\"" << duration << "\"";
+    if (repeat > 0)
+        ss << " r=\"" << repeat << "\"";
+    ss << "/>";
+}
+void        MPDGenerator::GenerateRepresentation    (std::stringstream &ss, size_t period, size_t adaptationSet, size_t representation, size_t segmentURLs) const
+{
+    ss << "      <Representation id=\"p" << period << "a" << adaptationSet << "r" << representation << "\""
+       << " bandwidth=\"" << (representation + 1) * 250000 << "\" width=\"" << 320 * (representation + 1) << "\""
+       << " height=\"" << 180 * (representation + 1) << "\" codecs=\"avc1.4d401f\">\n";
+    ss << "        <ext:Encoder ext:name=\"generator\" ext:pass=\"2\"/>\n";
+
+    if (segmentURLs == 0)
+    {
+        ss << "      </Representation>\n";
+        return;
+    }
+
+    ss << "        <SegmentList timescale=\"1000\" duration=\"2000\">\n";
+    ss << "          <Initialization sourceURL=\"p" << period << "/a" << adaptationSet << "/r" << representation << "/init.mp4\"/>\n";
+
+    for (size_t s = 0; s < segmentURLs; s++)
+        ss << "          <SegmentURL media=\"p" << period << "/a" << adaptationSet << "/r" << representation << "/seg-" << s << ".m4s\""
+           << " mediaRange=\"" << s * 100000 << "-" << s * 100000 + 99999 << "\"/>\n";
+
+    ss << "        </SegmentList>\n";
+    ss << "      </Representation>\n";
+}
@@ -0,0 +1,78 @@
+/*
+ * MPDGenerator.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MPDGENERATOR_H_
+#define MPDGENERATOR_H_
+
+#include "config.h"
+
+namespace libdashbenchmark
+{
+    /*
+     *  Writes synthetic manifests that resemble the worst cases seen in practice: deep bitrate ladders, long
+     *  SegmentLists or SegmentTimelines, Periods that alternate with inserted ads and AdaptationSets that carry the
+     *  ContentProtection elements of several DRM systems, each with its own extension nodes.
+     */
+    class MPDGenerator
+    {
+        public:
+            MPDGenerator            ();
+            virtual ~MPDGenerator   ();
+
+            void        SetPeriods                  (size_t periods);
+            void        SetAdaptationSets           (size_t adaptationSets);
+            void        SetRepresentations          (size_t representations);
+            void        SetSegmentURLs              (size_t segmentURLs);
+
+            /*
+             *  A value above 0 describes the Segments of every AdaptationSet with a SegmentTemplate whose SegmentTimeline
+             *  has the given number of S elements instead of a SegmentList per Representation.
+             */
+            void        SetTimelineEntries          (size_t timelineEntries);
+            void        SetContentProtections       (size_t contentProtections);
+
+            /*
+             *  Turns every second Period into a short ad break with its own BaseURL and a smaller ladder.
+             */
+            void        SetAdSplices                (bool adSplices);
+
+            /*
+             *  A non-empty value turns the manifest into a live MPD with the given @publishTime that announces a PatchLocation.
+             */
+            void        SetPublishTime              (const std::string &publishTime);
+            std::string Generate                    () const;
+
+            /*
+             *  Returns the MPD Patch document that turns the live MPD into the next one: the S elements and Periods the next
+             *  MPD has in addition are appended and its @publishTime is set. Both have to differ in these values only.
+             */
+            std::string GeneratePatch               (const MPDGenerator &next) const;
+            bool        WriteToFile                 (const std::string &path) const;
+
+        private:
+            size_t  periods;
+            size_t  adaptationSets;
+            size_t  representations;
+            size_t  segmentURLs;
+            size_t  timelineEntries;
+            size_t  contentProtections;
+            bool    adSplices;
+            std::string publishTime;
+
+            void    GeneratePeriod              (std::stringstream &ss, size_t period) const;
+            void    GenerateContentProtection   (std::stringstream &ss, size_t index) const;
+            void    GenerateSegmentTimeline     (std::stringstream &ss) const;
+            void    GenerateTimelineEntry       (std::stringstream &ss, size_t index) const;
+            void    GenerateRepresentation      (std::stringstream &ss, size_t period, size_t adaptationSet, size_t representation, size_t segmentURLs) const;
+    };
+}
+
+#endif /* MPDGENERATOR_H_ */
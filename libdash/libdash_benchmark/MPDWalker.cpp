@@ -0,0 +1,286 @@
+/*
+ * MPDWalker.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "MPDWalker.h"
+
+using namespace libdashbenchmark;
+using namespace dash::mpd;
+using namespace dash::xml;
+
+MPDWalker::MPDWalker    () :
+           elements     (0),
+           stringBytes  (0)
+{
+}
+MPDWalker::~MPDWalker   ()
+{
+}
+
+void        MPDWalker::Walk                     (const IMPD *mpd)
+{
+    this->VisitElement(mpd);
+    this->VisitString(mpd->GetId());
+    this->VisitStrings(mpd->GetProfiles());
+    this->VisitString(mpd->GetType());
+    this->VisitString(mpd->GetAvailabilityStarttime());
+    this->VisitString(mpd->GetAvailabilityEndtime());
+    this->VisitString(mpd->GetMediaPresentationDuration());
+    this->VisitString(mpd->GetMinimumUpdatePeriod());
+    this->VisitString(mpd->GetMinBufferTime());
+    this->VisitString(mpd->GetTimeShiftBufferDepth());
+    this->VisitString(mpd->GetSuggestedPresentationDelay());
+    this->VisitString(mpd->GetMaxSegmentDuration());
+    this->VisitString(mpd->GetMaxSubsegmentDuration());
+    this->VisitStrings(mpd->GetLocations());
+    this->VisitBaseUrls(mpd->GetBaseUrls());
+
+    for (size_t i = 0; i < mpd->GetProgramInformations().size(); i++)
+    {
+        IProgramInformation *programInformation = mpd->GetProgramInformations().at(i);
+
+        this->VisitElement(programInformation);
+        this->VisitString(programInformation->GetTitle());
+        this->VisitString(programInformation->GetSource());
+        this->VisitString(programInformation->GetCopyright());
+        this->VisitString(programInformation->GetLang());
+        this->VisitString(programInformation->GetMoreInformationURL());
+    }
+
+    for (size_t i = 0; i < mpd->GetMetrics().size(); i++)
+    {
+        IMetrics *metrics = mpd->GetMetrics().at(i);
+
+        this->VisitElement(metrics);
+        this->VisitString(metrics->GetMetrics());
+        this->VisitDescriptors(metrics->GetReportings());
+
+        for (size_t j = 0; j < metrics->GetRanges().size(); j++)
+        {
+            this->VisitString(metrics->GetRanges().at(j)->GetStarttime());
+            this->VisitString(metrics->GetRanges().at(j)->GetDuration());
+        }
+    }
+
+    for (size_t i = 0; i < mpd->GetPeriods().size(); i++)
+        this->VisitPeriod(mpd->GetPeriods().at(i));
+}
+uint64_t    MPDWalker::GetElements              () const
+{
+    return this->elements;
+}
+uint64_t    MPDWalker::GetStringBytes           () const
+{
+    return this->stringBytes;
+}
+void        MPDWalker::VisitPeriod              (const IPeriod *period)
+{
+    this->VisitElement(period);
+    this->VisitString(period->GetId());
+    this->VisitString(period->GetStart());
+    this->VisitString(period->GetDuration());
+    this->VisitString(period->GetXlinkHref());
+    this->VisitString(period->GetXlinkActuate());
+    this->VisitBaseUrls(period->GetBaseURLs());
+    this->VisitSegmentInformation(period->GetSegmentBase(), period->GetSegmentList(), period->GetSegmentTemplate());
+
+    for (size_t i = 0; i < period->GetSubsets().size(); i++)
+        this->VisitElement(period->GetSubsets().at(i));
+
+    for (size_t i = 0; i < period->GetAdaptationSets().size(); i++)
+        this->VisitAdaptationSet(period->GetAdaptationSets().at(i));
+}
+void        MPDWalker::VisitAdaptationSet       (const IAdaptationSet *adaptationSet)
+{
+    this->VisitRepresentationBase(adaptationSet);
+    this->VisitString(adaptationSet->GetXlinkHref());
+    this->VisitString(adaptationSet->GetXlinkActuate());
+    this->VisitString(adaptationSet->GetLang());
+    this->VisitString(adaptationSet->GetContentType());
+    this->VisitString(adaptationSet->GetPar());
+    this->VisitString(adaptationSet->GetMinFramerate());
+    this->VisitString(adaptationSet->GetMaxFramerate());
+    this->VisitDescriptors(adaptationSet->GetAccessibility());
+    this->VisitDescriptors(adaptationSet->GetRole());
+    this->VisitDescriptors(adaptationSet->GetRating());
+    this->VisitDescriptors(adaptationSet->GetViewpoint());
+    this->VisitBaseUrls(adaptationSet->GetBaseURLs());
+    this->VisitSegmentInformation(adaptationSet->GetSegmentBase(), adaptationSet->GetSegmentList(), adaptationSet->GetSegmentTemplate());
+
+    for (size_t i = 0; i < adaptationSet->GetContentComponent().size(); i++)
+    {
+        IContentComponent *contentComponent = adaptationSet->GetContentComponent().at(i);
+
+        this->VisitElement(contentComponent);
+        this->VisitString(contentComponent->GetLang());
+        this->VisitString(contentComponent->GetContentType());
+        this->VisitString(contentComponent->GetPar());
+        this->VisitDescriptors(contentComponent->GetAccessibility());
+        this->VisitDescriptors(contentComponent->GetRole());
+        this->VisitDescriptors(contentComponent->GetRating());
+        this->VisitDescriptors(contentComponent->GetViewpoint());
+    }
+
+    for (size_t i = 0; i < adaptationSet->GetRepresentation().size(); i++)
+        this->VisitRepresentation(adaptationSet->GetRepresentation().at(i));
+}
+void        MPDWalker::VisitRepresentation      (const IRepresentation *representation)
+{
+    this->VisitRepresentationBase(representation);
+    this->VisitString(representation->GetId());
+    this->VisitStrings(representation->GetDependencyId());
+    this->VisitStrings(representation->GetMediaStreamStructureId());
+    this->VisitBaseUrls(representation->GetBaseURLs());
+    this->VisitSegmentInformation(representation->GetSegmentBase(), representation->GetSegmentList(), representation->GetSegmentTemplate());
+
+    for (size_t i = 0; i < representation->GetSubRepresentations().size(); i++)
+    {
+        ISubRepresentation *subRepresentation = representation->GetSubRepresentations().at(i);
+
+        this->VisitRepresentationBase(subRepresentation);
+        this->VisitStrings(subRepresentation->GetContentComponent());
+    }
+}
+void        MPDWalker::VisitRepresentationBase  (const IRepresentationBase *representationBase)
+{
+    this->VisitElement(representationBase);
+    this->VisitStrings(representationBase->GetProfiles());
+    this->VisitString(representationBase->GetSar());
+    this->VisitString(representationBase->GetFrameRate());
+    this->VisitString(representationBase->GetAudioSamplingRate());
+    this->VisitString(representationBase->GetMimeType());
+    this->VisitStrings(representationBase->GetSegmentProfiles());
+    this->VisitStrings(representationBase->GetCodecs());
+    this->VisitString(representationBase->GetScanType());
+    this->VisitDescriptors(representationBase->GetFramePacking());
+    this->VisitDescriptors(representationBase->GetAudioChannelConfiguration());
+    this->VisitDescriptors(representationBase->GetContentProtection());
+}
+void        MPDWalker::VisitSegmentInformation  (const ISegmentBase *segmentBase, const ISegmentList *segmentList, const ISegmentTemplate *segmentTemplate)
+{
+    if (segmentBase)
+        this->VisitSegmentBase(segmentBase);
+
+    if (segmentList)
+    {
+        this->VisitSegmentBase(segmentList);
+        this->VisitString(segmentList->GetXlinkHref());
+        this->VisitString(segmentList->GetXlinkActuate());
+
+        for (size_t i = 0; i < segmentList->GetSegmentURLCount(); i++)
+        {
+            ISegmentURL *segmentURL = segmentList->GetSegmentURL(i);
+
+            this->VisitElement(segmentURL);
+            this->VisitString(segmentURL->GetMediaURI());
+            this->VisitString(segmentURL->GetMediaRange());
+            this->VisitString(segmentURL->GetIndexURI());
+            this->VisitString(segmentURL->GetIndexRange());
+        }
+    }
+
+    if (segmentTemplate)
+    {
+        this->VisitSegmentBase(segmentTemplate);
+        this->VisitString(segmentTemplate->Getmedia());
+        this->VisitString(segmentTemplate->Getindex());
+        this->VisitString(segmentTemplate->Getinitialization());
+        this->VisitString(segmentTemplate->GetbitstreamSwitching());
+    }
+}
+void        MPDWalker::VisitSegmentBase         (const ISegmentBase *segmentBase)
+{
+    this->VisitElement(segmentBase);
+    this->VisitString(segmentBase->GetIndexRange());
+    this->VisitURLType(segmentBase->GetInitialization());
+    this->VisitURLType(segmentBase->GetRepresentationIndex());
+
+    const IMultipleSegmentBase *multipleSegmentBase = dynamic_cast<const IMultipleSegmentBase *>(segmentBase);
+
+    if (multipleSegmentBase == NULL)
+        return;
+
+    this->VisitURLType(multipleSegmentBase->GetBitstreamSwitching());
+
+    const ISegmentTimeline *segmentTimeline = multipleSegmentBase->GetSegmentTimeline();
+
+    if (segmentTimeline)
+    {
+        this->VisitElement(segmentTimeline);
+
+        for (size_t i = 0; i < segmentTimeline->GetTimelines().size(); i++)
+            this->VisitElement(segmentTimeline->GetTimelines().at(i));
+    }
+}
+void        MPDWalker::VisitBaseUrls            (const std::vector<IBaseUrl *> &baseUrls)
+{
+    for (size_t i = 0; i < baseUrls.size(); i++)
+    {
+        this->VisitElement(baseUrls.at(i));
+        this->VisitString(baseUrls.at(i)->GetUrl());
+        this->VisitString(baseUrls.at(i)->GetServiceLocation());
+        this->VisitString(baseUrls.at(i)->GetByteRange());
+    }
+}
+void        MPDWalker::VisitDescriptors         (const std::vector<IDescriptor *> &descriptors)
+{
+    for (size_t i = 0; i < descriptors.size(); i++)
+    {
+        this->VisitElement(descriptors.at(i));
+        this->VisitString(descriptors.at(i)->GetSchemeIdUri());
+        this->VisitString(descriptors.at(i)->GetValue());
+    }
+}
+void        MPDWalker::VisitURLType             (const IURLType *urlType)
+{
+    if (urlType == NULL)
+        return;
+
+    this->VisitElement(urlType);
+    this->VisitString(urlType->GetSourceURL());
+    this->VisitString(urlType->GetRange());
+}
+void        MPDWalker::VisitElement             (const IMPDElement *element)
+{
+    this->elements++;
+
+    for (size_t i = 0; i < element->GetRawAttributeCount(); i++)
+    {
+        this->VisitString(element->GetRawAttributeKey(i));
+        this->VisitString(element->GetRawAttributeValue(i));
+    }
+
+    for (size_t i = 0; i < element->GetAdditionalSubNodes().size(); i++)
+        this->VisitNode(element->GetAdditionalSubNodes().at(i));
+}
+void        MPDWalker::VisitNode                (const INode *node)
+{
+    this->elements++;
+    this->VisitString(node->GetName());
+    this->VisitString(node->GetText());
+
+    for (size_t i = 0; i < node->GetAttributeCount(); i++)
+    {
+        this->VisitString(node->GetAttributeKey(i));
+        this->VisitString(node->GetAttributeValue(i));
+    }
+
+    for (size_t i = 0; i < node->GetNodes().size(); i++)
+        this->VisitNode(node->GetNodes().at(i));
+}
+void        MPDWalker::VisitString              (const std::string &value)
+{
+    this->stringBytes += value.size();
+}
+void        MPDWalker::VisitStrings             (const std::vector<std::string> &values)
+{
+    for (size_t i = 0; i < values.size(); i++)
+        this->VisitString(values.at(i));
+}
@@ -0,0 +1,57 @@
+/*
+ * MPDWalker.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MPDWALKER_H_
+#define MPDWALKER_H_
+
+#include "config.h"
+
+#include "IMPD.h"
+
+namespace libdashbenchmark
+{
+    /*
+     *  Visits every element of an MPD through the public interfaces the way a client reads a manifest: all string
+     *  attributes, the raw attributes and the additional sub nodes of each element. Only the getters that hand out
+     *  references are used, so a walk over an MPD that has been walked before must not allocate.
+     */
+    class MPDWalker
+    {
+        public:
+            MPDWalker           ();
+            virtual ~MPDWalker  ();
+
+            void        Walk            (const dash::mpd::IMPD *mpd);
+            uint64_t    GetElements     () const;
+            uint64_t    GetStringBytes  () const;
+
+        private:
+            uint64_t    elements;
+            uint64_t    stringBytes;
+
+            void    VisitPeriod             (const dash::mpd::IPeriod *period);
+            void    VisitAdaptationSet      (const dash::mpd::IAdaptationSet *adaptationSet);
+            void    VisitRepresentation     (const dash::mpd::IRepresentation *representation);
+            void    VisitRepresentationBase (const dash::mpd::IRepresentationBase *representationBase);
+            void    VisitSegmentInformation (const dash::mpd::ISegmentBase *segmentBase, const dash::mpd::ISegmentList *segmentList,
+                                             const dash::mpd::ISegmentTemplate *segmentTemplate);
+            void    VisitSegmentBase        (const dash::mpd::ISegmentBase *segmentBase);
+            void    VisitBaseUrls           (const std::vector<dash::mpd::IBaseUrl *> &baseUrls);
+            void    VisitDescriptors        (const std::vector<dash::mpd::IDescriptor *> &descriptors);
+            void    VisitURLType            (const dash::mpd::IURLType *urlType);
+            void    VisitElement            (const dash::mpd::IMPDElement *element);
+            void    VisitNode               (const dash::xml::INode *node);
+            void    VisitString             (const std::string &value);
+            void    VisitStrings            (const std::vector<std::string> &values);
+    };
+}
+
+#endif /* MPDWALKER_H_ */
@@ -0,0 +1,71 @@
+/*
+ * Measurement.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "Measurement.h"
+
+#if defined _WIN32 || defined _WIN64
+    #include <Windows.h>
+    #include <Psapi.h>
+#else
+    #include <sys/time.h>
+    #include <sys/resource.h>
+    #include <unistd.h>
+#endif
+
+using namespace libdashbenchmark;
+
+uint64_t    Measurement::GetTimeInUsec  ()
+{
+#if defined _WIN32 || defined _WIN64
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t) (counter.QuadPart * 1000000 / frequency.QuadPart);
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+
+    return (uint64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+uint64_t    Measurement::GetPeakRSSInKB ()
+{
+#if defined _WIN32 || defined _WIN64
+    PROCESS_MEMORY_COUNTERS counters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    #if defined __APPLE__
+        return usage.ru_maxrss / 1024;
+    #else
+        return usage.ru_maxrss;
+    #endif
+#endif
+}
+uint32_t    Measurement::GetProcessorCount  ()
+{
+#if defined _WIN32 || defined _WIN64
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? (uint32_t) count : 1;
+#endif
+}
@@ -0,0 +1,30 @@
+/*
+ * Measurement.h
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#ifndef MEASUREMENT_H_
+#define MEASUREMENT_H_
+
+#include "config.h"
+
+namespace libdashbenchmark
+{
+    class Measurement
+    {
+        public:
+            static uint64_t GetTimeInUsec       ();
+            static uint64_t GetPeakRSSInKB      ();
+            static uint64_t GetAllocatedBytes   ();
+            static uint64_t GetAllocations      ();
+            static uint32_t GetProcessorCount   ();
+    };
+}
+
+#endif /* MEASUREMENT_H_ */
@@ -0,0 +1,1501 @@
+/*
+ * libdash_benchmark.cpp
+ *****************************************************************************
+ * Copyright (C) 2012, bitmovin Softwareentwicklung OG, All Rights Reserved
+ *
+ * Email: libdash-dev@vicky.bitmovin.net
+ *
+ * This source code and its use and distribution, is subject to the terms
+ * and conditions of the applicable license agreement.
+ *****************************************************************************/
+
+#include "libdash.h"
+#include "MPDGenerator.h"
+#include "MPDWalker.h"
+#include "BuildTimer.h"
+#include "Measurement.h"
+#include "HTTPStandIn.h"
+#include "../libdash/source/xml/DOMParser.h"
+#include "../libdash/source/mpd/MPD.h"
+#include "../libdash/source/mpd/SegmentIndex.h"
+#include "../libdash/source/portable/MultiThreading.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <zlib.h>
+
+#if !defined _WIN32 && !defined _WIN64
+    #include <unistd.h>
+    #include <sys/wait.h>
+#endif
+
+using namespace dash;
+using namespace dash::mpd;
+using namespace libdashbenchmark;
+using namespace std;
+
+static string readFile(const string &path)
+{
+    ifstream file(path.c_str(), ios::in | ios::binary);
+    stringstream ss;
+    ss << file.rdbuf();
+
+    return ss.str();
+}
+
+/*
+ *  Writes the gzip archive of a manifest that the gzip modes read.
+ */
+static bool writeGzip(const string &path, const string &gzipPath)
+{
+    string  data    = readFile(path);
+    gzFile  file    = gzopen(gzipPath.c_str(), "wb");
+
+    if (file == NULL)
+        return false;
+
+    bool ok = data.size() && gzwrite(file, data.data(), (unsigned int) data.size()) == (int) data.size();
+
+    return gzclose(file) == Z_OK && ok;
+}
+/*
+ *  Inflates a gzip archive into a temporary file, which is how compressed manifests had to be opened before the parser
+ *  could read them itself.
+ */
+static bool inflateToFile(const string &gzipPath, const string &path)
+{
+    gzFile  file    = gzopen(gzipPath.c_str(), "rb");
+    FILE    *out    = fopen(path.c_str(), "wb");
+    char    chunk[65536];
+    int     read    = 0;
+    bool    ok      = file != NULL && out != NULL;
+
+    while (ok && (read = gzread(file, chunk, sizeof(chunk))) > 0)
+        ok = fwrite(chunk, 1, read, out) == (size_t) read;
+
+    if (file)
+        ok = gzclose(file) == Z_OK && read == 0 && ok;
+    if (out)
+        ok = fclose(out) == 0 && ok;
+
+    return ok;
+}
+/*
+ *  Parses the MPD with the node tree (DOMParser::Parse and Node::ToMPD), the streaming builder
+ *  (DOMParser::BuildMPD), from a buffer that is already in memory, from a mapped file, from a mapped file into an
+ *  arena or loads it from a snapshot written beforehand and prints one JSON line with the results. teardown_ms is the
+ *  time spent deleting the MPD. The gzip modes open a gzip archive of the MPD: streamed from disk, mapped into memory or
+ *  inflated into a temporary file first.
+ *  Every mode runs in its own process on POSIX systems so that the peak RSS is not shared.
+ */
+static bool run(const string &mode, const string &path, size_t iterations)
+{
+    IDASHManager    *manager    = CreateDashManager();
+    string          buffer;
+
+    if (mode == "buffer")
+        buffer = readFile(path);
+
+    if (mode == "arena")
+        manager->SetArenaAllocation(true);
+
+    string snapshotPath = path + ".mpdsnap";
+    string gzipPath     = path + ".gz";
+    string inflatedPath = path + ".inflated";
+
+    if (mode.substr(0,4) == "gzip" && !writeGzip(path, gzipPath))
+    {
+        manager->Delete();
+        return false;
+    }
+
+    if (mode == "snapshot")
+    {
+        IMPD *mpd = manager->Open(path.c_str(), path);
+
+        if (mpd == NULL || !manager->WriteSnapshot(mpd, snapshotPath.c_str()))
+        {
+            delete mpd;
+            manager->Delete();
+            return false;
+        }
+
+        delete mpd;
+    }
+
+    uint64_t    rssBefore   = Measurement::GetPeakRSSInKB();
+    uint64_t    start       = Measurement::GetTimeInUsec();
+    uint64_t    teardown    = 0;
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        IMPD *mpd = NULL;
+
+        if (mode == "tree")
+        {
+            xml::DOMParser parser(path);
+            if (parser.Parse())
+                mpd = parser.GetRootNode()->ToMPD();
+        }
+        else if (mode == "stream")
+        {
+            xml::DOMParser parser(path);
+            mpd = parser.BuildMPD();
+        }
+        else if (mode == "buffer")
+        {
+            mpd = manager->Open(buffer.data(), buffer.size(), path);
+        }
+        else if (mode == "snapshot")
+        {
+            mpd = manager->OpenSnapshot(snapshotPath.c_str());
+        }
+        else if (mode == "gzip")
+        {
+            mpd = manager->Open(&gzipPath[0]);
+        }
+        else if (mode == "gzip-mapped")
+        {
+            mpd = manager->Open(gzipPath.c_str(), path);
+        }
+        else if (mode == "gzip-tempfile")
+        {
+            if (inflateToFile(gzipPath, inflatedPath))
+                mpd = manager->Open(inflatedPath.c_str(), path);
+
+            remove(inflatedPath.c_str());
+        }
+        else
+        {
+            mpd = manager->Open(path.c_str(), path);
+        }
+
+        if (mpd == NULL)
+        {
+            manager->Delete();
+            return false;
+        }
+
+        uint64_t deleteStart = Measurement::GetTimeInUsec();
+        delete mpd;
+        teardown += Measurement::GetTimeInUsec() - deleteStart;
+    }
+
+    uint64_t    end         = Measurement::GetTimeInUsec();
+    uint64_t    rssAfter    = Measurement::GetPeakRSSInKB();
+
+    printf("{\"benchmark\":\"parse\",\"mode\":\"%s\",\"file\":\"%s\",\"iterations\":%u,\"wall_ms\":%.3f,\"teardown_ms\":%.3f,\"peak_rss_kb\":%llu,\"peak_rss_delta_kb\":%llu}\n",
+           mode.c_str(), path.c_str(), (unsigned int) iterations, (end - start) / 1000.0 / iterations,
+           teardown / 1000.0 / iterations,
+           (unsigned long long) rssAfter, (unsigned long long) (rssAfter - rssBefore));
+    fflush(stdout);
+
+    manager->Delete();
+    return true;
+}
+/*
+ *  Times the phases of the node tree path separately: reading the document into nodes (DOMParser::Parse), converting
+ *  them into the MPD objects (Node::ToMPD) and deleting the MPD. The allocation counts are those of each phase, the
+ *  node tree is freed with the parser after the conversion and is not part of the delete phase.
+ */
+static bool runPhases(const string &path, size_t iterations)
+{
+    uint64_t parse              = 0;
+    uint64_t convert            = 0;
+    uint64_t teardown           = 0;
+    uint64_t parseAllocations   = 0;
+    uint64_t convertAllocations = 0;
+    uint64_t retainedBytes      = 0;
+    uint64_t rssBefore          = Measurement::GetPeakRSSInKB();
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        MPD *mpd = NULL;
+
+        {
+            xml::DOMParser parser(path);
+
+            uint64_t allocations    = Measurement::GetAllocations();
+            uint64_t start          = Measurement::GetTimeInUsec();
+
+            if (!parser.Parse())
+                return false;
+
+            parse              += Measurement::GetTimeInUsec() - start;
+            parseAllocations   += Measurement::GetAllocations() - allocations;
+
+            uint64_t bytes  = Measurement::GetAllocatedBytes();
+            allocations     = Measurement::GetAllocations();
+            start           = Measurement::GetTimeInUsec();
+
+            mpd = parser.GetRootNode()->ToMPD();
+
+            convert            += Measurement::GetTimeInUsec() - start;
+            convertAllocations += Measurement::GetAllocations() - allocations;
+            retainedBytes       = Measurement::GetAllocatedBytes() - bytes;
+        }
+
+        uint64_t start = Measurement::GetTimeInUsec();
+        delete mpd;
+        teardown += Measurement::GetTimeInUsec() - start;
+    }
+
+    uint64_t rssAfter = Measurement::GetPeakRSSInKB();
+
+    printf("{\"benchmark\":\"phases\",\"file\":\"%s\",\"iterations\":%u,\"parse_ms\":%.3f,\"to_mpd_ms\":%.3f,\"delete_ms\":%.3f,"
+           "\"parse_allocations\":%llu,\"to_mpd_allocations\":%llu,\"mpd_bytes\":%llu,\"peak_rss_kb\":%llu,\"peak_rss_delta_kb\":%llu}\n",
+           path.c_str(), (unsigned int) iterations, parse / 1000.0 / iterations, convert / 1000.0 / iterations, teardown / 1000.0 / iterations,
+           (unsigned long long) (parseAllocations / iterations), (unsigned long long) (convertAllocations / iterations),
+           (unsigned long long) retainedBytes, (unsigned long long) rssAfter, (unsigned long long) (rssAfter - rssBefore));
+    fflush(stdout);
+
+    return true;
+}
+/*
+ *  Reports the heap bytes that stay allocated while the MPD object graph is alive together with the statistics of
+ *  its string pool. referenced_bytes is what the pooled strings would occupy if every handle held its own copy.
+ */
+static bool runMemory(const string &path)
+{
+    uint64_t    bytesBefore         = Measurement::GetAllocatedBytes();
+    uint64_t    allocationsBefore   = Measurement::GetAllocations();
+    MPD         *mpd                = NULL;
+
+    {
+        xml::DOMParser parser(path);
+        mpd = parser.BuildMPD();
+    }
+
+    if (mpd == NULL)
+        return false;
+
+    uint64_t            bytesAfter          = Measurement::GetAllocatedBytes();
+    uint64_t            allocationsAfter    = Measurement::GetAllocations();
+    helpers::StringPool *pool               = mpd->GetStringPool();
+
+    printf("{\"benchmark\":\"memory\",\"file\":\"%s\",\"retained_bytes\":%llu,\"allocations\":%llu,\"pool_strings\":%u,\"pool_bytes\":%u,\"pool_references\":%u,\"referenced_bytes\":%u}\n",
+           path.c_str(), (unsigned long long) (bytesAfter - bytesBefore), (unsigned long long) (allocationsAfter - allocationsBefore),
+           (unsigned int) pool->GetStringCount(), (unsigned int) pool->GetStringBytes(),
+           (unsigned int) pool->GetReferenceCount(), (unsigned int) pool->GetReferencedBytes());
+    fflush(stdout);
+
+    delete mpd;
+    return true;
+}
+/*
+ *  Opens a manifest with many Periods while the Periods are converted on 1, 2, 4 and 8 threads and prints one JSON line
+ *  per thread count. speedup is relative to the conversion on the calling thread, it is bounded by the processors.
+ */
+static bool runPeriods(const string &path, size_t iterations)
+{
+    static const size_t threadCounts[] = { 1, 2, 4, 8 };
+
+    IDASHManager    *manager    = CreateDashManager();
+    double          serial      = 0;
+    size_t          periods     = 0;
+
+    for (size_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+    {
+        manager->SetPeriodConversionThreads(threadCounts[t]);
+
+        uint64_t start = Measurement::GetTimeInUsec();
+
+        for (size_t i = 0; i < iterations; i++)
+        {
+            IMPD *mpd = manager->Open(path.c_str(), path);
+
+            if (mpd == NULL)
+            {
+                manager->Delete();
+                return false;
+            }
+
+            periods = mpd->GetPeriods().size();
+            delete mpd;
+        }
+
+        double wall = (Measurement::GetTimeInUsec() - start) / 1000.0 / iterations;
+
+        if (t == 0)
+            serial = wall;
+
+        printf("{\"benchmark\":\"periods\",\"file\":\"%s\",\"iterations\":%u,\"periods\":%u,\"threads\":%u,\"processors\":%u,\"wall_ms\":%.3f,\"speedup\":%.2f}\n",
+               path.c_str(), (unsigned int) iterations, (unsigned int) periods, (unsigned int) threadCounts[t],
+               (unsigned int) Measurement::GetProcessorCount(), wall, serial / wall);
+        fflush(stdout);
+    }
+
+    manager->Delete();
+    return true;
+}
+/*
+ *  Reads every element of the MPD through the public interfaces. walk_allocations counts the first walk, which is the one
+ *  a player makes; it creates the objects of the packed SegmentURLs and allocates nothing else. The following walks
+ *  must not allocate at all, the run fails if repeat_walk_allocations is not 0.
+ */
+static bool runWalk(const string &path, size_t iterations)
+{
+    IDASHManager    *manager    = CreateDashManager();
+    IMPD            *mpd        = manager->Open(path.c_str(), path);
+
+    if (mpd == NULL)
+    {
+        manager->Delete();
+        return false;
+    }
+
+    MPDWalker   first;
+    uint64_t    allocations         = Measurement::GetAllocations();
+    uint64_t    start               = Measurement::GetTimeInUsec();
+
+    first.Walk(mpd);
+
+    uint64_t    walkAllocations     = Measurement::GetAllocations() - allocations;
+    uint64_t    walk                = Measurement::GetTimeInUsec() - start;
+
+    allocations = Measurement::GetAllocations();
+    start       = Measurement::GetTimeInUsec();
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        MPDWalker walker;
+        walker.Walk(mpd);
+    }
+
+    uint64_t    repeatAllocations   = Measurement::GetAllocations() - allocations;
+    uint64_t    repeat              = Measurement::GetTimeInUsec() - start;
+
+    printf("{\"benchmark\":\"walk\",\"file\":\"%s\",\"iterations\":%u,\"elements\":%llu,\"string_bytes\":%llu,\"walk_ms\":%.3f,"
+           "\"walk_allocations\":%llu,\"repeat_walk_ms\":%.3f,\"repeat_walk_allocations\":%llu}\n",
+           path.c_str(), (unsigned int) iterations, (unsigned long long) first.GetElements(), (unsigned long long) first.GetStringBytes(),
+           walk / 1000.0, (unsigned long long) walkAllocations, repeat / 1000.0 / iterations, (unsigned long long) (repeatAllocations / iterations));
+    fflush(stdout);
+
+    delete mpd;
+    manager->Delete();
+    return repeatAllocations == 0;
+}
+/*
+ *  Measures how long it takes until the first AdaptationSet and the first Period are handed to a build observer,
+ *  compared to the time of the complete Open, with the Periods converted on the calling thread and on 4 workers.
+ *  The time to the first AdaptationSet should not grow with the size of the manifest. The workers report each
+ *  AdaptationSet as soon as it is converted, but only after the node tree of its Period has been read.
+ */
+static bool runProgressive(const string &path, size_t iterations)
+{
+    static const size_t threadCounts[] = { 1, 4 };
+
+    IDASHManager    *manager    = CreateDashManager();
+    BuildTimer      timer;
+
+    manager->AttachBuildObserver(&timer);
+
+    for (size_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++)
+    {
+        manager->SetPeriodConversionThreads(threadCounts[t]);
+
+        uint64_t    wall                = 0;
+        uint64_t    firstAdaptationSet  = 0;
+        uint64_t    firstPeriod         = 0;
+
+        for (size_t i = 0; i < iterations; i++)
+        {
+            timer.Start();
+
+            uint64_t    start   = Measurement::GetTimeInUsec();
+            IMPD        *mpd    = manager->Open(path.c_str(), path);
+
+            wall += Measurement::GetTimeInUsec() - start;
+
+            size_t adaptationSets = 0;
+
+            for (size_t j = 0; mpd && j < mpd->GetPeriods().size(); j++)
+                adaptationSets += mpd->GetPeriods().at(j)->GetAdaptationSets().size();
+
+            if (mpd == NULL || timer.GetPeriods() != mpd->GetPeriods().size() || timer.GetAdaptationSets() != adaptationSets)
+            {
+                delete mpd;
+                manager->Delete();
+                return false;
+            }
+
+            firstAdaptationSet  += timer.GetFirstAdaptationSetTime();
+            firstPeriod         += timer.GetFirstPeriodTime();
+            delete mpd;
+        }
+
+        printf("{\"benchmark\":\"progressive\",\"file\":\"%s\",\"iterations\":%u,\"threads\":%u,\"periods\":%llu,\"adaptation_sets\":%llu,"
+               "\"wall_ms\":%.3f,\"first_adaptation_set_ms\":%.3f,\"first_period_ms\":%.3f}\n",
+               path.c_str(), (unsigned int) iterations, (unsigned int) threadCounts[t], (unsigned long long) timer.GetPeriods(),
+               (unsigned long long) timer.GetAdaptationSets(), wall / 1000.0 / iterations, firstAdaptationSet / 1000.0 / iterations,
+               firstPeriod / 1000.0 / iterations);
+        fflush(stdout);
+    }
+
+    manager->DetachBuildObserver(&timer);
+    manager->Delete();
+    return true;
+}
+/*
+ *  The state shared by the threads of runConcurrent. Every thread takes the next document of the corpus until
+ *  all of them have been parsed and compares the number of Periods with the one of the serial run.
+ */
+struct ConcurrentRun
+{
+    IDASHManager            *manager;
+    const vector<string>    *corpus;
+    const vector<size_t>    *periods;
+    size_t                  documents;
+    size_t                  next;
+    bool                    failed;
+    CRITICAL_SECTION        mutex;
+};
+static void* parseConcurrently(void *data)
+{
+    ConcurrentRun *run = (ConcurrentRun *) data;
+
+    while (true)
+    {
+        EnterCriticalSection(&run->mutex);
+        size_t document = run->next++;
+        LeaveCriticalSection(&run->mutex);
+
+        if (document >= run->documents)
+            break;
+
+        const string    &buffer = run->corpus->at(document % run->corpus->size());
+        IMPD            *mpd    = run->manager->Open(buffer.data(), buffer.size(), "http://localhost/corpus.mpd");
+        bool            valid   = mpd != NULL && mpd->GetPeriods().size() == run->periods->at(document % run->corpus->size());
+
+        delete mpd;
+
+        if (!valid)
+        {
+            EnterCriticalSection(&run->mutex);
+            run->failed = true;
+            LeaveCriticalSection(&run->mutex);
+        }
+    }
+
+    return NULL;
+}
+/*
+ *  Parses a corpus of small and medium manifests, as a monitoring service that watches many streams would, with one
+ *  shared manager on 1, 2, 4, ... threads up to the number of processors. Every document of the corpus is parsed
+ *  iterations times per thread count. The run fails if an MPD differs from the one parsed on a single thread.
+ */
+static bool runConcurrent(size_t iterations)
+{
+    vector<string> corpus;
+
+    for (size_t i = 0; i < 64; i++)
+    {
+        MPDGenerator generator;
+        generator.SetPeriods(1 + i % 4);
+        generator.SetAdaptationSets(1 + i % 3);
+        generator.SetRepresentations(2 + i % 7);
+        generator.SetSegmentURLs(20 + (i % 8) * 25);
+        generator.SetContentProtections(i % 5 == 0 ? 3 : 0);
+        generator.SetTimelineEntries(i % 6 == 0 ? 500 : 0);
+        corpus.push_back(generator.Generate());
+    }
+
+    IDASHManager    *manager    = CreateDashManager();
+    vector<size_t>  periods;
+
+    for (size_t i = 0; i < corpus.size(); i++)
+    {
+        IMPD *mpd = manager->Open(corpus.at(i).data(), corpus.at(i).size(), "http://localhost/corpus.mpd");
+
+        if (mpd == NULL)
+        {
+            manager->Delete();
+            return false;
+        }
+
+        periods.push_back(mpd->GetPeriods().size());
+        delete mpd;
+    }
+
+    uint32_t    processors  = Measurement::GetProcessorCount();
+    double      serial      = 0;
+    bool        ok          = true;
+
+    for (uint32_t threadCount = 1; ok; threadCount = threadCount * 2 < processors ? threadCount * 2 : processors)
+    {
+        ConcurrentRun run;
+        run.manager     = manager;
+        run.corpus      = &corpus;
+        run.periods     = &periods;
+        run.documents   = corpus.size() * iterations;
+        run.next        = 0;
+        run.failed      = false;
+        InitializeCriticalSection(&run.mutex);
+
+        vector<THREAD_HANDLE>   threads;
+        uint64_t                start   = Measurement::GetTimeInUsec();
+
+        for (uint32_t i = 0; i < threadCount; i++)
+        {
+            THREAD_HANDLE thread = CreateThreadPortable(parseConcurrently, &run);
+
+            if (thread != NULL)
+                threads.push_back(thread);
+        }
+
+        for (size_t i = 0; i < threads.size(); i++)
+        {
+            JoinThread(threads.at(i));
+            DestroyThreadPortable(threads.at(i));
+        }
+
+        double wall = (Measurement::GetTimeInUsec() - start) / 1000.0;
+
+        DeleteCriticalSection(&run.mutex);
+
+        if (threadCount == 1)
+            serial = wall;
+
+        ok = !threads.empty() && !run.failed && run.next >= run.documents;
+
+        printf("{\"benchmark\":\"concurrent\",\"documents\":%u,\"threads\":%u,\"processors\":%u,\"wall_ms\":%.3f,"
+               "\"documents_per_sec\":%.1f,\"speedup\":%.2f,\"valid\":%s}\n",
+               (unsigned int) run.documents, (unsigned int) threads.size(), (unsigned int) processors, wall,
+               run.documents * 1000.0 / wall, serial / wall, ok ? "true" : "false");
+        fflush(stdout);
+
+        if (threadCount >= processors)
+            break;
+    }
+
+    manager->Delete();
+    return ok;
+}
+static size_t countTimelineEntries(const IMPD *mpd)
+{
+    size_t entries = 0;
+
+    for (size_t p = 0; p < mpd->GetPeriods().size(); p++)
+    {
+        const vector<IAdaptationSet *> &adaptationSets = mpd->GetPeriods().at(p)->GetAdaptationSets();
+
+        for (size_t a = 0; a < adaptationSets.size(); a++)
+        {
+            ISegmentTemplate *segmentTemplate = adaptationSets.at(a)->GetSegmentTemplate();
+
+            if (segmentTemplate && segmentTemplate->GetSegmentTimeline())
+                entries += segmentTemplate->GetSegmentTimeline()->GetTimelines().size();
+        }
+    }
+
+    return entries;
+}
+/*
+ *  Returns true if both MPDs consist of the same elements and strings and have as many timeline entries.
+ */
+static bool isSameMPD(const IMPD *mpd, const IMPD *expected)
+{
+    MPDWalker walker;
+    MPDWalker reference;
+
+    walker.Walk(mpd);
+    reference.Walk(expected);
+
+    return walker.GetElements() == reference.GetElements() && walker.GetStringBytes() == reference.GetStringBytes() &&
+           countTimelineEntries(mpd) == countTimelineEntries(expected) && mpd->GetPublishTime() == expected->GetPublishTime();
+}
+/*
+ *  Opens the current MPD from the stand-in, then serves its next version together with the given patch document and
+ *  refreshes the MPD by its URL. If isPatched the refresh has to fetch the patch and nothing else, otherwise it has to
+ *  fall back to the whole MPD. The bytes are what the stand-in sent for the refresh.
+ */
+static bool refreshFromStandIn(IDASHManager *manager, HTTPStandIn &server, const string &manifest, const string &update, const string &patch,
+                               const IMPD *expected, bool isPatched, uint64_t &bytes)
+{
+    string url = server.GetUrl("/live/benchmark.mpd");
+
+    server.SetResource("/live/benchmark.mpd", manifest);
+    server.SetResource("/live/benchmark.mpp", "");
+
+    IMPD *mpd = manager->Open((char *) url.c_str());
+
+    if (mpd == NULL)
+        return false;
+
+    server.SetResource("/live/benchmark.mpd", update);
+    server.SetResource("/live/benchmark.mpp", patch);
+    server.ResetCounters();
+
+    IRefreshReport *report = manager->Refresh(mpd, (char *) url.c_str());
+
+    bytes = server.GetBytesSent();
+
+    bool ok = report && isSameMPD(mpd, expected) && server.GetRequests("/live/benchmark.mpp") == 1 &&
+              server.GetRequests("/live/benchmark.mpd") == (isPatched ? 0 : 1);
+
+    delete report;
+    delete mpd;
+    return ok;
+}
+/*
+ *  Refreshes a live MPD with a long SegmentTimeline to its next version, which has one more S element per timeline and
+ *  an inserted ad Period, once with the whole new MPD and once with the MPD Patch document that describes the difference.
+ *  The times include parsing and merging, the patch has to be applied faster than the whole MPD is merged.
+ *  The refresh is repeated through an HTTP stand-in for the origin: the announced patch has to be fetched instead of
+ *  the MPD, a missing patch and a patch for another version of the MPD have to fall back to the whole MPD. The bytes
+ *  are what each of these refreshes transferred. Every refresh has to result in the same MPD as the new version.
+ *  A patch that fails halfway while the MPD has not changed has to be undone by fetching the MPD unconditionally,
+ *  the stand-in would answer a conditional request with 304 and leave the half patched MPD.
+ */
+static bool runPatch(size_t iterations)
+{
+    static const size_t timelineEntries = 10000;
+
+    MPDGenerator current;
+    current.SetRepresentations(6);
+    current.SetTimelineEntries(timelineEntries);
+    current.SetPublishTime("2013-04-12T10:00:00Z");
+
+    MPDGenerator next = current;
+    next.SetTimelineEntries(timelineEntries + 1);
+    next.SetPeriods(2);
+    next.SetAdSplices(true);
+    next.SetPublishTime("2013-04-12T10:00:02Z");
+
+    MPDGenerator previous = current;
+    previous.SetPublishTime("2013-04-12T09:59:58Z");
+
+    HTTPStandIn server;
+
+    if (!server.Start())
+        return false;
+
+    string          url         = server.GetUrl("/live/benchmark.mpd");
+    string          manifest    = current.Generate();
+    string          update      = next.Generate();
+    string          patch       = current.GeneratePatch(next);
+    string          stalePatch  = previous.GeneratePatch(next);
+    string          brokenPatch = patch;
+    IDASHManager    *manager    = CreateDashManager();
+    IMPD            *expected   = manager->Open(update.data(), update.size(), url);
+    IMPD            *unchanged  = manager->Open(manifest.data(), manifest.size(), url);
+    uint64_t        full        = 0;
+    uint64_t        patched     = 0;
+    bool            ok          = expected != NULL && unchanged != NULL;
+
+    /* the last operation of the broken patch fails after the others have been applied */
+    brokenPatch.insert(brokenPatch.rfind("</Patch>"), "  <remove sel=\"/MPD/Period[@id='missing']\"/>\n");
+
+    for (size_t i = 0; i < iterations && ok; i++)
+    {
+        IMPD *refreshed     = manager->Open(manifest.data(), manifest.size(), url);
+        IMPD *patchedMPD    = manager->Open(manifest.data(), manifest.size(), url);
+
+        uint64_t        start   = Measurement::GetTimeInUsec();
+        IRefreshReport  *report = refreshed ? manager->Refresh(refreshed, update.data(), update.size(), url) : NULL;
+
+        full += Measurement::GetTimeInUsec() - start;
+
+        start = Measurement::GetTimeInUsec();
+        IRefreshReport *patchReport = patchedMPD ? manager->ApplyPatch(patchedMPD, patch.data(), patch.size()) : NULL;
+
+        patched += Measurement::GetTimeInUsec() - start;
+
+        ok = report && patchReport && isSameMPD(refreshed, expected) && isSameMPD(patchedMPD, expected);
+
+        delete report;
+        delete patchReport;
+        delete refreshed;
+        delete patchedMPD;
+    }
+
+    uint64_t patchFetchBytes    = 0;
+    uint64_t fullFetchBytes     = 0;
+    uint64_t staleFetchBytes    = 0;
+    uint64_t brokenFetchBytes   = 0;
+
+    ok = ok && patched < full;
+    ok = ok && refreshFromStandIn(manager, server, manifest, update, patch, expected, true, patchFetchBytes);
+    ok = ok && refreshFromStandIn(manager, server, manifest, update, "", expected, false, fullFetchBytes);
+    ok = ok && refreshFromStandIn(manager, server, manifest, update, stalePatch, expected, false, staleFetchBytes);
+    ok = ok && refreshFromStandIn(manager, server, manifest, manifest, brokenPatch, unchanged, false, brokenFetchBytes);
+
+    printf("{\"benchmark\":\"patch\",\"iterations\":%u,\"timeline_entries\":%u,\"full_bytes\":%u,\"patch_bytes\":%u,\"full_refresh_ms\":%.3f,\"patch_apply_ms\":%.3f,"
+           "\"patch_fetch_bytes\":%llu,\"full_fetch_bytes\":%llu,\"stale_patch_fetch_bytes\":%llu,\"broken_patch_fetch_bytes\":%llu,\"valid\":%s}\n",
+           (unsigned int) iterations, (unsigned int) timelineEntries, (unsigned int) update.size(), (unsigned int) patch.size(),
+           full / 1000.0 / iterations, patched / 1000.0 / iterations, (unsigned long long) patchFetchBytes,
+           (unsigned long long) fullFetchBytes, (unsigned long long) staleFetchBytes, (unsigned long long) brokenFetchBytes, ok ? "true" : "false");
+    fflush(stdout);
+
+    delete expected;
+    delete unchanged;
+    manager->Delete();
+    server.Stop();
+    return ok;
+}
+/*
+ *  Generates the URLs of a SegmentTemplate that covers 24 hours with 2 second Segments: as Segment objects, as was
+ *  the only way before, one URL at a time into a buffer and the whole range in one call. A second run renders the
+ *  URLs of a long SegmentTimeline by time. The batch calls reuse their string, once it has grown they may only allocate
+ *  the template they bind to the Representation, the run fails if they allocate per URL or if the URLs differ.
+ *  Both batch calls also have to start in the third run of a short SegmentTimeline.
+ */
+static bool runTemplate(size_t iterations)
+{
+    static const char       *url        = "http://www.example.com/vod/benchmark.mpd";
+    static const uint32_t   segments    = 24 * 60 * 60 / 2;
+
+    string manifest = "<?xml version=\"1.0\"?>\n"
+                      "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" type=\"static\" mediaPresentationDuration=\"PT24H\" minBufferTime=\"PT2S\">\n"
+                      "  <Period>\n"
+                      "    <AdaptationSet mimeType=\"video/mp4\">\n"
+                      "      <SegmentTemplate timescale=\"1000\" duration=\"2000\" startNumber=\"1\" media=\"$RepresentationID$/$Bandwidth$/seg-$Number%06d$.m4s\"/>\n"
+                      "      <Representation id=\"video-1080p\" bandwidth=\"4800000\"/>\n"
+                      "    </AdaptationSet>\n"
+                      "  </Period>\n"
+                      "</MPD>\n";
+
+    /* three runs of S elements, Segments 8 to 17 start at 90 to 99 */
+    string runsManifest = "<?xml version=\"1.0\"?>\n"
+                          "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" type=\"static\" mediaPresentationDuration=\"PT100S\" minBufferTime=\"PT2S\">\n"
+                          "  <Period>\n"
+                          "    <AdaptationSet mimeType=\"video/mp4\">\n"
+                          "      <SegmentTemplate timescale=\"1\" startNumber=\"1\" media=\"seg-$Number$-$Time$.m4s\">\n"
+                          "        <SegmentTimeline><S t=\"0\" d=\"10\" r=\"4\"/><S d=\"20\" r=\"1\"/><S d=\"1\" r=\"9\"/></SegmentTimeline>\n"
+                          "      </SegmentTemplate>\n"
+                          "      <Representation id=\"video\" bandwidth=\"4800000\"/>\n"
+                          "    </AdaptationSet>\n"
+                          "  </Period>\n"
+                          "</MPD>\n";
+
+    MPDGenerator timeline;
+    timeline.SetAdaptationSets(1);
+    timeline.SetRepresentations(1);
+    timeline.SetTimelineEntries(segments);
+
+    string          timelineManifest    = timeline.Generate();
+    IDASHManager    *manager            = CreateDashManager();
+    IMPD            *mpd                = manager->Open(manifest.data(), manifest.size(), url);
+    IMPD            *timelineMPD        = manager->Open(timelineManifest.data(), timelineManifest.size(), url);
+    IMPD            *runsMPD            = manager->Open(runsManifest.data(), runsManifest.size(), url);
+
+    if (mpd == NULL || timelineMPD == NULL || runsMPD == NULL)
+    {
+        delete mpd;
+        delete timelineMPD;
+        delete runsMPD;
+        manager->Delete();
+        return false;
+    }
+
+    IAdaptationSet          *adaptationSet      = mpd->GetPeriods().at(0)->GetAdaptationSets().at(0);
+    IRepresentation         *representation     = adaptationSet->GetRepresentation().at(0);
+    ISegmentTemplate        *segmentTemplate    = adaptationSet->GetSegmentTemplate();
+    IAdaptationSet          *timelineSet        = timelineMPD->GetPeriods().at(0)->GetAdaptationSets().at(0);
+    ISegmentTemplate        *timelineTemplate   = timelineSet->GetSegmentTemplate();
+    const string            &timelineID         = timelineSet->GetRepresentation().at(0)->GetId();
+    string                  urls;
+    string                  timelineUrls;
+    vector<size_t>          offsets;
+    vector<size_t>          timelineOffsets;
+    uint64_t                objects             = 0;
+    uint64_t                single              = 0;
+    uint64_t                batch               = 0;
+    uint64_t                byTime              = 0;
+    uint64_t                batchAllocations    = 0;
+    size_t                  rendered            = 0;
+    size_t                  timelineRendered    = 0;
+    bool                    ok                  = true;
+
+    for (size_t i = 0; i < iterations && ok; i++)
+    {
+        uint64_t start = Measurement::GetTimeInUsec();
+
+        for (uint32_t n = 1; n <= segments; n++)
+            delete segmentTemplate->GetMediaSegmentFromNumber(mpd->GetBaseUrls(), representation->GetId(), representation->GetBandwidth(), n);
+
+        objects += Measurement::GetTimeInUsec() - start;
+
+        char buffer[256];
+
+        start = Measurement::GetTimeInUsec();
+
+        for (uint32_t n = 1; n <= segments; n++)
+            segmentTemplate->FormatMediaUrl(buffer, sizeof(buffer), representation->GetId(), representation->GetBandwidth(), n, 0);
+
+        single += Measurement::GetTimeInUsec() - start;
+
+        urls.clear();
+        offsets.clear();
+        timelineUrls.clear();
+        timelineOffsets.clear();
+
+        uint64_t allocations = Measurement::GetAllocations();
+
+        start = Measurement::GetTimeInUsec();
+        rendered = segmentTemplate->FormatMediaUrlsFromNumber(representation->GetId(), representation->GetBandwidth(), 1, segments, urls, offsets);
+        batch += Measurement::GetTimeInUsec() - start;
+
+        start = Measurement::GetTimeInUsec();
+        timelineRendered = timelineTemplate->FormatMediaUrlsFromTime(timelineID, 0, 0, 0xFFFFFFFFFFFFFFFFULL, timelineUrls, timelineOffsets);
+        byTime += Measurement::GetTimeInUsec() - start;
+
+        if (i > 0)
+            batchAllocations = std::max(batchAllocations, Measurement::GetAllocations() - allocations);
+
+        ok = rendered == segments && timelineRendered > 0 && timelineRendered == timelineOffsets.size();
+
+        /* the batch has to render the same URLs as the single calls */
+        for (uint32_t n = 1; n <= segments && ok; n += 997)
+        {
+            segmentTemplate->FormatMediaUrl(buffer, sizeof(buffer), representation->GetId(), representation->GetBandwidth(), n, 0);
+            ok = urls.compare(offsets.at(n - 1), strlen(buffer) + 1, buffer, strlen(buffer) + 1) == 0;
+        }
+    }
+
+    /* lookups that start two runs past the first one, where no Segment of the previous run is at hand */
+    ISegmentTemplate *runsTemplate = runsMPD->GetPeriods().at(0)->GetAdaptationSets().at(0)->GetSegmentTemplate();
+
+    urls.clear();
+    offsets.clear();
+    ok = ok && runsTemplate->FormatMediaUrlsFromNumber("video", 4800000, 10, 3, urls, offsets) == 3 && string(urls.c_str() + offsets.at(0)) == "seg-10-92.m4s";
+
+    urls.clear();
+    offsets.clear();
+    ok = ok && runsTemplate->FormatMediaUrlsFromTime("video", 4800000, 95, 97, urls, offsets) > 0 && string(urls.c_str() + offsets.at(0)) == "seg-13-95.m4s";
+
+    printf("{\"benchmark\":\"template\",\"iterations\":%u,\"segments\":%u,\"segment_objects_ms\":%.3f,\"format_url_ms\":%.3f,\"batch_number_us\":%.1f,"
+           "\"timeline_segments\":%u,\"batch_time_us\":%.1f,\"batch_allocations\":%llu}\n",
+           (unsigned int) iterations, (unsigned int) rendered, objects / 1000.0 / iterations, single / 1000.0 / iterations, (double) batch / iterations,
+           (unsigned int) timelineRendered, (double) byTime / iterations, (unsigned long long) batchAllocations);
+    fflush(stdout);
+
+    delete mpd;
+    delete timelineMPD;
+    delete runsMPD;
+    manager->Delete();
+    return ok && batchAllocations <= 8;
+}
+/*
+ *  Creates the Segments of a SegmentTemplate below a chain of three BaseURLs, once with the chain as it is written in
+ *  the MPD, which is combined and parsed again for every Segment, and once with the chain resolved per Representation.
+ *  The run fails if the Segments differ in their URL, host, port or path.
+ */
+static bool runBaseUrl(size_t iterations)
+{
+    static const char       *url        = "http://www.example.com/vod/benchmark.mpd";
+    static const uint32_t   segments    = 24 * 60 * 60 / 2;
+
+    string manifest = "<?xml version=\"1.0\"?>\n"
+                      "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" type=\"static\" mediaPresentationDuration=\"PT24H\" minBufferTime=\"PT2S\">\n"
+                      "  <BaseURL>http://cdn.example.com:8080/content/</BaseURL>\n"
+                      "  <Period>\n"
+                      "    <BaseURL>period-1/</BaseURL>\n"
+                      "    <AdaptationSet mimeType=\"video/mp4\">\n"
+                      "      <BaseURL>video/</BaseURL>\n"
+                      "      <SegmentTemplate timescale=\"1000\" duration=\"2000\" startNumber=\"1\" media=\"$RepresentationID$/seg-$Number%06d$.m4s\"/>\n"
+                      "      <Representation id=\"video-1080p\" bandwidth=\"4800000\"/>\n"
+                      "    </AdaptationSet>\n"
+                      "  </Period>\n"
+                      "</MPD>\n";
+
+    IDASHManager    *manager    = CreateDashManager();
+    IMPD            *mpd        = manager->Open(manifest.data(), manifest.size(), url);
+
+    if (mpd == NULL)
+    {
+        manager->Delete();
+        return false;
+    }
+
+    IPeriod                 *period             = mpd->GetPeriods().at(0);
+    IAdaptationSet          *adaptationSet      = period->GetAdaptationSets().at(0);
+    IRepresentation         *representation     = adaptationSet->GetRepresentation().at(0);
+    ISegmentTemplate        *segmentTemplate    = adaptationSet->GetSegmentTemplate();
+    vector<IBaseUrl *>      chain;
+    uint64_t                combined            = 0;
+    uint64_t                resolved            = 0;
+    bool                    ok                  = true;
+
+    chain.push_back(mpd->GetBaseUrls().at(0));
+    chain.push_back(period->GetBaseURLs().at(0));
+    chain.push_back(adaptationSet->GetBaseURLs().at(0));
+
+    for (size_t i = 0; i < iterations && ok; i++)
+    {
+        uint64_t start = Measurement::GetTimeInUsec();
+
+        for (uint32_t n = 1; n <= segments; n++)
+            delete segmentTemplate->GetMediaSegmentFromNumber(chain, representation->GetId(), representation->GetBandwidth(), n);
+
+        combined += Measurement::GetTimeInUsec() - start;
+
+        start = Measurement::GetTimeInUsec();
+
+        IResolvedBaseUrl    *baseUrl    = mpd->ResolveBaseUrl(period, adaptationSet, representation);
+        vector<IBaseUrl *>  baseUrls    (1, baseUrl);
+
+        for (uint32_t n = 1; n <= segments; n++)
+            delete segmentTemplate->GetMediaSegmentFromNumber(baseUrls, representation->GetId(), representation->GetBandwidth(), n);
+
+        resolved += Measurement::GetTimeInUsec() - start;
+
+        /* both ways have to create the same Segments */
+        for (uint32_t n = 1; n <= segments && ok; n += 997)
+        {
+            ISegment *expected  = segmentTemplate->GetMediaSegmentFromNumber(chain, representation->GetId(), representation->GetBandwidth(), n);
+            ISegment *actual    = segmentTemplate->GetMediaSegmentFromNumber(baseUrls, representation->GetId(), representation->GetBandwidth(), n);
+
+            network::IChunk *e = dynamic_cast<network::IChunk *>(expected);
+            network::IChunk *a = dynamic_cast<network::IChunk *>(actual);
+
+            ok = e && a && e->AbsoluteURI() == a->AbsoluteURI() && e->Host() == a->Host() && e->Port() == a->Port() && e->Path() == a->Path();
+
+            delete expected;
+            delete actual;
+        }
+
+        ok = ok && baseUrl->GetOrigin() == "http://cdn.example.com:8080";
+
+        delete baseUrl;
+    }
+
+    printf("{\"benchmark\":\"baseurl\",\"iterations\":%u,\"segments\":%u,\"combined_ms\":%.3f,\"resolved_ms\":%.3f}\n",
+           (unsigned int) iterations, (unsigned int) segments, combined / 1000.0 / iterations, resolved / 1000.0 / iterations);
+    fflush(stdout);
+
+    delete mpd;
+    manager->Delete();
+    return ok;
+}
+/*
+ *  Describes the Segments of a SegmentTemplate that covers 24 hours with 2 second Segments, once by creating a Segment
+ *  object for each of them and once by enumerating SegmentDescriptors. The enumeration reuses one descriptor and may not
+ *  allocate per Segment, the run fails if it does or if the URLs differ from the ones of the Segment objects.
+ */
+static bool runDescriptors(size_t iterations)
+{
+    static const char       *url        = "http://www.example.com/vod/benchmark.mpd";
+    static const uint32_t   segments    = 24 * 60 * 60 / 2;
+
+    string manifest = "<?xml version=\"1.0\"?>\n"
+                      "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" type=\"static\" mediaPresentationDuration=\"PT24H\" minBufferTime=\"PT2S\">\n"
+                      "  <BaseURL>http://cdn.example.com/content/</BaseURL>\n"
+                      "  <Period>\n"
+                      "    <AdaptationSet mimeType=\"video/mp4\">\n"
+                      "      <SegmentTemplate timescale=\"1000\" duration=\"2000\" startNumber=\"1\" initialization=\"$RepresentationID$/init.mp4\"\n"
+                      "                       media=\"$RepresentationID$/seg-$Number%06d$.m4s\"/>\n"
+                      "      <Representation id=\"video-1080p\" bandwidth=\"4800000\"/>\n"
+                      "    </AdaptationSet>\n"
+                      "  </Period>\n"
+                      "</MPD>\n";
+
+    IDASHManager    *manager    = CreateDashManager();
+    IMPD            *mpd        = manager->Open(manifest.data(), manifest.size(), url);
+
+    if (mpd == NULL)
+    {
+        manager->Delete();
+        return false;
+    }
+
+    IPeriod             *period             = mpd->GetPeriods().at(0);
+    IAdaptationSet      *adaptationSet      = period->GetAdaptationSets().at(0);
+    IRepresentation     *representation     = adaptationSet->GetRepresentation().at(0);
+    ISegmentTemplate    *segmentTemplate    = adaptationSet->GetSegmentTemplate();
+    IResolvedBaseUrl    *baseUrl            = mpd->ResolveBaseUrl(period, adaptationSet, representation);
+    vector<IBaseUrl *>  baseUrls            (1, baseUrl);
+    ISegmentEnumerator  *enumerator         = mpd->CreateSegmentEnumerator(period, adaptationSet, representation);
+    SegmentDescriptor   descriptor;
+    uint64_t            objects             = 0;
+    uint64_t            described           = 0;
+    uint64_t            allocations         = 0;
+    uint64_t            media               = 0;
+    bool                ok                  = enumerator->GetMediaSegmentCount() == segments;
+
+    for (size_t i = 0; i < iterations && ok; i++)
+    {
+        uint64_t start = Measurement::GetTimeInUsec();
+
+        for (uint32_t n = 1; n <= segments; n++)
+            delete segmentTemplate->GetMediaSegmentFromNumber(baseUrls, representation->GetId(), representation->GetBandwidth(), n);
+
+        objects += Measurement::GetTimeInUsec() - start;
+
+        enumerator->Reset();
+        media = 0;
+
+        uint64_t allocated = Measurement::GetAllocations();
+
+        start = Measurement::GetTimeInUsec();
+
+        while (enumerator->Next(descriptor))
+            if (descriptor.type == dash::metrics::MediaSegment)
+                media++;
+
+        described += Measurement::GetTimeInUsec() - start;
+
+        if (i > 0)
+            allocations = std::max(allocations, Measurement::GetAllocations() - allocated);
+
+        ok = media == segments;
+
+        /* the descriptors have to address the same URLs as the Segment objects */
+        enumerator->Reset();
+
+        for (uint64_t n = 0; enumerator->Next(descriptor) && ok; n++)
+        {
+            if (n % 997 != 0 || descriptor.type != dash::metrics::MediaSegment)
+                continue;
+
+            ISegment        *expected   = segmentTemplate->GetMediaSegmentFromNumber(baseUrls, representation->GetId(), representation->GetBandwidth(), (uint32_t) descriptor.number);
+            ISegment        *actual     = enumerator->ToSegment(descriptor);
+            network::IChunk *e          = dynamic_cast<network::IChunk *>(expected);
+            network::IChunk *a          = dynamic_cast<network::IChunk *>(actual);
+
+            ok = e && a && e->AbsoluteURI() == descriptor.url && a->AbsoluteURI() == descriptor.url && e->Host() == a->Host() && e->Path() == a->Path();
+
+            delete expected;
+            delete actual;
+        }
+    }
+
+    printf("{\"benchmark\":\"descriptors\",\"iterations\":%u,\"segments\":%llu,\"segment_objects_ms\":%.3f,\"descriptors_ms\":%.3f,\"allocations\":%llu}\n",
+           (unsigned int) iterations, (unsigned long long) media, objects / 1000.0 / iterations, described / 1000.0 / iterations, (unsigned long long) allocations);
+    fflush(stdout);
+
+    delete enumerator;
+    delete baseUrl;
+    delete mpd;
+    manager->Delete();
+    return ok && allocations <= 8;
+}
+static void appendUInt32(string &data, uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+        data += (char) ((value >> shift) & 0xFF);
+}
+static void appendUInt64(string &data, uint64_t value)
+{
+    appendUInt32(data, (uint32_t) (value >> 32));
+    appendUInt32(data, (uint32_t) value);
+}
+/*
+ *  A sidx box of the given version whose references all last the same duration. A size with the top bit set is the
+ *  reference_type 1, a reference to another sidx box.
+ */
+static string makeSidx(uint8_t version, uint32_t timescale, uint64_t earliestTime, uint64_t firstOffset, const vector<uint32_t> &sizes, uint32_t duration)
+{
+    string box;
+
+    appendUInt32(box, 0);
+    box += "sidx";
+    appendUInt32(box, (uint32_t) version << 24);
+    appendUInt32(box, 1);
+    appendUInt32(box, timescale);
+
+    if (version == 1)
+    {
+        appendUInt64(box, earliestTime);
+        appendUInt64(box, firstOffset);
+    }
+    else
+    {
+        appendUInt32(box, (uint32_t) earliestTime);
+        appendUInt32(box, (uint32_t) firstOffset);
+    }
+
+    appendUInt32(box, (uint32_t) sizes.size());
+
+    /* starts_with_SAP and SAP_type 1 */
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        appendUInt32(box, sizes.at(i));
+        appendUInt32(box, duration);
+        appendUInt32(box, 0x90000000);
+    }
+
+    string size;
+    appendUInt32(size, (uint32_t) box.size());
+
+    return box.replace(0, 4, size);
+}
+static bool parseSidx(SegmentIndex &index, const string &data, uint64_t offset)
+{
+    return index.Parse((const uint8_t *) data.data(), data.size(), offset);
+}
+static bool hasSubsegment(const SegmentIndex &index, size_t number, uint64_t firstByte, uint64_t lastByte, uint64_t startTime)
+{
+    SegmentDescriptor descriptor;
+
+    return index.GetSubsegment(number, descriptor) && descriptor.firstByte == firstByte && descriptor.lastByte == lastByte &&
+           descriptor.startTime == startTime;
+}
+/*
+ *  Loads the index of a SegmentBase Representation from the stand-in, which handles ranges as given. The stand-in
+ *  serves a 32 MB Media Segment whose sidx box follows a ftyp box, the bytes are what it sent for the load.
+ */
+static ISegmentIndex* loadFromStandIn(IDASHManager *manager, HTTPStandIn &server, RangeHandling rangeHandling, const string &media,
+                                      const string &sidx, uint64_t &bytes)
+{
+    stringstream ss;
+    ss << "<?xml version=\"1.0\"?>\n"
+          "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" type=\"static\" mediaPresentationDuration=\"PT512S\" minBufferTime=\"PT2S\">\n"
+          "  <Period>\n"
+          "    <AdaptationSet mimeType=\"video/mp4\">\n"
+          "      <Representation id=\"video\" bandwidth=\"500000\">\n"
+          "        <BaseURL>" << server.GetUrl("/vod/video.mp4") << "</BaseURL>\n"
+          "        <SegmentBase indexRange=\"24-" << 24 + sidx.size() - 1 << "\"/>\n"
+          "      </Representation>\n"
+          "    </AdaptationSet>\n"
+          "  </Period>\n"
+          "</MPD>\n";
+
+    string  manifest    = ss.str();
+    IMPD    *mpd        = manager->Open(manifest.data(), manifest.size(), server.GetUrl("/vod/video.mpd"));
+
+    if (mpd == NULL)
+        return NULL;
+
+    server.SetResource("/vod/video.mp4", media);
+    server.SetRangeHandling(rangeHandling);
+    server.ResetCounters();
+
+    IPeriod         *period         = mpd->GetPeriods().at(0);
+    IAdaptationSet  *adaptationSet  = period->GetAdaptationSets().at(0);
+    ISegmentIndex   *index          = mpd->LoadSegmentIndex(period, adaptationSet, adaptationSet->GetRepresentation().at(0));
+
+    /* the stand-in answers one request at a time, its counters are complete once the next request has been answered */
+    server.SetRangeHandling(ServeRange);
+    delete mpd->LoadSegmentIndex(period, adaptationSet, adaptationSet->GetRepresentation().at(0));
+
+    bytes = server.GetBytesSent();
+
+    delete mpd;
+    return index;
+}
+/*
+ *  Parses sidx boxes in memory: a version 0 box with the largest reference_count, whose parse time is measured, a
+ *  version 1 box with times and offsets beyond 32 bits, truncated boxes, which have to be rejected, and a hierarchical
+ *  index whose reference_type 1 entries are either followed within the data or left pending until their boxes are
+ *  passed. The index is then loaded through an HTTP stand-in: a server that ignores the range may not be downloaded
+ *  beyond the index, a partial response that does not start at the requested byte has to fail the load.
+ */
+static bool runSegmentIndex(size_t iterations)
+{
+    static const uint32_t   references  = 65535;
+    static const uint32_t   duration    = 180000;
+    static const uint64_t   offset      = 1000;
+
+    vector<uint32_t>    sizes;
+    uint64_t            lastOffset  = 0;
+
+    for (uint32_t i = 0; i < references; i++)
+    {
+        sizes.push_back(1000 + i % 100);
+        lastOffset += i + 1 < references ? sizes.back() : 0;
+    }
+
+    string      large   = makeSidx(0, 90000, 90000, 0, sizes, duration);
+    uint64_t    anchor  = offset + large.size();
+    uint64_t    parsed  = 0;
+    bool        ok      = true;
+
+    for (size_t i = 0; i < iterations && ok; i++)
+    {
+        SegmentIndex index(NULL, "video.mp4", 0, 90000);
+
+        uint64_t start = Measurement::GetTimeInUsec();
+
+        ok = parseSidx(index, large, offset);
+
+        parsed += Measurement::GetTimeInUsec() - start;
+
+        size_t number = 0;
+
+        ok = ok && index.GetSubsegmentCount() == references && !index.HasPendingReference() &&
+             hasSubsegment(index, 0, anchor, anchor + 999, 90000) &&
+             hasSubsegment(index, references - 1, anchor + lastOffset, anchor + lastOffset + sizes.back() - 1, 90000 + (uint64_t) (references - 1) * duration) &&
+             index.FindSubsegment(90000 + 10 * (uint64_t) duration + 5, number) && number == 10;
+    }
+
+    /* version 1 carries the earliest presentation time and the first offset in 64 bits */
+    uint64_t    earliestTime    = (1ULL << 33) + 7;
+    uint64_t    firstOffset     = (1ULL << 32) + 100;
+    string      version1        = makeSidx(1, 1000, earliestTime, firstOffset, vector<uint32_t>(3, 5000), 2000);
+    SegmentIndex index1(NULL, "video.mp4", 0, 1000);
+
+    ok = ok && parseSidx(index1, version1, 0) && index1.GetSubsegmentCount() == 3 &&
+         hasSubsegment(index1, 0, version1.size() + firstOffset, version1.size() + firstOffset + 4999, earliestTime) &&
+         hasSubsegment(index1, 2, version1.size() + firstOffset + 10000, version1.size() + firstOffset + 14999, earliestTime + 4000);
+
+    /* a box that is cut short or whose reference_count exceeds its entries */
+    string          small       = makeSidx(0, 1000, 0, 0, vector<uint32_t>(3, 5000), 2000);
+    string          truncated   = small.substr(0, small.size() - 1);
+    string          overcounted = small;
+    SegmentIndex    index2      (NULL, "video.mp4", 0, 1000);
+
+    overcounted[31] = 4;
+
+    ok = ok && !parseSidx(index2, truncated, 0) && !parseSidx(index2, overcounted, 0) && !parseSidx(index2, small.substr(0, 12), 0) &&
+         index2.GetSubsegmentCount() == 0;
+
+    /* a top level box that references two boxes, each followed by its Subsegments of 100 bytes */
+    string  first       = makeSidx(0, 1000, 0, 0, vector<uint32_t>(2, 100), 2000);
+    string  second      = makeSidx(0, 1000, 4000, 0, vector<uint32_t>(3, 100), 2000);
+    string  firstMedia  = first + string(200, 'm');
+    string  secondMedia = second + string(300, 'm');
+
+    sizes.clear();
+    sizes.push_back(0x80000000 | (uint32_t) firstMedia.size());
+    sizes.push_back(0x80000000 | (uint32_t) secondMedia.size());
+
+    string          top         = makeSidx(0, 1000, 0, 0, sizes, 4000);
+    uint64_t        secondStart = top.size() + firstMedia.size();
+    uint64_t        firstByte   = 0;
+    uint64_t        lastByte    = 0;
+    SegmentIndex    pending     (NULL, "video.mp4", 0, 1000);
+    SegmentIndex    followed    (NULL, "video.mp4", 0, 1000);
+
+    ok = ok && parseSidx(pending, top, 0) && pending.HasPendingReference() && pending.GetSubsegmentCount() == 2 && !hasSubsegment(pending, 0, 0, 0, 0);
+
+    if (ok)
+        pending.GetPendingReference(firstByte, lastByte);
+
+    ok = ok && firstByte == top.size() && lastByte == secondStart - 1 &&
+         pending.ParsePending((const uint8_t *) first.data(), first.size()) && pending.HasPendingReference() &&
+         pending.ParsePending((const uint8_t *) second.data(), second.size()) && !pending.HasPendingReference() &&
+         pending.GetSubsegmentCount() == 5 && hasSubsegment(pending, 1, top.size() + first.size() + 100, top.size() + first.size() + 199, 2000) &&
+         hasSubsegment(pending, 2, secondStart + second.size(), secondStart + second.size() + 99, 4000);
+
+    ok = ok && parseSidx(followed, top + firstMedia + secondMedia, 0) && !followed.HasPendingReference() && followed.GetSubsegmentCount() == 5 &&
+         hasSubsegment(followed, 4, secondStart + second.size() + 200, secondStart + second.size() + 299, 8000);
+
+    /* the Media Segment behind the stand-in */
+    HTTPStandIn server;
+
+    if (!server.Start())
+        return false;
+
+    string media;
+    string mediaSidx = makeSidx(0, 1000, 0, 0, vector<uint32_t>(256, 128 * 1024), 2000);
+
+    appendUInt32(media, 24);
+    media += "ftypisom";
+    appendUInt32(media, 0);
+    media += "isomdash";
+
+    media += mediaSidx;
+    media += string(256 * 128 * 1024, 'm');
+
+    IDASHManager    *manager        = CreateDashManager();
+    uint64_t        ignoredBytes    = 0;
+    uint64_t        rangeBytes      = 0;
+    uint64_t        shiftedBytes    = 0;
+    ISegmentIndex   *ignored        = loadFromStandIn(manager, server, IgnoreRange, media, mediaSidx, ignoredBytes);
+    ISegmentIndex   *range          = loadFromStandIn(manager, server, ServeRange, media, mediaSidx, rangeBytes);
+    ISegmentIndex   *shifted        = loadFromStandIn(manager, server, ShiftRange, media, mediaSidx, shiftedBytes);
+    SegmentDescriptor descriptor;
+
+    ok = ok && ignored && ignored->GetSubsegmentCount() == 256 && ignored->GetSubsegment(0, descriptor) && descriptor.firstByte == 24 + mediaSidx.size() &&
+         range && range->GetSubsegmentCount() == 256 && shifted == NULL && ignoredBytes < media.size() / 2;
+
+    printf("{\"benchmark\":\"sidx\",\"iterations\":%u,\"references\":%u,\"parse_ms\":%.3f,\"media_bytes\":%llu,\"range_ignored_bytes\":%llu,"
+           "\"range_served_bytes\":%llu,\"valid\":%s}\n",
+           (unsigned int) iterations, (unsigned int) references, parsed / 1000.0 / iterations, (unsigned long long) media.size(),
+           (unsigned long long) ignoredBytes, (unsigned long long) rangeBytes, ok ? "true" : "false");
+    fflush(stdout);
+
+    delete ignored;
+    delete range;
+    delete shifted;
+    manager->Delete();
+    server.Stop();
+    return ok;
+}
+static bool runMode(const string &mode, const string &path, size_t iterations)
+{
+    if (mode == "walk")
+        return runWalk(path, iterations);
+
+    if (mode == "memory")
+        return runMemory(path);
+
+    if (mode == "periods")
+        return runPeriods(path, iterations);
+
+    if (mode == "progressive")
+        return runProgressive(path, iterations);
+
+    if (mode == "concurrent")
+        return runConcurrent(iterations);
+
+    if (mode == "phases")
+        return runPhases(path, iterations);
+
+    if (mode == "patch")
+        return runPatch(iterations);
+
+    if (mode == "template")
+        return runTemplate(iterations);
+
+    if (mode == "baseurl")
+        return runBaseUrl(iterations);
+
+    if (mode == "descriptors")
+        return runDescriptors(iterations);
+
+    if (mode == "sidx")
+        return runSegmentIndex(iterations);
+
+    return run(mode, path, iterations);
+}
+static bool runIsolated(const string &mode, const string &path, size_t iterations)
+{
+#if defined _WIN32 || defined _WIN64
+    return runMode(mode, path, iterations);
+#else
+    pid_t pid = fork();
+
+    if (pid < 0)
+        return runMode(mode, path, iterations);
+
+    if (pid == 0)
+        _exit(runMode(mode, path, iterations) ? 0 : 1);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+}
+
+/*
+ *  Writes the worst case manifests that are measured in addition to the default one when no MPD is passed.
+ */
+static bool writeScenarios(vector<string> &paths)
+{
+    MPDGenerator ladder;
+    ladder.SetAdaptationSets(1);
+    ladder.SetRepresentations(40);
+    ladder.SetSegmentURLs(500);
+
+    MPDGenerator timeline;
+    timeline.SetRepresentations(6);
+    timeline.SetTimelineEntries(100000);
+
+    MPDGenerator list;
+    list.SetAdaptationSets(1);
+    list.SetRepresentations(4);
+    list.SetSegmentURLs(50000);
+
+    MPDGenerator protection;
+    protection.SetAdaptationSets(8);
+    protection.SetRepresentations(4);
+    protection.SetSegmentURLs(200);
+    protection.SetContentProtections(12);
+
+    const MPDGenerator  *generators[]   = { &ladder, &timeline, &list, &protection };
+    const char          *names[]        = { "ladder", "timeline", "list", "protection" };
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        string path = string("libdash_benchmark_") + names[i] + ".mpd";
+
+        if (!generators[i]->WriteToFile(path))
+        {
+            cerr << "could not write " << path << endl;
+            return false;
+        }
+
+        paths.push_back(path);
+    }
+
+    return true;
+}
+
+/*
+ *  libdash_benchmark [MPD] [iterations] [multi-period MPD]
+ *  Without an MPD the default manifest and the worst case scenarios are generated into the working directory.
+ *  Every measurement is printed as one JSON object per line.
+ */
+int main(int argc, char *argv[])
+{
+    string          path        = "libdash_benchmark.mpd";
+    string          periodsPath = "libdash_benchmark_periods.mpd";
+    size_t          iterations  = 3;
+    vector<string>  scenarios;
+
+    if (argc > 1)
+    {
+        path = argv[1];
+    }
+    else
+    {
+        MPDGenerator generator;
+        if (!generator.WriteToFile(path) || !writeScenarios(scenarios))
+        {
+            cerr << "could not write " << path << endl;
+            return 1;
+        }
+    }
+
+    if (argc > 2)
+        iterations = strtoul(argv[2], NULL, 10);
+
+    /* the multi-period manifest resembles one with server-side inserted ads: many short Periods */
+    if (argc > 3)
+    {
+        periodsPath = argv[3];
+    }
+    else
+    {
+        MPDGenerator generator;
+        generator.SetPeriods(200);
+        generator.SetRepresentations(4);
+        generator.SetSegmentURLs(50);
+        generator.SetAdSplices(true);
+        if (!generator.WriteToFile(periodsPath))
+        {
+            cerr << "could not write " << periodsPath << endl;
+            return 1;
+        }
+    }
+
+    if (iterations == 0)
+        iterations = 1;
+
+    bool ok = runIsolated("tree", path, iterations);
+    ok      = runIsolated("stream", path, iterations) && ok;
+    ok      = runIsolated("buffer", path, iterations) && ok;
+    ok      = runIsolated("mapped", path, iterations) && ok;
+    ok      = runIsolated("arena", path, iterations) && ok;
+    ok      = runIsolated("snapshot", path, iterations) && ok;
+    ok      = runIsolated("gzip", path, iterations) && ok;
+    ok      = runIsolated("gzip-mapped", path, iterations) && ok;
+    ok      = runIsolated("gzip-tempfile", path, iterations) && ok;
+    ok      = runIsolated("phases", path, iterations) && ok;
+    ok      = runIsolated("walk", path, iterations) && ok;
+    ok      = runIsolated("memory", path, 1) && ok;
+    ok      = runIsolated("periods", periodsPath, iterations) && ok;
+    ok      = runIsolated("progressive", path, iterations) && ok;
+    ok      = runIsolated("progressive", periodsPath, iterations) && ok;
+    ok      = runIsolated("concurrent", path, iterations) && ok;
+    ok      = runIsolated("patch", path, iterations) && ok;
+    ok      = runIsolated("template", path, iterations) && ok;
+    ok      = runIsolated("baseurl", path, iterations) && ok;
+    ok      = runIsolated("descriptors", path, iterations) && ok;
+    ok      = runIsolated("sidx", path, iterations) && ok;
+
+    for (size_t i = 0; i < scenarios.size(); i++)
+    {
+        ok  = runIsolated("stream", scenarios.at(i), iterations) && ok;
+        ok  = runIsolated("phases", scenarios.at(i), iterations) && ok;
+        ok  = runIsolated("walk", scenarios.at(i), iterations) && ok;
+        ok  = runIsolated("progressive", scenarios.at(i), iterations) && ok;
+        ok  = runIsolated("memory", scenarios.at(i), 1) && ok;
+    }
+
+    return ok ? 0 : 1;
+}
@@ -1,5 +1,7 @@
 #include <windows.h>
 #include <fstream>
+#include <cstdio>
+#include <curl/curl.h>
 #include "libdash.h"
 extern "C"
 {
@@ -16,14 +18,14 @@ using namespace dash::metrics;
 // Finds the mime type for the given adaptation set and looks for whether the
 // given string is a substring of it. Used for finding if an adaptation set
 // contains video or audio.
-bool isContainedInMimeType(dash::mpd::IAdaptationSet *adaptationSet, std::string value) {
-	std::string topMimeType = adaptationSet->GetMimeType();
+bool isContainedInMimeType(dash::mpd::IAdaptationSet *adaptationSet, const std::string &value) {
+	const std::string &topMimeType = adaptationSet->GetMimeType();
 	if (!topMimeType.empty())
 		if (topMimeType.find(value) != std::string::npos)
 			return true;
 
 	for (size_t i = 0; i < adaptationSet->GetRepresentation().size(); i++) {
-		std::string mimeType = adaptationSet->GetRepresentation().at(i)->GetMimeType();
+		const std::string &mimeType = adaptationSet->GetRepresentation().at(i)->GetMimeType();
 		if (!mimeType.empty())
 			if (mimeType.find(value) != std::string::npos)
 				return true;
@@ -33,7 +35,7 @@ bool isContainedInMimeType(dash::mpd::IAdaptationSet *adaptationSet, std::string
 }
 
 // If the value exists, returns a human-readable, indented string representation
-std::string showProperty(const char* name, std::string value) {
+std::string showProperty(const char* name, const std::string &value) {
 	if (value.empty()) return std::string("");
 	std::ostringstream os;
 	os << "  " << name << ": " << value << std::endl;
@@ -75,12 +77,12 @@ std::string segmentInfo(ISegmentTemplate* segmentTemplate, ISegmentBase* segment
 	}
 
 	if (segmentList) {
-		std::vector<ISegmentURL *> segmentURLs = segmentList->GetSegmentURLs();
-		for (size_t i = 0; i < segmentURLs.size(); i++) {
-			if (!segmentURLs[i]->GetMediaURI().empty())
-				os << "    Segment " << i << " media URI: " << segmentURLs[i]->GetMediaURI() << std::endl;
-			if (!segmentURLs[i]->GetIndexURI().empty())
-				os << "    Segment " << i << " index URI: " << segmentURLs[i]->GetIndexURI() << std::endl;
+		for (size_t i = 0; i < segmentList->GetSegmentURLCount(); i++) {
+			ISegmentURL *segmentURL = segmentList->GetSegmentURL(i);
+			if (!segmentURL->GetMediaURI().empty())
+				os << "    Segment " << i << " media URI: " << segmentURL->GetMediaURI() << std::endl;
+			if (!segmentURL->GetIndexURI().empty())
+				os << "    Segment " << i << " index URI: " << segmentURL->GetIndexURI() << std::endl;
 		}
 	}
 
@@ -114,132 +116,12 @@ std::vector<IBaseUrl*> allBaseURLs(IMPD *mpd, IPeriod *period, IAdaptationSet *a
 	return baseURLs;
 }
 
-template <typename T>
-void pushIfNotNull(std::vector<T> &v, T t) {
-	if (t)
-		v.push_back(t);
-}
-
-// Find all segments for a representation using a base segment representation
-// (i.e., not a list or a template)
-std::vector<ISegment*> baseSegments(std::vector<IBaseUrl*>& baseURLs, ISegmentBase* segmentBase, IRepresentation *representation) {
-	std::vector<ISegment*> segments;
-
-	if (segmentBase->GetInitialization())
-		pushIfNotNull(segments, segmentBase->GetInitialization()->ToSegment(baseURLs));
-
-	if (segmentBase->GetRepresentationIndex())
-		pushIfNotNull(segments, segmentBase->GetRepresentationIndex()->ToSegment(baseURLs));
-
-	std::vector<IBaseUrl*> representationURLs = representation->GetBaseURLs();
-	for (size_t i = 0; i < representationURLs.size(); i++)
-		pushIfNotNull(segments, representationURLs[i]->ToMediaSegment(baseURLs));
-
-	return segments;
-}
-
-// Find all segments for a representation using a segment list
-std::vector<ISegment*> listSegments(std::vector<IBaseUrl*>& baseURLs, ISegmentList* segmentList) {
-	std::vector<ISegment*> segments;
-
-	if (segmentList->GetInitialization())
-		pushIfNotNull(segments, segmentList->GetInitialization()->ToSegment(baseURLs));
-
-	if (segmentList->GetBitstreamSwitching())
-		pushIfNotNull(segments, segmentList->GetBitstreamSwitching()->ToSegment(baseURLs));
-
-	std::vector<ISegmentURL*> segmentURLs = segmentList->GetSegmentURLs();
-	for (size_t i = 0; i < segmentURLs.size(); i++) {
-		pushIfNotNull(segments, segmentURLs[i]->ToIndexSegment(baseURLs));
-		pushIfNotNull(segments, segmentURLs[i]->ToMediaSegment(baseURLs));
-	}
-
-	return segments;
-}
-
-// Find all segments for a representation using a segment template, except if
-// an unspecified number of segments are to be played, in which case only the
-// first one is returned
-std::vector<ISegment*> templateSegments(std::vector<IBaseUrl*>& baseURLs, ISegmentTemplate* segmentTemplate, IRepresentation *representation) {
-	std::vector<ISegment*> segments;
-
-	if (segmentTemplate->GetInitialization()) {
-		pushIfNotNull(segments, segmentTemplate->GetInitialization()->ToSegment(baseURLs));
-	} else {
-		pushIfNotNull(segments, segmentTemplate->ToInitializationSegment(baseURLs, representation->GetId(), representation->GetBandwidth()));
-	}
-
-	if (segmentTemplate->GetBitstreamSwitching()) {
-		pushIfNotNull(segments, segmentTemplate->GetBitstreamSwitching()->ToSegment(baseURLs));
-	} else {
-		pushIfNotNull(segments, segmentTemplate->ToBitstreamSwitchingSegment(baseURLs, representation->GetId(), representation->GetBandwidth()));
-	}
-
-	if (segmentTemplate->GetSegmentTimeline()) {
-		// Calculate segment start times
-		std::vector<uint32_t> startTimes;
-
-		std::vector<ITimeline*> timelines = segmentTemplate->GetSegmentTimeline()->GetTimelines();
-		for (size_t i = 0; i < timelines.size(); i++) {
-			for (uint32_t j = 0; j <= timelines[i]->GetRepeatCount(); j++) {
-				startTimes.push_back(timelines[i]->GetStartTime() + j * timelines[i]->GetDuration());
-			}
-		}
-
-		for (size_t i = 0; i < timelines.size(); i++) {
-			pushIfNotNull(segments, segmentTemplate->GetIndexSegmentFromTime(baseURLs, representation->GetId(), representation->GetBandwidth(), startTimes[i]));
-			pushIfNotNull(segments, segmentTemplate->GetMediaSegmentFromTime(baseURLs, representation->GetId(), representation->GetBandwidth(), startTimes[i]));
-		}
-	} else {
-		// In some cases, nSegments could be calculated from the segment duration and overall duration,
-		// but the overall duration isn't already given, in which case the video seems to continue indefinitely.
-		uint32_t nSegments = 1;
-		for (uint32_t i = 0; i < nSegments; i++) {
-			pushIfNotNull(segments, segmentTemplate->GetIndexSegmentFromNumber(baseURLs, representation->GetId(), representation->GetBandwidth(), segmentTemplate->GetStartNumber() + i));
-			pushIfNotNull(segments, segmentTemplate->GetMediaSegmentFromNumber(baseURLs, representation->GetId(), representation->GetBandwidth(), segmentTemplate->GetStartNumber() + i));
-		}
-	}
-
-	return segments;
-}
-
-// Find all segments for a representation
-std::vector<ISegment*> representationSegments(std::vector<IBaseUrl*>& baseURLs, IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation) {
-	if (representation->GetSegmentList()) {
-		return listSegments(baseURLs, representation->GetSegmentList());
-	} else if (representation->GetSegmentTemplate()) {
-		return templateSegments(baseURLs, representation->GetSegmentTemplate(), representation);
-	} else if (representation->GetSegmentBase()) {
-		return baseSegments(baseURLs, representation->GetSegmentBase(), representation);
-	} else if (adaptationSet->GetSegmentList()) {
-		return listSegments(baseURLs, adaptationSet->GetSegmentList());
-	} else if (adaptationSet->GetSegmentTemplate()) {
-		return templateSegments(baseURLs, adaptationSet->GetSegmentTemplate(), representation);
-	} else if (adaptationSet->GetSegmentBase()) {
-		return baseSegments(baseURLs, adaptationSet->GetSegmentBase(), representation);
-	} else if (period->GetSegmentList()) {
-		return listSegments(baseURLs, period->GetSegmentList());
-	} else if (period->GetSegmentTemplate()) {
-		return templateSegments(baseURLs, period->GetSegmentTemplate(), representation);
-	} else if (period->GetSegmentBase()) {
-		return baseSegments(baseURLs, period->GetSegmentBase(), representation);
-	} else if (!representation->GetBaseURLs().empty()) {
-		std::vector<ISegment*> segments;
-		std::vector<IBaseUrl*> representationURLs = representation->GetBaseURLs();
-		for (size_t i = 0; i < representationURLs.size(); i++) {
-			segments.push_back(representationURLs[i]->ToMediaSegment(baseURLs));
-		}
-		return segments;
-	}
-	return std::vector<ISegment*>();
-}
-
 // Print out human-readable information about a representation and its segments
 void dumpRepresentationInfo(IRepresentation *r) {
 	std::cout << "Representation " << r->GetId() << std::endl;
 	std::cout << "  Bandwidth: " << r->GetBandwidth() << "bps" << std::endl;
 	std::cout << representationBaseInfo(r);
-	const std::vector<IBaseUrl *> baseURLs = r->GetBaseURLs();
+	const std::vector<IBaseUrl *> &baseURLs = r->GetBaseURLs();
 	if (!baseURLs.empty()) {
 		std::cout << "  Base URLs:" << std::endl;
 		for (size_t i = 0; i < baseURLs.size(); i++) {
@@ -363,21 +245,144 @@ void downloadSegment(ISegment* s, bool preserve) {
 	}
 }
 
+// Downloads all segments of a representation in series. The segments are only described up front,
+// each one is turned into a downloadable segment right before it is downloaded. If the number of
+// segments isn't known, e.g. for a template without a period duration, only the first media segment
+// is downloaded.
+void downloadRepresentation(IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation, bool preserve) {
+	ISegmentEnumerator *segments = mpd->CreateSegmentEnumerator(period, adaptationSet, representation);
+	SegmentDescriptor descriptor;
+
+	while (segments->Next(descriptor)) {
+		ISegment *segment = segments->ToSegment(descriptor);
+		if (segment) {
+			downloadSegment(segment, preserve);
+			delete segment;
+		}
+		if (segments->IsOpenEnded() && descriptor.type == MediaSegment)
+			break;
+	}
+
+	delete segments;
+}
+
+// Header callback for fetchETag. Keeps the ETag of the last response, so
+// that the one of the final response is used after redirects.
+size_t etagHeader(char *buffer, size_t size, size_t nitems, void *userdata) {
+	std::string *etag = (std::string *) userdata;
+	std::string line(buffer, size * nitems);
+
+	if (line.compare(0, 5, "HTTP/") == 0)
+		etag->clear();
+	else if (line.size() > 5 && _strnicmp(line.c_str(), "ETag:", 5) == 0) {
+		size_t first = line.find_first_not_of(" \t", 5);
+		size_t last = line.find_last_not_of(" \t\r\n");
+		if (first != std::string::npos && last != std::string::npos && last >= first)
+			*etag = line.substr(first, last - first + 1);
+	}
+	return size * nitems;
+}
+
+// Asks the server for the ETag of the MPD without downloading it. Returns an
+// empty string if the request fails or the server does not send an ETag.
+std::string fetchETag(const char* url) {
+	std::string etag;
+	CURL *curl = curl_easy_init();
+	if (curl == NULL)
+		return etag;
+
+	curl_easy_setopt(curl, CURLOPT_URL, url);
+	curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, etagHeader);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &etag);
+
+	if (curl_easy_perform(curl) != CURLE_OK)
+		etag.clear();
+
+	curl_easy_cleanup(curl);
+	return etag;
+}
+
+// Names the snapshot of an MPD after a FNV-1a hash of its URL and ETag, so a
+// new version of the MPD never loads the snapshot of an older one
+std::string snapshotPath(const std::string& dir, const std::string& url, const std::string& etag) {
+	std::string key = url + "\n" + etag;
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < key.size(); i++) {
+		hash ^= (unsigned char) key[i];
+		hash *= 1099511628211ULL;
+	}
+
+	char name[32];
+	sprintf(name, "%016llx.mpdsnap", hash);
+	return dir + "\\" + name;
+}
+
+// A parse filter that only keeps video adaptation sets, since the others are
+// never shown. Adaptation sets without a content type are kept and checked by
+// isContainedInMimeType later on.
+class VideoFilter : public IParseFilter {
+public:
+	bool AcceptPeriod(const IPeriod *period, size_t index) {
+		return true;
+	}
+
+	bool AcceptAdaptationSet(const IPeriod *period, const IAdaptationSet *adaptationSet) {
+		return true;
+	}
+
+	bool AcceptContentType(const std::string &contentType) {
+		return contentType == "video";
+	}
+};
+
+// Opens the MPD, going through the snapshot cache if a directory is given.
+// MPDs without an ETag are always parsed, since a change could not be detected.
+// Only the video adaptation sets are parsed and unknown elements are skipped.
+IMPD* openMPD(IDASHManager* dashManager, char* url, const char* snapshotDir) {
+	VideoFilter filter;
+	ParseOptions options;
+	options.filter = &filter;
+	options.keepAdditionalSubNodes = false;
+
+	if (snapshotDir == NULL)
+		return dashManager->Open(url, options);
+
+	std::string etag = fetchETag(url);
+	if (etag.empty())
+		return dashManager->Open(url, options);
+
+	std::string path = snapshotPath(snapshotDir, url, etag);
+	IMPD* mpd = dashManager->OpenSnapshot(path.c_str());
+	if (mpd != NULL) {
+		std::cout << "Loaded MPD from snapshot " << path << std::endl;
+		return mpd;
+	}
+
+	mpd = dashManager->Open(url, options);
+	if (mpd != NULL && !dashManager->WriteSnapshot(mpd, path.c_str()))
+		std::cerr << "Failed to write snapshot " << path << std::endl;
+	return mpd;
+}
+
 int main(int argc, char *argv[]) {
 	if (argc < 2) {
-		std::cerr << "Usage: mpdinfo.exe <MPD URL> [-h] [--r-index N] [--r-id ID] [--preserve]" << std::endl;
+		std::cerr << "Usage: mpdinfo.exe <MPD URL> [-h] [--r-index N] [--r-id ID] [--preserve] [--snapshot-dir DIR]" << std::endl;
 		return 1;
 	}
 	char* URL = NULL;
 	int rIndex = -1;
 	char* rID = NULL;
 	bool preserve = false;
+	char* snapshotDir = NULL;
 	for (int i = 1; i < argc; i++) {
 		if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
-			std::cerr << "Usage: mpdinfo.exe <MPD URL> [-h] [--r-index N] [--r-id ID]" << std::endl;
+			std::cerr << "Usage: mpdinfo.exe <MPD URL> [-h] [--r-index N] [--r-id ID] [--preserve] [--snapshot-dir DIR]" << std::endl;
 			std::cerr << "--r-index: Selects a representation to download by index" << std::endl;
 			std::cerr << "--r-id: Selects a representation to download by ID" << std::endl;
 			std::cerr << "--preserve: Preserves downloaded video files and prints out their locations" << std::endl;
+			std::cerr << "--snapshot-dir: Caches parsed MPDs in DIR, keyed by URL and ETag, and loads them from there on later runs" << std::endl;
 			return 0;
 		} else if (strcmp(argv[i], "--r-index") == 0) {
 			rIndex = atoi(argv[i+1]);
@@ -395,6 +400,13 @@ int main(int argc, char *argv[]) {
 			i++;
 		} else if (strcmp(argv[i], "--preserve") == 0) {
 			preserve = true;
+		} else if (strcmp(argv[i], "--snapshot-dir") == 0) {
+			if (i + 1 >= argc) {
+				std::cerr << "--snapshot-dir requires a directory" << std::endl;
+				return 1;
+			}
+			snapshotDir = argv[i+1];
+			i++;
 		} else {
 			if (URL != NULL) {
 				std::cerr << "Multiple URLs specified or an invalid argument passed" << std::endl;
@@ -418,7 +430,7 @@ int main(int argc, char *argv[]) {
 
 	IDASHManager* dashManager = CreateDashManager();
 	std::cout << URL << std::endl;
-	IMPD* mpd = dashManager->Open(argv[1]);
+	IMPD* mpd = openMPD(dashManager, URL, snapshotDir);
 
 	if (mpd == NULL) {
 		std::cerr << "Failed to read MPD" << std::endl;
@@ -463,22 +475,9 @@ int main(int argc, char *argv[]) {
 					}
 				}
 
-				std::string fullBaseURL = "";
-				{
-					std::vector<IBaseUrl*> baseURLs = allBaseURLs(mpd, period, adaptationSet);
-					for (size_t i = 0; i < baseURLs.size(); i++) {
-						std::string baseURL = baseURLs.at(i)->GetUrl();
-						if (fullBaseURL == "") {
-							fullBaseURL = baseURL;
-						} else if (baseURL != "") {
-							if (baseURL.at(0) == '/' && fullBaseURL.at(fullBaseURL.size() - 1) == '/')
-								fullBaseURL += baseURL.substr(1, -1);
-							else if (baseURL.at(0) != '/' && fullBaseURL.at(fullBaseURL.size() - 1) != '/')
-								fullBaseURL += "/" + baseURL;
-						}
-					}
-				}
-				std::cout << showProperty("Full base URL", fullBaseURL);
+				IResolvedBaseUrl *resolvedBaseURL = mpd->ResolveBaseUrl(allBaseURLs(mpd, period, adaptationSet));
+				std::cout << showProperty("Full base URL", resolvedBaseURL->GetUrl());
+				delete resolvedBaseURL;
 
 				std::cout << segmentInfo(adaptationSet->GetSegmentTemplate(), adaptationSet->GetSegmentBase(), adaptationSet->GetSegmentList());
 
@@ -504,15 +503,8 @@ int main(int argc, char *argv[]) {
 					}
 				}
 
-				if (representation != NULL) {
-					std::vector<IBaseUrl*> baseURLs = allBaseURLs(mpd, period, adaptationSet);
-					std::vector<ISegment*> segments = representationSegments(baseURLs, mpd, period, adaptationSet, representation);
-					// Just download everything in series for now
-					for (size_t i = 0; i < segments.size(); i++) {
-						downloadSegment(segments[i], preserve);
-						delete segments[i];
-					}
-				}
+				if (representation != NULL)
+					downloadRepresentation(mpd, period, adaptationSet, representation, preserve);
 			}
 		}
 	}
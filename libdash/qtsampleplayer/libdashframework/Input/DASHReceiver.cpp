@@ -24,6 +24,7 @@ DASHReceiver::DASHReceiver          (IMPD *mpd, IDASHReceiverObserver *obs, Medi
               adaptationSetStream   (NULL),
               representationStream  (NULL),
               segmentNumber         (0),
+              positionInMsecs       (0),
               observer              (obs),
               buffer                (buffer),
               bufferSize            (bufferSize),
@@ -50,6 +51,11 @@ bool                        DASHReceiver::Start                     ()
     if(this->isBuffering)
         return false;
 
+    /* the index is loaded before the first segment number is handed out */
+    EnterCriticalSection(&this->monitorMutex);
+    this->LoadSegmentIndex();
+    LeaveCriticalSection(&this->monitorMutex);
+
     this->isBuffering       = true;
     this->bufferingThread   = CreateThreadPortable (DoBuffering, this);
 
@@ -143,9 +149,17 @@ void                        DASHReceiver::SetPosition               (uint32_t se
 }
 void                        DASHReceiver::SetPositionInMsecs        (uint32_t milliSecs)
 {
-    // some logic here
+    EnterCriticalSection(&this->monitorMutex);
+
+    size_t segmentNumber = 0;
+
+    /* the stream numbers its segments including the offset of a live stream */
+    if (this->representationStream->GetSegmentNumber(milliSecs, segmentNumber) && segmentNumber >= this->segmentOffset)
+        this->segmentNumber = (uint32_t) (segmentNumber - this->segmentOffset);
 
     this->positionInMsecs = milliSecs;
+
+    LeaveCriticalSection(&this->monitorMutex);
 }
 void                        DASHReceiver::SetRepresentation         (IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation)
 {
@@ -178,6 +192,7 @@ void                        DASHReceiver::SetRepresentation         (IPeriod *pe
     }
 
     this->representationStream  = this->adaptationSetStream->GetRepresentationStream(this->representation);
+    this->LoadSegmentIndex();
     this->DownloadInitSegment(this->representation);
 
     if (periodChanged)
@@ -203,6 +218,23 @@ uint32_t                    DASHReceiver::CalculateSegmentOffset    ()
 
     return (startSegNum > firstSegNum) ? startSegNum : firstSegNum;
 }
+void                        DASHReceiver::LoadSegmentIndex          ()
+{
+    uint32_t size = this->representationStream->GetSize();
+
+    this->representationStream->LoadSegmentIndex();
+
+    if (this->representationStream->GetSize() == size)
+        return;
+
+    /* with the index the segment numbers count Subsegments instead of BaseURLs, so the position is mapped again */
+    size_t segmentNumber = 0;
+
+    this->segmentNumber = 0;
+
+    if (this->representationStream->GetSegmentNumber(this->positionInMsecs, segmentNumber) && segmentNumber >= this->segmentOffset)
+        this->segmentNumber = (uint32_t) (segmentNumber - this->segmentOffset);
+}
 void                        DASHReceiver::NotifySegmentDownloaded   ()
 {
     this->observer->OnSegmentDownloaded();
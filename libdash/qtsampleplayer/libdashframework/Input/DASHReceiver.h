@@ -49,6 +49,7 @@ namespace libdash
 
                 private:
                     uint32_t        CalculateSegmentOffset  ();
+                    void            LoadSegmentIndex        ();
                     void            NotifySegmentDownloaded ();
                     void            DownloadInitSegment     (dash::mpd::IRepresentation* rep);
                     bool            InitSegmentExists       (dash::mpd::IRepresentation* rep);
@@ -20,9 +20,13 @@ AbstractRepresentationStream::AbstractRepresentationStream  (IMPD *mpd, IPeriod
                               adaptationSet                 (adaptationSet),
                               representation                (representation)
 {
+    /* the chain of base URLs is resolved once, segments only resolve their own URL against it */
+    this->resolvedBaseUrl   = BaseUrlResolver::Resolve(mpd, period, adaptationSet, 0, 0, 0);
+    this->baseUrls          = std::vector<IBaseUrl *>(1, this->resolvedBaseUrl);
 }
 AbstractRepresentationStream::~AbstractRepresentationStream ()
 {
+    delete(this->resolvedBaseUrl);
 }
 
 void        AbstractRepresentationStream::SetBaseUrls               (const std::vector<dash::mpd::IBaseUrl *> baseurls)
@@ -32,6 +36,10 @@ void        AbstractRepresentationStream::SetBaseUrls               (const std::
     for (size_t i = 0; i < baseurls.size(); i++)
         this->baseUrls.push_back(baseurls.at(i));
 }
+void        AbstractRepresentationStream::LoadSegmentIndex          ()
+{
+    /* the MPD addresses all segments */
+}
 uint32_t    AbstractRepresentationStream::GetSize                   ()
 {
     return UINT32_MAX - 1;
@@ -41,9 +49,9 @@ uint32_t    AbstractRepresentationStream::GetFirstSegmentNumber     ()
     if (this->mpd->GetType() == "dynamic")
     {
         uint32_t currTime   = TimeResolver::GetCurrentTimeInSec();
-        uint32_t availStT   = TimeResolver::GetUTCDateTimeInSec(this->mpd->GetAvailabilityStarttime());
+        uint32_t availStT   = (uint32_t) this->mpd->GetAvailabilityStarttimeValue().GetEpochSeconds();
         uint32_t duration   = this->GetAverageSegmentDuration();
-        uint32_t timeshift  = TimeResolver::GetDurationInSec(this->mpd->GetTimeShiftBufferDepth());
+        uint32_t timeshift  = (uint32_t) this->mpd->GetTimeShiftBufferDepthValue().GetSeconds();
 
         return (currTime - duration - availStT - timeshift ) / duration;
     }
@@ -56,7 +64,7 @@ uint32_t    AbstractRepresentationStream::GetCurrentSegmentNumber   ()
     {
         uint32_t currTime = TimeResolver::GetCurrentTimeInSec();
         uint32_t duration = this->GetAverageSegmentDuration();
-        uint32_t availStT = TimeResolver::GetUTCDateTimeInSec(this->mpd->GetAvailabilityStarttime());
+        uint32_t availStT = (uint32_t) this->mpd->GetAvailabilityStarttimeValue().GetEpochSeconds();
 
         return (currTime - duration - availStT) / duration;
     }
@@ -69,9 +77,9 @@ uint32_t    AbstractRepresentationStream::GetLastSegmentNumber      ()
     {
         uint32_t currTime   = TimeResolver::GetCurrentTimeInSec();
         uint32_t duration = this->GetAverageSegmentDuration();
-        uint32_t availStT   = TimeResolver::GetUTCDateTimeInSec(this->mpd->GetAvailabilityStarttime());
+        uint32_t availStT   = (uint32_t) this->mpd->GetAvailabilityStarttimeValue().GetEpochSeconds();
         uint32_t checkTime  = mpd->GetFetchTime() + 
-                              TimeResolver::GetDurationInSec(this->mpd->GetMinimumUpdatePeriod());
+                              (uint32_t) this->mpd->GetMinimumUpdatePeriodValue().GetSeconds();
 
         return ( ((checkTime > currTime) ? currTime : checkTime) - duration - availStT) / duration;
     }
@@ -82,3 +90,90 @@ uint32_t    AbstractRepresentationStream::GetAverageSegmentDuration ()
 {
     return 1;
 }
+bool        AbstractRepresentationStream::FindSegmentNumber         (const IMultipleSegmentBase *segmentBase, uint64_t milliSecs, size_t &segmentNumber)
+{
+    uint64_t timescale  = segmentBase->GetTimescale() ? segmentBase->GetTimescale() : 1;
+    uint64_t time       = (milliSecs / 1000) * timescale + (milliSecs % 1000) * timescale / 1000;
+
+    if (segmentBase->GetSegmentTimeline())
+    {
+        uint64_t index = 0;
+
+        /* the timeline is on the media timeline, which starts at @presentationTimeOffset */
+        if (!segmentBase->GetSegmentTimeline()->GetSegmentIndex(segmentBase->GetPresentationTimeOffset() + time, index))
+            return false;
+
+        segmentNumber = (size_t) index;
+        return true;
+    }
+
+    segmentNumber = segmentBase->GetDuration() ? (size_t) (time / segmentBase->GetDuration()) : 0;
+    return true;
+}
+bool        AbstractRepresentationStream::FindSegmentTime           (const IMultipleSegmentBase *segmentBase, size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs)
+{
+    uint64_t timescale  = segmentBase->GetTimescale() ? segmentBase->GetTimescale() : 1;
+    uint64_t startTime  = 0;
+    uint64_t duration   = 0;
+
+    if (segmentBase->GetSegmentTimeline())
+    {
+        if (!segmentBase->GetSegmentTimeline()->GetSegment(segmentNumber, startTime, duration))
+            return false;
+
+        startTime = startTime > segmentBase->GetPresentationTimeOffset() ? startTime - segmentBase->GetPresentationTimeOffset() : 0;
+    }
+    else if (segmentBase->GetDuration())
+    {
+        startTime   = (uint64_t) segmentNumber * segmentBase->GetDuration();
+        duration    = segmentBase->GetDuration();
+    }
+    else
+    {
+        /* without @duration there is a single segment that spans the Period */
+        if (segmentNumber > 0)
+            return false;
+
+        startMsecs      = 0;
+        durationMsecs   = this->GetPeriodDurationInMsecs();
+        return true;
+    }
+
+    startMsecs      = (startTime / timescale) * 1000 + (startTime % timescale) * 1000 / timescale;
+    durationMsecs   = (duration / timescale) * 1000 + (duration % timescale) * 1000 / timescale;
+    return true;
+}
+uint64_t    AbstractRepresentationStream::GetPeriodDurationInMsecs  ()
+{
+    if (this->period->GetDurationValue().isValid)
+        return (uint64_t) (this->period->GetDurationValue().ticks / (TicksPerSecond / 1000));
+
+    int64_t start = this->period->GetStartValue().isValid ? this->period->GetStartValue().ticks : 0;
+    int64_t end   = this->mpd->GetMediaPresentationDurationValue().isValid ? this->mpd->GetMediaPresentationDurationValue().ticks : 0;
+
+    for (size_t i = 0; i + 1 < this->mpd->GetPeriods().size(); i++)
+        if (this->mpd->GetPeriods().at(i) == this->period && this->mpd->GetPeriods().at(i + 1)->GetStartValue().isValid)
+            end = this->mpd->GetPeriods().at(i + 1)->GetStartValue().ticks;
+
+    return end > start ? (uint64_t) ((end - start) / (TicksPerSecond / 1000)) : 0;
+}
+bool        AbstractRepresentationStream::ParseByteRange            (const std::string &range, uint64_t &firstByte, uint64_t &lastByte)
+{
+    size_t dash = range.find('-');
+
+    firstByte   = 0;
+    lastByte    = 0;
+
+    if (range.empty() || dash == std::string::npos || dash + 1 >= range.size())
+        return false;
+
+    uint64_t first  = strtoull(range.c_str(), NULL, 10);
+    uint64_t last   = strtoull(range.c_str() + dash + 1, NULL, 10);
+
+    if (first > last)
+        return false;
+
+    firstByte   = first;
+    lastByte    = last;
+    return true;
+}
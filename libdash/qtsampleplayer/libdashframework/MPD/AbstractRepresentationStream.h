@@ -34,6 +34,8 @@ namespace libdash
                                                              dash::mpd::IRepresentation *representation);
                     virtual ~AbstractRepresentationStream   ();
 
+                    virtual void                        LoadSegmentIndex                ();
+
                     virtual dash::mpd::ISegment*        GetInitializationSegment        () = 0;
                     virtual dash::mpd::ISegment*        GetIndexSegment                 (size_t segmentNumber) = 0;
                     virtual dash::mpd::ISegment*        GetMediaSegment                 (size_t segmentNumber) = 0;
@@ -46,10 +48,22 @@ namespace libdash
                     virtual uint32_t                    GetLastSegmentNumber            ();
                     virtual uint32_t                    GetAverageSegmentDuration       ();
 
+                    virtual bool                        GetSegmentNumber                (uint64_t milliSecs, size_t &segmentNumber) = 0;
+                    virtual bool                        GetSegmentTime                  (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs) = 0;
+                    virtual bool                        GetSegmentByteRange             (size_t segmentNumber, uint64_t &firstByte, uint64_t &lastByte) = 0;
+
                 protected:
                     virtual void                        SetBaseUrls                     (const std::vector<dash::mpd::IBaseUrl *> baseurls);
 
+                    /* the mapping of SegmentList and SegmentTemplate, by their SegmentTimeline or by @duration */
+                    bool                                FindSegmentNumber               (const dash::mpd::IMultipleSegmentBase *segmentBase, uint64_t milliSecs, size_t &segmentNumber);
+                    bool                                FindSegmentTime                 (const dash::mpd::IMultipleSegmentBase *segmentBase, size_t segmentNumber,
+                                                                                         uint64_t &startMsecs, uint64_t &durationMsecs);
+                    uint64_t                            GetPeriodDurationInMsecs        ();
+                    static bool                         ParseByteRange                  (const std::string &range, uint64_t &firstByte, uint64_t &lastByte);
+
                     std::vector<dash::mpd::IBaseUrl *>  baseUrls;
+                    dash::mpd::IResolvedBaseUrl         *resolvedBaseUrl;
                     dash::mpd::IMPD                     *mpd;
                     dash::mpd::IPeriod                  *period;
                     dash::mpd::IAdaptationSet           *adaptationSet;
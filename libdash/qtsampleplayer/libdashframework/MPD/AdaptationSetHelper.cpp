@@ -44,7 +44,7 @@ bool                            AdaptationSetHelper::IsVideoAdaptationSet   (das
 {
     return IsContainedInMimeType(adaptationSet, "video");
 }
-bool                            AdaptationSetHelper::IsContainedInMimeType  (dash::mpd::IAdaptationSet *adaptationSet, std::string value)
+bool                            AdaptationSetHelper::IsContainedInMimeType  (dash::mpd::IAdaptationSet *adaptationSet, const std::string &value)
 {
     if (adaptationSet->GetMimeType() != "")
         if (adaptationSet->GetMimeType().find(value) != std::string::npos)
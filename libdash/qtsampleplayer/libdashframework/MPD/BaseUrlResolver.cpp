@@ -62,3 +62,8 @@ std::vector<dash::mpd::IBaseUrl *> BaseUrlResolver::ResolveBaseUrl(IMPD *mpd, IP
 
     return urls;
 }
+IResolvedBaseUrl*                  BaseUrlResolver::Resolve       (IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet,
+                                                                   size_t mpdBaseUrl, size_t periodBaseUrl, size_t adaptationSetBaseUrl)
+{
+    return mpd->ResolveBaseUrl(ResolveBaseUrl(mpd, period, adaptationSet, mpdBaseUrl, periodBaseUrl, adaptationSetBaseUrl));
+}
@@ -25,6 +25,10 @@ namespace libdash
                 public:
                     static std::vector<dash::mpd::IBaseUrl *>   ResolveBaseUrl  (dash::mpd::IMPD *mpd, dash::mpd::IPeriod *period, dash::mpd::IAdaptationSet *adaptationSet, 
                                                                                  size_t mpdBaseUrl, size_t periodBaseUrl, size_t adaptationSetBaseUrl);
+
+                    /* resolves the chain above into one absolute base URL that has to be deleted by the caller */
+                    static dash::mpd::IResolvedBaseUrl*         Resolve         (dash::mpd::IMPD *mpd, dash::mpd::IPeriod *period, dash::mpd::IAdaptationSet *adaptationSet,
+                                                                                 size_t mpdBaseUrl, size_t periodBaseUrl, size_t adaptationSetBaseUrl);
             };
         }
     }
@@ -33,6 +33,14 @@ namespace libdash
                 public:
                     virtual ~IRepresentationStream () {}
 
+                    /*
+                     *  Fetches what the stream needs to address its segments beyond the MPD, i.e. the segment index of a single Media Segment.
+                     *  It blocks on the network and has to be called once the stream is selected, before any of its segment numbers is used:
+                     *  none of the other methods fetches anything, they address the stream as a whole until it has been loaded or if there is
+                     *  no index that can be loaded, and the segment numbers count Subsegments afterwards.
+                     */
+                    virtual void                        LoadSegmentIndex                () = 0;
+
                     virtual dash::mpd::ISegment*        GetInitializationSegment        () = 0;
                     virtual dash::mpd::ISegment*        GetIndexSegment                 (size_t segmentNumber) = 0;
                     virtual dash::mpd::ISegment*        GetMediaSegment                 (size_t segmentNumber) = 0;
@@ -43,6 +51,18 @@ namespace libdash
                     virtual uint32_t                    GetCurrentSegmentNumber         () = 0;
                     virtual uint32_t                    GetLastSegmentNumber            () = 0;
                     virtual uint32_t                    GetAverageSegmentDuration       () = 0;
+
+                    /*
+                     *  Maps between the presentation time in milliseconds since the start of the Period and the segment numbers that are passed
+                     *  to GetMediaSegment(). The @timescale and @presentationTimeOffset of the segment information are taken into account and
+                     *  a SegmentTimeline is searched in O(log n), so no segment has to be downloaded for a seek.
+                     */
+                    virtual bool                        GetSegmentNumber                (uint64_t milliSecs, size_t &segmentNumber) = 0;
+                    virtual bool                        GetSegmentTime                  (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs) = 0;
+
+                    /* the byte range of a media segment that is only a part of its resource. Returns false and sets both bytes to 0 if the
+                       whole resource is requested or there is no such segment */
+                    virtual bool                        GetSegmentByteRange             (size_t segmentNumber, uint64_t &firstByte, uint64_t &lastByte) = 0;
             };
         }
     }
@@ -17,7 +17,6 @@ using namespace libdash::framework::mpd;
 SegmentListStream::SegmentListStream            (IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation) :
                    AbstractRepresentationStream (mpd, period, adaptationSet, representation)
 {
-    this->baseUrls      = BaseUrlResolver::ResolveBaseUrl(mpd, period, adaptationSet, 0, 0, 0);
     this->segmentList   = FindSegmentList(); 
 }
 SegmentListStream::~SegmentListStream           ()
@@ -32,15 +31,15 @@ ISegment*                   SegmentListStream::GetInitializationSegment     ()
 }
 ISegment*                   SegmentListStream::GetIndexSegment              (size_t segmentNumber)
 {
-    if (this->segmentList->GetSegmentURLs().size() > segmentNumber)
-        return this->segmentList->GetSegmentURLs().at(segmentNumber)->ToIndexSegment(this->baseUrls);
+    if (this->segmentList->GetSegmentURLCount() > segmentNumber)
+        return this->segmentList->GetSegmentURL(segmentNumber)->ToIndexSegment(this->baseUrls);
 
     return NULL;
 }
 ISegment*                   SegmentListStream::GetMediaSegment              (size_t segmentNumber)
 {
-    if (this->segmentList->GetSegmentURLs().size() > segmentNumber)
-        return this->segmentList->GetSegmentURLs().at(segmentNumber)->ToMediaSegment(this->baseUrls);
+    if (this->segmentList->GetSegmentURLCount() > segmentNumber)
+        return this->segmentList->GetSegmentURL(segmentNumber)->ToMediaSegment(this->baseUrls);
 
     return NULL;
 }
@@ -57,7 +56,33 @@ RepresentationStreamType    SegmentListStream::GetStreamType                ()
 }
 uint32_t                    SegmentListStream::GetSize                      ()
 {
-    return this->segmentList->GetSegmentURLs().size();
+    return this->segmentList->GetSegmentURLCount();
+}
+bool                        SegmentListStream::GetSegmentNumber             (uint64_t milliSecs, size_t &segmentNumber)
+{
+    if (!this->FindSegmentNumber(this->segmentList, milliSecs, segmentNumber))
+        return false;
+
+    return segmentNumber < this->GetSize();
+}
+bool                        SegmentListStream::GetSegmentTime               (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs)
+{
+    if (segmentNumber >= this->GetSize())
+        return false;
+
+    return this->FindSegmentTime(this->segmentList, segmentNumber, startMsecs, durationMsecs);
+}
+bool                        SegmentListStream::GetSegmentByteRange          (size_t segmentNumber, uint64_t &firstByte, uint64_t &lastByte)
+{
+    if (segmentNumber >= this->GetSize())
+    {
+        firstByte   = 0;
+        lastByte    = 0;
+        return false;
+    }
+
+    /* without a @mediaRange the whole resource is requested */
+    return ParseByteRange(this->segmentList->GetSegmentURL(segmentNumber)->GetMediaRange(), firstByte, lastByte);
 }
 ISegmentList*               SegmentListStream::FindSegmentList              ()
 {
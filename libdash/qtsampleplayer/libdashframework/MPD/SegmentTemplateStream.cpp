@@ -17,9 +17,7 @@ using namespace libdash::framework::mpd;
 SegmentTemplateStream::SegmentTemplateStream            (IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation) :
                        AbstractRepresentationStream     (mpd, period, adaptationSet, representation)
 {
-    this->baseUrls          = BaseUrlResolver::ResolveBaseUrl(mpd, period, adaptationSet, 0, 0, 0);
     this->segmentTemplate   = FindSegmentTemplate();
-    CalculateSegmentStartTimes();
 }
 SegmentTemplateStream::~SegmentTemplateStream           ()
 {
@@ -36,8 +34,11 @@ ISegment*                   SegmentTemplateStream::GetIndexSegment
     /* time-based template */
     if (this->segmentTemplate->GetSegmentTimeline())
     {
-        if (this->segmentStartTimes.size() > segmentNumber)
-            return this->segmentTemplate->GetIndexSegmentFromTime(baseUrls, representation->GetId(), representation->GetBandwidth(), this->segmentStartTimes.at(segmentNumber));
+        uint64_t startTime  = 0;
+        uint64_t duration   = 0;
+
+        if (this->segmentTemplate->GetSegmentTimeline()->GetSegment(segmentNumber, startTime, duration))
+            return this->segmentTemplate->GetIndexSegmentFromTime(baseUrls, representation->GetId(), representation->GetBandwidth(), startTime);
 
         return NULL;
     }
@@ -51,8 +52,11 @@ ISegment*                   SegmentTemplateStream::GetMediaSegment
     /* time-based template */
     if (this->segmentTemplate->GetSegmentTimeline())
     {
-        if (this->segmentStartTimes.size() > segmentNumber)
-            return this->segmentTemplate->GetMediaSegmentFromTime(baseUrls, representation->GetId(), representation->GetBandwidth(), this->segmentStartTimes.at(segmentNumber));
+        uint64_t startTime  = 0;
+        uint64_t duration   = 0;
+
+        if (this->segmentTemplate->GetSegmentTimeline()->GetSegment(segmentNumber, startTime, duration))
+            return this->segmentTemplate->GetMediaSegmentFromTime(baseUrls, representation->GetId(), representation->GetBandwidth(), startTime);
 
         return NULL;
     }
@@ -75,15 +79,20 @@ RepresentationStreamType    SegmentTemplateStream::GetStreamType
 }
 uint32_t                    SegmentTemplateStream::GetSize                      ()
 {
-    if (!this->segmentStartTimes.empty())
-        return this->segmentStartTimes.size();
+    if (this->segmentTemplate->GetSegmentTimeline())
+    {
+        uint64_t numberOfSegments = this->segmentTemplate->GetSegmentTimeline()->GetSegmentCount(GetTimelineEndTime());
+
+        if (numberOfSegments > 0)
+            return (uint32_t) std::min<uint64_t>(numberOfSegments, UINT32_MAX - 1);
+    }
 
     uint32_t numberOfSegments          = 0;
     double   mediaPresentationDuration = 0;
 
     if (this->mpd->GetType() == "static")
     {
-        mediaPresentationDuration = TimeResolver::GetDurationInSec(this->mpd->GetMediaPresentationDuration());
+        mediaPresentationDuration = this->mpd->GetMediaPresentationDurationValue().GetSeconds();
 
         numberOfSegments = (uint32_t) ceil(mediaPresentationDuration / (this->segmentTemplate->GetDuration() / this->segmentTemplate->GetTimescale()));
     }
@@ -99,6 +108,27 @@ uint32_t                    SegmentTemplateStream::GetAverageSegmentDuration
     /* TODO calculate average segment durations for SegmentTimeline */
     return this->segmentTemplate->GetDuration();
 }
+bool                        SegmentTemplateStream::GetSegmentNumber             (uint64_t milliSecs, size_t &segmentNumber)
+{
+    if (!this->FindSegmentNumber(this->segmentTemplate, milliSecs, segmentNumber))
+        return false;
+
+    return segmentNumber < this->GetSize();
+}
+bool                        SegmentTemplateStream::GetSegmentTime               (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs)
+{
+    if (segmentNumber >= this->GetSize())
+        return false;
+
+    return this->FindSegmentTime(this->segmentTemplate, segmentNumber, startMsecs, durationMsecs);
+}
+bool                        SegmentTemplateStream::GetSegmentByteRange          (size_t, uint64_t &firstByte, uint64_t &lastByte)
+{
+    /* every segment of a template is a resource of its own */
+    firstByte   = 0;
+    lastByte    = 0;
+    return false;
+}
 ISegmentTemplate*           SegmentTemplateStream::FindSegmentTemplate          ()
 {
     if (this->representation->GetSegmentTemplate())
@@ -112,41 +142,13 @@ ISegmentTemplate*           SegmentTemplateStream::FindSegmentTemplate
 
     return NULL;
 }
-void                        SegmentTemplateStream::CalculateSegmentStartTimes   ()
+uint64_t                    SegmentTemplateStream::GetTimelineEndTime           ()
 {
-    if (!this->segmentTemplate->GetSegmentTimeline())
-        return;
-
-    size_t   numOfTimelines = 0;
-    uint32_t segStartTime   = 0;
-    uint32_t segDuration    = 0;
-    size_t   repeatCount    = 0;
+    /* an S element with @r = -1 at the end of the timeline repeats until the end of the presentation */
+    if (this->mpd->GetType() != "static")
+        return UINT64_MAX;
 
-    numOfTimelines      = this->segmentTemplate->GetSegmentTimeline()->GetTimelines().size();
+    double mediaPresentationDuration = this->mpd->GetMediaPresentationDurationValue().GetSeconds();
 
-    for (size_t i = 0; i < numOfTimelines; i++)
-    {
-        repeatCount     = this->segmentTemplate->GetSegmentTimeline()->GetTimelines().at(i)->GetRepeatCount();
-        segStartTime    = this->segmentTemplate->GetSegmentTimeline()->GetTimelines().at(i)->GetStartTime();
-        segDuration     = this->segmentTemplate->GetSegmentTimeline()->GetTimelines().at(i)->GetDuration();
-
-        if (repeatCount > 0)
-        {
-            for (size_t j = 0; j <= repeatCount; j++)
-            {
-                if (segStartTime > 0)
-                {
-                    this->segmentStartTimes.push_back(segStartTime + segDuration * j);
-                }
-                else
-                {
-                    /* TODO: implement if SegmentTemplate.SegmentTimeline.S@t is not specified */
-                }
-            }
-        }
-        else
-        {
-            this->segmentStartTimes.push_back(segStartTime);
-        }
-    }
+    return this->segmentTemplate->GetPresentationTimeOffset() + (uint64_t) (mediaPresentationDuration * this->segmentTemplate->GetTimescale());
 }
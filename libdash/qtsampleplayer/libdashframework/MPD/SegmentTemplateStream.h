@@ -39,13 +39,15 @@ namespace libdash
                     virtual uint32_t                    GetSize                         ();
 
                     virtual uint32_t                    GetAverageSegmentDuration       ();
+                    virtual bool                        GetSegmentNumber                (uint64_t milliSecs, size_t &segmentNumber);
+                    virtual bool                        GetSegmentTime                  (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs);
+                    virtual bool                        GetSegmentByteRange             (size_t segmentNumber, uint64_t &firstByte, uint64_t &lastByte);
 
                 private:
                     dash::mpd::ISegmentTemplate*        FindSegmentTemplate             ();
-                    void                                CalculateSegmentStartTimes      ();
+                    uint64_t                            GetTimelineEndTime              ();
 
                     dash::mpd::ISegmentTemplate *segmentTemplate;
-                    std::vector<uint32_t>       segmentStartTimes;
             };
         }
     }
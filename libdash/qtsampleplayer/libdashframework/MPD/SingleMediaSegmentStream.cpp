@@ -15,12 +15,40 @@ using namespace dash::mpd;
 using namespace libdash::framework::mpd;
 
 SingleMediaSegmentStream::SingleMediaSegmentStream      (IMPD *mpd, IPeriod *period, IAdaptationSet *adaptationSet, IRepresentation *representation) :
-                          AbstractRepresentationStream  (mpd, period, adaptationSet, representation)
+                          AbstractRepresentationStream  (mpd, period, adaptationSet, representation),
+                          segmentIndex                  (NULL),
+                          isSegmentIndexLoaded          (false)
 {
-    this->baseUrls = BaseUrlResolver::ResolveBaseUrl(mpd, period, adaptationSet, 0, 0, 0);
+    InitializeCriticalSection(&this->monitorMutex);
 }
 SingleMediaSegmentStream::~SingleMediaSegmentStream     ()
 {
+    delete(this->segmentIndex);
+
+    DeleteCriticalSection(&this->monitorMutex);
+}
+void                        SingleMediaSegmentStream::LoadSegmentIndex              ()
+{
+    EnterCriticalSection(&this->monitorMutex);
+    bool isLoaded = this->isSegmentIndexLoaded;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    if (isLoaded)
+        return;
+
+    /* the fetch is done without the lock, so a seek from another thread does not wait for the network */
+    ISegmentIndex *index = this->mpd->LoadSegmentIndex(this->period, this->adaptationSet, this->representation);
+
+    EnterCriticalSection(&this->monitorMutex);
+
+    if (this->isSegmentIndexLoaded)
+        delete(index);
+    else
+        this->segmentIndex = index;
+
+    this->isSegmentIndexLoaded = true;
+
+    LeaveCriticalSection(&this->monitorMutex);
 }
 ISegment*                   SingleMediaSegmentStream::GetInitializationSegment      ()
 {
@@ -47,7 +75,11 @@ ISegment*                   SingleMediaSegmentStream::GetIndexSegment
 }
 ISegment*                   SingleMediaSegmentStream::GetMediaSegment               (size_t segmentNumber)
 {
-    /* segmentNumber equals the desired BaseUrl */
+    /* with an index segmentNumber is the Subsegment, which is requested as a byte range */
+    if (this->GetSegmentIndex())
+        return this->segmentIndex->ToSegment(segmentNumber);
+
+    /* otherwise segmentNumber equals the desired BaseUrl */
     if (this->representation->GetBaseURLs().size() > segmentNumber)
         return this->representation->GetBaseURLs().at(segmentNumber)->ToMediaSegment(baseUrls);
 
@@ -62,6 +94,13 @@ RepresentationStreamType    SingleMediaSegmentStream::GetStreamType
 {
     return SingleMediaSegment;
 }
+uint32_t                    SingleMediaSegmentStream::GetSize                         ()
+{
+    if (this->GetSegmentIndex())
+        return (uint32_t) this->segmentIndex->GetSubsegmentCount();
+
+    return AbstractRepresentationStream::GetSize();
+}
 uint32_t                    SingleMediaSegmentStream::GetFirstSegmentNumber           ()
 {
     return 0;
@@ -73,4 +112,68 @@ uint32_t                    SingleMediaSegmentStream::GetCurrentSegmentNumber
 uint32_t                    SingleMediaSegmentStream::GetLastSegmentNumber            ()
 {
     return 0;
+}
+bool                        SingleMediaSegmentStream::GetSegmentNumber                (uint64_t milliSecs, size_t &segmentNumber)
+{
+    if (this->GetSegmentIndex())
+    {
+        uint64_t timescale  = this->segmentIndex->GetTimescale();
+        uint64_t time       = (milliSecs / 1000) * timescale + (milliSecs % 1000) * timescale / 1000;
+        SegmentDescriptor first;
+
+        /* the index is on the media timeline, which starts at @presentationTimeOffset */
+        if (!this->segmentIndex->GetSubsegment(0, first))
+            return false;
+
+        return this->segmentIndex->FindSubsegment(first.presentationTimeOffset + time, segmentNumber);
+    }
+
+    /* the whole Period is a single segment */
+    segmentNumber = 0;
+    return true;
+}
+bool                        SingleMediaSegmentStream::GetSegmentTime                  (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs)
+{
+    SegmentDescriptor descriptor;
+
+    if (this->GetSegmentIndex())
+    {
+        if (!this->segmentIndex->GetSubsegment(segmentNumber, descriptor))
+            return false;
+
+        uint64_t startTime = descriptor.startTime > descriptor.presentationTimeOffset ? descriptor.startTime - descriptor.presentationTimeOffset : 0;
+
+        startMsecs      = (startTime / descriptor.timescale) * 1000 + (startTime % descriptor.timescale) * 1000 / descriptor.timescale;
+        durationMsecs   = (descriptor.duration / descriptor.timescale) * 1000 + (descriptor.duration % descriptor.timescale) * 1000 / descriptor.timescale;
+        return true;
+    }
+
+    /* segmentNumber selects one of the BaseURLs, which all carry the same segment */
+    startMsecs      = 0;
+    durationMsecs   = this->GetPeriodDurationInMsecs();
+    return true;
+}
+bool                        SingleMediaSegmentStream::GetSegmentByteRange             (size_t segmentNumber, uint64_t &firstByte, uint64_t &lastByte)
+{
+    SegmentDescriptor descriptor;
+
+    firstByte   = 0;
+    lastByte    = 0;
+
+    /* without an index the whole Media Segment is requested */
+    if (!this->GetSegmentIndex() || !this->segmentIndex->GetSubsegment(segmentNumber, descriptor))
+        return false;
+
+    firstByte   = descriptor.firstByte;
+    lastByte    = descriptor.lastByte;
+    return true;
+}
+ISegmentIndex*              SingleMediaSegmentStream::GetSegmentIndex                 ()
+{
+    /* the index is never replaced once it has been set, so it may be used after the lock has been left */
+    EnterCriticalSection(&this->monitorMutex);
+    ISegmentIndex *index = this->segmentIndex;
+    LeaveCriticalSection(&this->monitorMutex);
+
+    return index;
 }
\ No newline at end of file
@@ -15,6 +15,8 @@
 #include "IMPD.h"
 #include "AbstractRepresentationStream.h"
 #include "ISegment.h"
+#include "ISegmentIndex.h"
+#include "../Portable/MultiThreading.h"
 
 namespace libdash
 {
@@ -28,16 +30,30 @@ namespace libdash
                     SingleMediaSegmentStream           (dash::mpd::IMPD *mpd, dash::mpd::IPeriod *period, dash::mpd::IAdaptationSet *adaptationSet, dash::mpd::IRepresentation *representation);
                     virtual ~SingleMediaSegmentStream  ();
 
+                    virtual void                        LoadSegmentIndex                ();
+
                     virtual dash::mpd::ISegment*        GetInitializationSegment        ();
                     virtual dash::mpd::ISegment*        GetIndexSegment                 (size_t segmentNumber);
                     virtual dash::mpd::ISegment*        GetMediaSegment                 (size_t segmentNumber);
                     virtual dash::mpd::ISegment*        GetBitstreamSwitchingSegment    ();
                     virtual RepresentationStreamType    GetStreamType                   ();
 
+                    virtual uint32_t                    GetSize                         ();
                     virtual uint32_t                    GetFirstSegmentNumber           ();
                     virtual uint32_t                    GetCurrentSegmentNumber         ();
                     virtual uint32_t                    GetLastSegmentNumber            ();
 
+                    virtual bool                        GetSegmentNumber                (uint64_t milliSecs, size_t &segmentNumber);
+                    virtual bool                        GetSegmentTime                  (size_t segmentNumber, uint64_t &startMsecs, uint64_t &durationMsecs);
+                    virtual bool                        GetSegmentByteRange             (size_t segmentNumber, uint64_t &firstByte, uint64_t &lastByte);
+
+                private:
+                    /* the Subsegments of the sidx boxes in @indexRange, NULL until LoadSegmentIndex() has fetched them or if there are none */
+                    dash::mpd::ISegmentIndex*           GetSegmentIndex                 ();
+
+                    dash::mpd::ISegmentIndex            *segmentIndex;
+                    bool                                isSegmentIndexLoaded;
+                    mutable CRITICAL_SECTION            monitorMutex;
             };
         }
     }